@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_CONTAINER_ACTION_HPP
 #define RANGES_V3_CONTAINER_ACTION_HPP
 
+#include <tuple>
+#include <utility>
 #include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
@@ -26,6 +28,89 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // An action's function with the arguments that follow the
+            // range bound to it, as by std::bind(fn, _1, args...), but of a
+            // type that tells which action it is and what it was given, so
+            // that a pipeline of actions can spot neighbours it can run as
+            // one (see action::sort and action::remove_if).
+            template<typename Fn, typename...Args>
+            struct bound_action_fn
+            {
+                std::tuple<Args...> args;
+            private:
+                template<typename Rng, std::size_t...Is>
+                auto call_(Rng &&rng, meta::index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    Fn{}(std::forward<Rng>(rng), std::get<Is>(args)...)
+                )
+            public:
+                template<typename Rng>
+                auto operator()(Rng &&rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    this->call_(std::forward<Rng>(rng),
+                        meta::make_index_sequence<sizeof...(Args)>{})
+                )
+            };
+
+            template<typename Fn, typename...Args>
+            bound_action_fn<Fn, Args...> bind_action(Fn, Args...args)
+            {
+                return {std::tuple<Args...>{std::move(args)...}};
+            }
+
+            // The arguments that follow the range in the calls an action
+            // makes, when it is action Fn, bound or not.
+            template<typename Fn, typename Action>
+            struct bound_args
+            {};
+
+            template<typename Fn>
+            struct bound_args<Fn, Fn>
+            {
+                using type = std::tuple<>;
+                static type get(Fn const &)
+                {
+                    return {};
+                }
+            };
+
+            template<typename Fn, typename...Args>
+            struct bound_args<Fn, bound_action_fn<Fn, Args...>>
+            {
+                using type = std::tuple<Args...>;
+                static type const &get(bound_action_fn<Fn, Args...> const &fn)
+                {
+                    return fn.args;
+                }
+            };
+
+            template<typename Fn, typename Action>
+            using bound_args_t = meta::_t<bound_args<Fn, Action>>;
+
+            // Calls fn with rng and the elements of the tuple args.
+            template<typename Fn, typename Rng, typename...Args, std::size_t...Is>
+            auto apply_action_(Fn const &fn, Rng &&rng, std::tuple<Args...> const &args,
+                meta::index_sequence<Is...>)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                fn(std::forward<Rng>(rng), std::get<Is>(args)...)
+            )
+
+            template<typename Fn, typename Rng, typename...Args>
+            auto apply_action(Fn const &fn, Rng &&rng, std::tuple<Args...> const &args)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                detail::apply_action_(fn, std::forward<Rng>(rng), args,
+                    meta::make_index_sequence<sizeof...(Args)>{})
+            )
+        }
+        /// \endcond
+
         /// \addtogroup group-actions
         /// @{
         namespace action
@@ -42,6 +127,11 @@ namespace ranges
                         A::bind(std::forward<Ts>(ts)...)
                     )
                 };
+                template<typename Action>
+                static Action const &get(action<Action> const &act)
+                {
+                    return act.action_;
+                }
             };
 
             struct make_action_fn
@@ -66,6 +156,7 @@ namespace ranges
             private:
                 Action action_;
                 friend pipeable_access;
+                friend action_access;
                 template<typename Rng>
                 using ActionPipeConcept = meta::and_<
                     Function<Action, Rng>,
@@ -148,6 +148,17 @@ namespace ranges
             template<typename T, CONCEPT_REQUIRES_(Container<T>())>
 #endif
             std::true_type is_lvalue_container_like(std::reference_wrapper<T>);
+
+            // Reservable containers that say how much room they have.
+            template<typename Cont, typename Enable = void>
+            struct has_capacity
+              : std::false_type
+            {};
+
+            template<typename Cont>
+            struct has_capacity<Cont, meta::void_<decltype(std::declval<Cont const &>().capacity())>>
+              : Reservable<Cont>
+            {};
         }
         /// \endcond
 
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_ACTION_INSERT_HPP
 #define RANGES_V3_ACTION_INSERT_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <functional>
 #include <initializer_list>
@@ -107,6 +109,30 @@ namespace ranges
                         RandomAccessReservable<C>,
                         SizedIteratorRange<I, S>>;
 
+                // Makes room in cont for n more elements. A container that
+                // says how much room it has grows at least geometrically, as
+                // it would taking the elements one at a time, so that many
+                // short ranges inserted in turn cost a logarithmic number of
+                // reallocations rather than one each.
+                template<typename Cont>
+                void reserve_more(Cont &cont, std::size_t n, std::true_type)
+                {
+                    auto const need = static_cast<std::size_t>(cont.size()) + n;
+                    auto const have = static_cast<std::size_t>(cont.capacity());
+                    if(need > have)
+                        cont.reserve(std::max(need, 2 * have));
+                }
+                template<typename Cont>
+                void reserve_more(Cont &cont, std::size_t n, std::false_type)
+                {
+                    cont.reserve(static_cast<std::size_t>(cont.size()) + n);
+                }
+                template<typename Cont>
+                void reserve_more(Cont &cont, std::size_t n)
+                {
+                    detail::reserve_more(cont, n, ranges::detail::has_capacity<Cont>{});
+                }
+
                 template<typename Cont, typename P, typename I, typename S,
                     typename C = common_iterator<I, S>,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -133,11 +159,10 @@ namespace ranges
                     decltype(unwrap_reference(cont).insert(begin(unwrap_reference(cont)), C{i}, C{j}))
                 {
                     auto const index = p - unwrap_reference(cont).begin();
-                    unwrap_reference(cont).reserve(unwrap_reference(cont).size() + (j - i));
+                    detail::reserve_more(unwrap_reference(cont), static_cast<std::size_t>(j - i));
                     return unwrap_reference(cont).insert(begin(unwrap_reference(cont)) + index, C{i}, C{j});
                 }
 
-
                 template<typename Cont, typename I, typename Rng,
                     typename C = range_common_iterator_t<Rng>,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -164,7 +189,7 @@ namespace ranges
                     decltype(unwrap_reference(cont).insert(begin(unwrap_reference(cont)), C{begin(rng)}, C{end(rng)}))
                 {
                     auto const index = p - begin(unwrap_reference(cont));
-                    unwrap_reference(cont).reserve(unwrap_reference(cont).size() + size(rng));
+                    detail::reserve_more(unwrap_reference(cont), static_cast<std::size_t>(size(rng)));
                     return unwrap_reference(cont).insert(begin(unwrap_reference(cont)) + index, C{begin(rng)}, C{end(rng)});
                 }
             }
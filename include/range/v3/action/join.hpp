@@ -14,10 +14,13 @@
 #ifndef RANGES_V3_ACTION_JOIN_HPP
 #define RANGES_V3_ACTION_JOIN_HPP
 
+#include <cstddef>
 #include <vector>
 #include <functional>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -47,6 +50,29 @@ namespace ranges
 #endif
                         range_value_t<Rng>,
                         std::vector<range_value_t<range_value_t<Rng>>>>;
+
+                // When the inner ranges are sized and the outer one can be
+                // walked twice, the result reserves their total size up front
+                // and each inner range is then inserted into the room already
+                // made: one allocation, rather than one per doubling.
+                template<typename Rng>
+                using Presized = meta::and_<
+                    ForwardRange<Rng>,
+                    SizedRange<range_reference_t<Rng>>,
+                    Reservable<join_value_t<Rng>>>;
+
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &cont, Rng &rng, std::true_type)
+                {
+                    std::size_t n = 0;
+                    auto end = ranges::end(rng);
+                    for(auto it = begin(rng); it != end; ++it)
+                        n += static_cast<std::size_t>(ranges::size(*it));
+                    cont.reserve(n);
+                }
+                template<typename Cont, typename Rng>
+                static void reserve_(Cont &, Rng &, std::false_type)
+                {}
             public:
                 template<typename Rng>
                 using Concept = meta::and_<
@@ -63,6 +89,7 @@ namespace ranges
                 join_value_t<Rng> operator()(Rng && rng) const
                 {
                     join_value_t<Rng> ret;
+                    join_fn::reserve_(ret, rng, Presized<Rng>{});
                     auto end = ranges::end(rng);
                     for(auto it = begin(rng); it != end; ++it)
                         push_back(ret, *it);
@@ -0,0 +1,115 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_RADIX_SORT_HPP
+#define RANGES_V3_ACTION_RADIX_SORT_HPP
+
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-actions
+        /// @{
+        namespace action
+        {
+            struct radix_sort_fn
+            {
+            private:
+                friend action_access;
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                template<typename P, CONCEPT_REQUIRES_(!Range<P>::value)>
+#else
+                template<typename P, CONCEPT_REQUIRES_(!Range<P>())>
+#endif
+                static auto bind(radix_sort_fn radix_sort, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    detail::bind_action(radix_sort, std::move(proj))
+                )
+            public:
+                struct ConceptImpl
+                {
+                    template<typename Rng, typename P = ident,
+                        typename I = range_iterator_t<Rng>>
+                    auto requires_(Rng&&, P&& = P{}) -> decltype(
+                        concepts::valid_expr(
+                            concepts::model_of<concepts::RandomAccessRange, Rng>(),
+                            concepts::is_true(RadixSortable<I, P>())
+                        ));
+                };
+
+                template<typename Rng, typename P = ident>
+                using Concept = concepts::models<ConceptImpl, Rng, P>;
+
+                template<typename Rng, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rng, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rng, P>())>
+#endif
+                Rng operator()(Rng && rng, P proj = P{}) const
+                {
+                    ranges::radix_sort(rng, std::move(proj));
+                    return std::forward<Rng>(rng);
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rng, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rng, P>())>
+#endif
+                void operator()(Rng &&, P && = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessRange<Rng>(),
+                        "The object on which action::radix_sort operates must be a model of the "
+                        "RandomAccessRange concept.");
+                    using I = range_iterator_t<Rng>;
+                    CONCEPT_ASSERT_MSG(Projectable<I, P>(),
+                        "The projection function must accept objects of the iterator's value type, "
+                        "reference type, and rvalue reference type.");
+                    CONCEPT_ASSERT_MSG(Permutable<I>(),
+                        "The iterator type of the range passed to action::radix_sort must allow its "
+                        "elements to be permuted; that is, the values must be movable and the "
+                        "iterator must be mutable.");
+                    CONCEPT_ASSERT_MSG(detail::is_radix_sortable<I, P>(),
+                        "The key by which action::radix_sort sorts, which is the range's value type "
+                        "or what the projection function returns, must be an arithmetic type or a "
+                        "std::tuple or std::pair of arithmetic types.");
+                }
+            #endif
+            };
+
+            /// \ingroup group-actions
+            /// \relates radix_sort_fn
+            /// \sa `action`
+            namespace
+            {
+                constexpr auto&& radix_sort = static_const<action<radix_sort_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
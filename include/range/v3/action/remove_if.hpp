@@ -14,12 +14,14 @@
 #ifndef RANGES_V3_ACTION_REMOVE_IF_HPP
 #define RANGES_V3_ACTION_REMOVE_IF_HPP
 
+#include <tuple>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/erase.hpp>
+#include <range/v3/action/transform.hpp>
 #include <range/v3/algorithm/remove_if.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -45,8 +47,7 @@ namespace ranges
                 static auto bind(remove_if_fn remove_if, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(remove_if, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(remove_if, std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -116,6 +117,71 @@ namespace ranges
                 constexpr auto&& remove_if = static_const<action<remove_if_fn>>::value;
             }
         }
+
+        /// \cond
+        namespace detail
+        {
+            // action::remove_if followed by action::transform, with the
+            // arguments each was given, in one pass: each element that is
+            // kept is transformed as it is moved down, rather than moved down
+            // by one pass and transformed by a second.
+            template<typename RemoveArgs, typename TransformArgs>
+            struct remove_if_transform_fn
+            {
+                RemoveArgs remove_args;
+                TransformArgs transform_args;
+
+                template<typename Rng, typename I = range_iterator_t<Rng>,
+                    typename C = meta::_t<std::tuple_element<0, RemoveArgs>>,
+                    typename P = meta::_t<std::tuple_element<1, RemoveArgs>>,
+                    typename F = meta::_t<std::tuple_element<0, TransformArgs>>,
+                    typename Q = meta::_t<std::tuple_element<1, TransformArgs>>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(action::remove_if_fn::Concept<Rng, C, P>::value &&
+                        action::transform_fn::Concept<Rng, F, Q>::value)>
+#else
+                    CONCEPT_REQUIRES_(action::remove_if_fn::Concept<Rng, C, P>() &&
+                        action::transform_fn::Concept<Rng, F, Q>())>
+#endif
+                Rng operator()(Rng && rng) const
+                {
+                    auto &&pred = as_function(std::get<0>(remove_args));
+                    auto &&proj = as_function(std::get<1>(remove_args));
+                    auto &&fun = as_function(std::get<0>(transform_args));
+                    auto &&fun_proj = as_function(std::get<1>(transform_args));
+                    I out = begin(rng);
+                    auto const last = end(rng);
+                    for(I it = out; it != last; ++it)
+                    {
+                        if(!pred(proj(*it)))
+                        {
+                            *out = fun(fun_proj(*it));
+                            ++out;
+                        }
+                    }
+                    ranges::erase(rng, out, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+            };
+        }
+        /// \endcond
+
+        namespace action
+        {
+            /// Composes `action::remove_if` with an `action::transform` that
+            /// follows it into a single action that makes one pass over the
+            /// range, as in `v |= action::remove_if(pred) | action::transform(fun)`.
+            /// \relates remove_if_fn
+            template<typename A0, typename A1,
+                typename RemoveArgs = detail::bound_args_t<remove_if_fn, A0>,
+                typename TransformArgs = detail::bound_args_t<transform_fn, A1>>
+            action<detail::remove_if_transform_fn<RemoveArgs, TransformArgs>>
+            operator|(action<A0> const &first, action<A1> const &second)
+            {
+                return {{detail::bound_args<remove_if_fn, A0>::get(action_access::get(first)),
+                    detail::bound_args<transform_fn, A1>::get(action_access::get(second))}};
+            }
+        }
         /// @}
     }
 }
@@ -15,9 +15,16 @@
 #define RANGES_V3_ACTION_SORT_HPP
 
 #include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/action/unique.hpp>
+#include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -36,15 +43,28 @@ namespace ranges
             private:
                 friend action_access;
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                template<typename C, typename P = ident, CONCEPT_REQUIRES_(!Range<C>::value) >
+                template<typename C, typename P = ident,
+                    CONCEPT_REQUIRES_(!Range<C>::value && !ExecutionPolicy<C>::value)>
 #else
-                template<typename C, typename P = ident, CONCEPT_REQUIRES_(!Range<C>())>
+                template<typename C, typename P = ident,
+                    CONCEPT_REQUIRES_(!Range<C>() && !ExecutionPolicy<C>())>
 #endif
                 static auto bind(sort_fn sort, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(sort, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(sort, std::move(pred), std::move(proj))
+                )
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                template<typename E, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>::value)>
+#else
+                template<typename E, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+#endif
+                static auto bind(sort_fn sort, E policy, C pred = C{}, P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    detail::bind_action(sort, std::move(policy), std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -73,12 +93,29 @@ namespace ranges
                     return std::forward<Rng>(rng);
                 }
 
+                /// \overload
+                /// Sorts on the library's thread pool when `E` is a parallel
+                /// policy, as `ranges::sort(policy, rng, pred, proj)` does.
+                template<typename Rng, typename E, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                    CONCEPT_REQUIRES_(Concept<Rng, C, P>::value && RandomAccessRange<Rng>::value)>
+#else
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                    CONCEPT_REQUIRES_(Concept<Rng, C, P>() && RandomAccessRange<Rng>())>
+#endif
+                Rng operator()(Rng && rng, E policy, C pred = C{}, P proj = P{}) const
+                {
+                    ranges::sort(std::move(policy), rng, std::move(pred), std::move(proj));
+                    return std::forward<Rng>(rng);
+                }
+
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename C = ordered_less, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                    CONCEPT_REQUIRES_(!Concept<Rng, C, P>::value)>
+                    CONCEPT_REQUIRES_(!Concept<Rng, C, P>::value && !ExecutionPolicy<C>::value)>
 #else
-                    CONCEPT_REQUIRES_(!Concept<Rng, C, P>())>
+                    CONCEPT_REQUIRES_(!Concept<Rng, C, P>() && !ExecutionPolicy<C>())>
 #endif
                 void operator()(Rng &&, C && = C{}, P && = P{}) const
                 {
@@ -109,6 +146,129 @@ namespace ranges
                 constexpr auto&& sort = static_const<action<sort_fn>>::value;
             }
         }
+
+        /// \cond
+        namespace detail
+        {
+            // Removes all but the first of each run of equivalent elements of
+            // the sorted range [begin, end) on the thread pool. Each chunk is
+            // uniqued independently, dropping its first element if that
+            // repeats the last element of the chunk before it, and the chunks'
+            // survivors are then moved down together in one pass.
+            template<typename I, typename C, typename P>
+            I parallel_unique(I begin, I end, C const &pred_, P const &proj_)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = end - begin;
+                D const chunks = detail::parallel_chunk_count(n);
+                if(chunks <= 1)
+                    return ranges::unique(begin, end, pred_, proj_);
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                auto bound = [=](D k) { return n / chunks * k + (k < n % chunks ? k : n % chunks); };
+                // Read before any chunk is compacted and its first element
+                // overwritten by the chunk before it.
+                std::vector<char> repeats(static_cast<std::size_t>(chunks));
+                for(D k = 1; k < chunks; ++k)
+                    repeats[static_cast<std::size_t>(k)] =
+                        pred(proj(begin[bound(k) - 1]), proj(begin[bound(k)]));
+                std::vector<D> kept(static_cast<std::size_t>(chunks));
+                detail::parallel_for(chunks, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        kept[static_cast<std::size_t>(lo)] = ranges::unique(begin + bound(lo),
+                            begin + bound(lo + 1), pred_, proj_) - begin;
+                }, D(1));
+
+                I out = begin + kept[0];
+                for(D k = 1; k < chunks; ++k)
+                {
+                    I const first = begin + bound(k) + repeats[static_cast<std::size_t>(k)];
+                    I const last = begin + kept[static_cast<std::size_t>(k)];
+                    out = out == first ? last : ranges::move(first, last, out).out();
+                }
+                return out;
+            }
+
+            // The predicate and projection that action::unique was bound to.
+            inline equal_to unique_pred(std::tuple<> const &)
+            {
+                return {};
+            }
+            template<typename C, typename P>
+            C const &unique_pred(std::tuple<C, P> const &args)
+            {
+                return std::get<0>(args);
+            }
+            inline ident unique_proj(std::tuple<> const &)
+            {
+                return {};
+            }
+            template<typename C, typename P>
+            P const &unique_proj(std::tuple<C, P> const &args)
+            {
+                return std::get<1>(args);
+            }
+
+            // action::sort with a parallel policy followed by action::unique,
+            // with the arguments each was given. Once the range is sorted, the
+            // duplicates are removed on the thread pool too, rather than by
+            // a sequential pass over the whole range.
+            template<typename SortArgs, typename UniqueArgs>
+            struct sort_unique_fn
+            {
+                SortArgs sort_args;
+                UniqueArgs unique_args;
+
+                template<typename Rng, typename I = range_iterator_t<Rng>,
+                    typename = decltype(detail::apply_action(action::sort_fn{},
+                        std::declval<Rng &>(), std::declval<SortArgs const &>())),
+                    typename = decltype(detail::apply_action(action::unique_fn{},
+                        std::declval<Rng &>(), std::declval<UniqueArgs const &>()))>
+                Rng operator()(Rng && rng) const
+                {
+                    detail::apply_action(action::sort_fn{}, rng, sort_args);
+                    I it = detail::parallel_unique(begin(rng), end(rng),
+                        detail::unique_pred(unique_args), detail::unique_proj(unique_args));
+                    ranges::erase(rng, it, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            template<typename SortArgs>
+            struct sorts_in_parallel
+              : std::false_type
+            {};
+
+            template<typename E, typename C, typename P>
+            struct sorts_in_parallel<std::tuple<E, C, P>>
+              : is_parallel_policy<E>
+            {};
+        }
+        /// \endcond
+
+        namespace action
+        {
+            /// Composes `action::sort` given a parallel execution policy with an
+            /// `action::unique` that follows it into a single action that
+            /// removes the duplicates on the thread pool as well, as in
+            /// `v |= action::sort(execution::par) | action::unique`.
+            /// \relates sort_fn
+            template<typename A0, typename A1,
+                typename SortArgs = detail::bound_args_t<sort_fn, A0>,
+                typename UniqueArgs = detail::bound_args_t<unique_fn, A1>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::sorts_in_parallel<SortArgs>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::sorts_in_parallel<SortArgs>())>
+#endif
+            action<detail::sort_unique_fn<SortArgs, UniqueArgs>>
+            operator|(action<A0> const &first, action<A1> const &second)
+            {
+                return {{detail::bound_args<sort_fn, A0>::get(action_access::get(first)),
+                    detail::bound_args<unique_fn, A1>::get(action_access::get(second))}};
+            }
+        }
         /// @}
     }
 }
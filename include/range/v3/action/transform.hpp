@@ -43,8 +43,7 @@ namespace ranges
                 static auto bind(transform_fn transform, F fun, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(transform, std::placeholders::_1, protect(std::move(fun)),
-                        protect(std::move(proj)))
+                    detail::bind_action(transform, std::move(fun), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_ACTION_UNIQUE_HPP
 #define RANGES_V3_ACTION_UNIQUE_HPP
 
+#include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/action/action.hpp>
@@ -42,8 +43,7 @@ namespace ranges
                 static auto bind(unique_fn unique, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(unique, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(unique, std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -116,6 +116,7 @@ namespace ranges
                 constexpr auto&& unique = static_const<action<unique_fn>>::value;
             }
         }
+
         /// @}
     }
 }
@@ -50,7 +50,9 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/max.hpp>
 #include <range/v3/algorithm/max_element.hpp>
 #include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
 #include <range/v3/algorithm/merge_move.hpp>
+#include <range/v3/algorithm/merge_n_with_buffer.hpp>
 #include <range/v3/algorithm/min.hpp>
 #include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/algorithm/minmax.hpp>
@@ -67,6 +69,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/partition_move.hpp>
 #include <range/v3/algorithm/partition_point.hpp>
 #include <range/v3/algorithm/permutation.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
 #include <range/v3/algorithm/random_shuffle.hpp>
 #include <range/v3/algorithm/remove.hpp>
 #include <range/v3/algorithm/remove_copy.hpp>
@@ -80,17 +83,20 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/reverse_copy.hpp>
 #include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/rotate_copy.hpp>
+#include <range/v3/algorithm/sample.hpp>
 #include <range/v3/algorithm/search.hpp>
 #include <range/v3/algorithm/search_n.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include <range/v3/algorithm/swap_ranges.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/algorithm/unique.hpp>
 #include <range/v3/algorithm/unique_copy.hpp>
+#include <range/v3/algorithm/unordered_set_algorithm.hpp>
 #include <range/v3/algorithm/upper_bound.hpp>
 
 // BUGBUG
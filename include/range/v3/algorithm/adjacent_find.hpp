@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_ADJACENT_FIND_HPP
 #define RANGES_V3_ALGORITHM_ADJACENT_FIND_HPP
 
+#include <memory>
+#include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
@@ -20,6 +22,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/simd.hpp>
 
 namespace ranges
 {
@@ -29,6 +32,32 @@ namespace ranges
         /// @{
         struct adjacent_find_fn
         {
+        private:
+            template<typename I, typename S, typename C, typename P>
+            static I impl(I begin, S end, C &pred_, P &proj_, std::false_type)
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                if(begin == end)
+                    return begin;
+                auto next = begin;
+                for(; ++next != end; begin = next)
+                    if(pred(proj(*begin), proj(*next)))
+                        return begin;
+                return next;
+            }
+
+            template<typename I>
+            static I impl(I begin, I end, equal_to &, ident &, std::true_type)
+            {
+                if(begin == end)
+                    return begin;
+                auto const first = std::addressof(*begin);
+                return begin +
+                    (detail::simd::adjacent_find(first, first + (end - begin)) - first);
+            }
+
+        public:
             /// \brief function template \c adjacent_find_fn::operator()
             ///
             /// range-based version of the \c adjacent_find std algorithm
@@ -44,17 +73,10 @@ namespace ranges
                     IndirectCallableRelation<C, Project<I, P>>())>
 #endif
             I
-            operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            operator()(I begin, S end, C pred = C{}, P proj = P{}) const
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj = as_function(proj_);
-                if(begin == end)
-                    return begin;
-                auto next = begin;
-                for(; ++next != end; begin = next)
-                    if(pred(proj(*begin), proj(*next)))
-                        return begin;
-                return next;
+                return adjacent_find_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    detail::simd_adjacent_compare<I, S, C, P>{});
             }
 
             /// \overload
@@ -23,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/for_each_until.hpp>
 
 namespace ranges
 {
@@ -32,6 +33,31 @@ namespace ranges
         /// @{
         struct any_of_fn
         {
+        private:
+            // Stops the push at the first match.
+            template<typename F, typename P>
+            struct push_sink
+            {
+                F &pred;
+                P &proj;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return pred(proj(static_cast<T &&>(t)));
+                }
+            };
+            template<typename Rng, typename F, typename P>
+            bool whole(Rng &rng, F &pred, P &proj, std::true_type) const
+            {
+                push_sink<F, P> sink{pred, proj};
+                return detail::for_each_until(rng, sink);
+            }
+            template<typename Rng, typename F, typename P>
+            bool whole(Rng &rng, F &pred, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), pred, proj);
+            }
+        public:
             template<typename I, typename S, typename F, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value &&
@@ -59,9 +85,11 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputRange<Rng>() && IndirectCallablePredicate<F, Project<I, P> >())>
 #endif
             bool
-            operator()(Rng &&rng, F pred, P proj = P{}) const
+            operator()(Rng &&rng, F pred_, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                return this->whole(rng, pred, proj, detail::is_pushable<Rng>{});
             }
         };
 
@@ -0,0 +1,138 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_GALLOP_HPP
+#define RANGES_V3_ALGORITHM_AUX_GALLOP_HPP
+
+#include <functional>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/lower_bound_n.hpp>
+#include <range/v3/algorithm/aux_/upper_bound_n.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace aux
+        {
+            // Exponential search: probes begin[0], begin[2], begin[6], begin[14]...
+            // (begin[2^k - 2]) until it passes val, then binary searches the
+            // elements between that probe and the one before it. The cost is
+            // logarithmic in the distance to the answer rather than in d, so
+            // walking a long sorted range in short hops costs little more than
+            // walking it linearly, and a long hop costs little more than a
+            // binary search.
+            struct gallop_lower_bound_n_fn
+            {
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                        BinarySearchable<I, V2, C, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                        BinarySearchable<I, V2, C, P>())>
+#endif
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    auto &&pred = as_function(pred_);
+                    auto &&proj = as_function(proj_);
+                    iterator_difference_t<I> lo = 0, step = 1;
+                    while(step <= d - lo && pred(proj(begin[lo + step - 1]), val))
+                    {
+                        lo += step;
+                        step *= 2;
+                    }
+                    return lower_bound_n(begin + lo, step <= d - lo ? step - 1 : d - lo, val,
+                        pred, proj);
+                }
+            };
+
+            struct gallop_upper_bound_n_fn
+            {
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                        BinarySearchable<I, V2, C, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                        BinarySearchable<I, V2, C, P>())>
+#endif
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    auto &&pred = as_function(pred_);
+                    auto &&proj = as_function(proj_);
+                    iterator_difference_t<I> lo = 0, step = 1;
+                    while(step <= d - lo && !pred(val, proj(begin[lo + step - 1])))
+                    {
+                        lo += step;
+                        step *= 2;
+                    }
+                    return upper_bound_n(begin + lo, step <= d - lo ? step - 1 : d - lo, val,
+                        pred, proj);
+                }
+            };
+
+            namespace
+            {
+                constexpr auto&& gallop_lower_bound_n = static_const<gallop_lower_bound_n_fn>::value;
+                constexpr auto&& gallop_upper_bound_n = static_const<gallop_upper_bound_n_fn>::value;
+            }
+        }
+
+        /// \cond
+        namespace detail
+        {
+            // Set operations on sized random-access inputs, one much longer
+            // than the other, take this many steps at a time while both inputs
+            // have that many elements left, which spares them the checks for
+            // the inputs' ends. A block that skipped only elements of one input
+            // is likely the start of a long run of them, so they gallop over
+            // the rest of the run before the next block, much as TimSort does.
+            // Inputs of lengths m and n then cost O(m log(n/m)) comparisons
+            // rather than O(n + m). Runs that must be written out are not worth
+            // galloping over: the writes cost as much as the comparisons saved.
+            constexpr int gallop_block = 8;
+
+            // How many times longer than the other one input must be for
+            // galloping to pay. Below that, the runs of random inputs are too
+            // short to be worth searching, and stepping through them one
+            // element at a time, with branches that the longer input's runs
+            // make predictable, is faster than looking for them.
+            constexpr int gallop_skew = 64;
+
+            template<typename D0, typename D1>
+            bool skewed(D0 n0, D1 n1)
+            {
+                return n0 / gallop_skew >= n1 || n1 / gallop_skew >= n0;
+            }
+
+            // Whether two inputs are sized and random-access, as galloping
+            // needs.
+            template<typename I0, typename S0, typename I1, typename S1>
+            using can_gallop = meta::bool_<
+                RandomAccessIterator<I0>::value && SizedIteratorRange<I0, S0>::value &&
+                RandomAccessIterator<I1>::value && SizedIteratorRange<I1, S1>::value>;
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
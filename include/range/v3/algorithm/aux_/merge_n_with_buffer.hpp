@@ -28,14 +28,7 @@
 #ifndef RANGES_V3_ALGORITHM_AUX_MERGE_N_WITH_BUFFER_HPP
 #define RANGES_V3_ALGORITHM_AUX_MERGE_N_WITH_BUFFER_HPP
 
-#include <tuple>
-#include <range/v3/range_fwd.hpp>
-#include <range/v3/utility/functional.hpp>
-#include <range/v3/utility/iterator_concepts.hpp>
-#include <range/v3/utility/iterator_traits.hpp>
-#include <range/v3/algorithm/copy_n.hpp>
-#include <range/v3/algorithm/aux_/merge_n.hpp>
-#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/merge_n_with_buffer.hpp>
 
 namespace ranges
 {
@@ -43,38 +36,9 @@ namespace ranges
     {
         namespace aux
         {
-            struct merge_n_with_buffer_fn
-            {
-                template<typename I, typename B, typename C = ordered_less, typename P = ident,
-                    typename VI = iterator_common_reference_t<I>,
-                    typename VB = iterator_common_reference_t<B>,
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                    CONCEPT_REQUIRES_(
-                        Same<VI, VB>::value &&
-                        IndirectlyCopyable<I, B>::value &&
-                        Mergeable<B, I, I, C, P, P>::value
-                    )>
-#else
-                    CONCEPT_REQUIRES_(
-                        Same<VI, VB>() &&
-                        IndirectlyCopyable<I, B>() &&
-                        Mergeable<B, I, I, C, P, P>()
-                    )>
-#endif
-                I operator()(I begin0, iterator_difference_t<I> n0,
-                             I begin1, iterator_difference_t<I> n1,
-                             B buff, C r = C{}, P p = P{}) const
-                {
-                    copy_n(begin0, n0, buff);
-                    return std::get<2>(merge_n(buff, n0, begin1, n1, begin0, r));
-                }
-            };
-
-            namespace
-            {
-                constexpr auto&& merge_n_with_buffer = static_const<merge_n_with_buffer_fn>::value;
-            }
-
+            // Kept for code that used this before it was made public.
+            using v3::merge_n_with_buffer_fn;
+            using v3::merge_n_with_buffer;
         } // namespace aux
     } // namespace v3
 } // namespace ranges
@@ -28,14 +28,7 @@
 #ifndef RANGES_V3_ALGORITHM_AUX_SORT_N_WITH_BUFFER_HPP
 #define RANGES_V3_ALGORITHM_AUX_SORT_N_WITH_BUFFER_HPP
 
-#include <tuple>
-#include <range/v3/range_fwd.hpp>
-#include <range/v3/utility/iterator.hpp>
-#include <range/v3/utility/functional.hpp>
-#include <range/v3/utility/iterator_concepts.hpp>
-#include <range/v3/utility/iterator_traits.hpp>
-#include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
-#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/sort_n_with_buffer.hpp>
 
 namespace ranges
 {
@@ -43,40 +36,9 @@ namespace ranges
     {
         namespace aux
         {
-            struct sort_n_with_buffer_fn
-            {
-                template<typename I, typename B, typename C = ordered_less, typename P = ident,
-                    typename VI = iterator_common_reference_t<I>,
-                    typename VB = iterator_common_reference_t<B>,
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                    CONCEPT_REQUIRES_(
-                        Same<VI, VB>::value &&
-                        IndirectlyCopyable<I, B>::value &&
-                        Mergeable<B, I, I, C, P, P>::value
-                    )>
-#else
-                    CONCEPT_REQUIRES_(
-                        Same<VI, VB>() &&
-                        IndirectlyCopyable<I, B>() &&
-                        Mergeable<B, I, I, C, P, P>()
-                    )>
-#endif
-                I operator()(I begin, iterator_difference_t<I> n, B buff, C r = C{}, P p = P{}) const
-                {
-                    auto half = n / 2;
-                    if(0 == half)
-                        return next(begin, n);
-                    I m = (*this)(begin, half, buff, r);
-                          (*this)(m, n - half, buff, r);
-                    return merge_n_with_buffer(begin, half, m, n - half, buff, r, p);
-                }
-            };
-
-            namespace
-            {
-                constexpr auto&& sort_n_with_buffer = static_const<sort_n_with_buffer_fn>::value;
-            }
-
+            // Kept for code that used this before it was made public.
+            using v3::sort_n_with_buffer_fn;
+            using v3::sort_n_with_buffer;
         } // namespace aux
     } // namespace v3
 } // namespace ranges
@@ -26,6 +26,10 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/detail/bulk_read.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/for_each_index.hpp>
 
 namespace ranges
 {
@@ -35,6 +39,94 @@ namespace ranges
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, std::false_type)
+            {
+                for(; begin != end; ++begin, ++out)
+                    *out = *begin;
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, std::true_type)
+            {
+                begin = detail::bulk_read(std::move(begin), end,
+                    [&](iterator_value_t<I> &v) { *out = std::move(v); ++out; });
+                return {begin, out};
+            }
+            template<typename O>
+            struct segment_fn
+            {
+                O &out;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    auto res = copy_fn::segmented(std::move(begin), std::move(end),
+                        std::move(out), detail::is_segmented<L, LS>{});
+                    out = res.out();
+                    return res.in();
+                }
+            };
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            segmented(I begin, S end, O out, std::true_type)
+            {
+                segment_fn<O> seg{out};
+                begin = detail::for_each_segment(std::move(begin), end, seg);
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            segmented(I begin, S end, O out, std::false_type)
+            {
+                return copy_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    detail::is_bulk_readable<I, S>{});
+            }
+            template<typename O>
+            struct push_sink
+            {
+                O &out;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    *out = static_cast<T &&>(t);
+                    ++out;
+                    return false;
+                }
+            };
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            whole(Rng &rng, O out, std::true_type)
+            {
+                push_sink<O> sink{out};
+                detail::for_each_until(rng, sink);
+                return {end(rng), out};
+            }
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            whole(Rng &rng, O out, std::false_type)
+            {
+                return copy_fn::segmented(begin(rng), end(rng), std::move(out),
+                    detail::is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>{});
+            }
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            indexed(Rng &rng, O out, std::true_type)
+            {
+                push_sink<O> sink{out};
+                detail::for_each_index(rng, sink);
+                return {end(rng), out};
+            }
+            template<typename Rng, typename O>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            indexed(Rng &rng, O out, std::false_type)
+            {
+                return copy_fn::whole(rng, std::move(out),
+                    meta::bool_<detail::push_unsegmented<Rng>::value && BoundedRange<Rng>::value>{});
+            }
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O,
@@ -54,9 +146,8 @@ namespace ranges
             tagged_pair<tag::in(I), tag::out(O)>
             operator()(I begin, S end, O out) const
             {
-                for(; begin != end; ++begin, ++out)
-                    *out = *begin;
-                return {begin, out};
+                return copy_fn::segmented(std::move(begin), std::move(end), std::move(out),
+                    detail::is_segmented<I, S>{});
             }
 
             template<typename Rng, typename O,
@@ -77,7 +168,7 @@ namespace ranges
             tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
             operator()(Rng &&rng, O out) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out));
+                return copy_fn::indexed(rng, std::move(out), detail::index_bounded<Rng>{});
             }
         };
 
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COUNT_HPP
 #define RANGES_V3_ALGORITHM_COUNT_HPP
 
+#include <memory>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/simd.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,35 @@ namespace ranges
         /// @{
         struct count_fn
         {
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I> impl(I begin, S end, V const &val, P &proj_,
+                std::false_type)
+            {
+                auto &&proj = as_function(proj_);
+                iterator_difference_t<I> n = 0;
+                for(; begin != end; ++begin)
+                    if(proj(*begin) == val)
+                        ++n;
+                return n;
+            }
+
+            // As for find, an integer that doesn't survive conversion to the
+            // element type matches no element.
+            template<typename I, typename V>
+            static iterator_difference_t<I> impl(I begin, I end, V const &val, ident &,
+                std::true_type)
+            {
+                using T = detail::simd_element_t<I>;
+                T const t = static_cast<T>(val);
+                if(begin == end || !(t == val))
+                    return 0;
+                auto const first = std::addressof(*begin);
+                return static_cast<iterator_difference_t<I>>(
+                    detail::simd::count(first, first + (end - begin), t));
+            }
+
+        public:
             template<typename I, typename S, typename V, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value &&
@@ -40,14 +71,10 @@ namespace ranges
                     IndirectCallableRelation<equal_to, Project<I, P>, V const *>())>
 #endif
             iterator_difference_t<I>
-            operator()(I begin, S end, V const & val, P proj_ = P{}) const
+            operator()(I begin, S end, V const & val, P proj = P{}) const
             {
-                auto &&proj = as_function(proj_);
-                iterator_difference_t<I> n = 0;
-                for(; begin != end; ++begin)
-                    if(proj(*begin) == val)
-                        ++n;
-                return n;
+                return count_fn::impl(std::move(begin), std::move(end), val, proj,
+                    detail::simd_value_search<I, S, V, P>{});
             }
 
             template<typename Rng, typename V, typename P = ident,
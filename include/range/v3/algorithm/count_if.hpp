@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COUNT_IF_HPP
 #define RANGES_V3_ALGORITHM_COUNT_IF_HPP
 
+#include <atomic>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/for_each_until.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,37 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            template<typename D, typename R, typename P>
+            struct push_sink
+            {
+                D &n;
+                R &pred;
+                P &proj;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    if(pred(proj(static_cast<T &&>(t))))
+                        ++n;
+                    return false;
+                }
+            };
+            template<typename Rng, typename R, typename P>
+            iterator_difference_t<range_iterator_t<Rng>>
+            whole(Rng &rng, R &pred, P &proj, std::true_type) const
+            {
+                iterator_difference_t<range_iterator_t<Rng>> n = 0;
+                push_sink<iterator_difference_t<range_iterator_t<Rng>>, R, P> sink{n, pred, proj};
+                detail::for_each_until(rng, sink);
+                return n;
+            }
+            template<typename Rng, typename R, typename P>
+            iterator_difference_t<range_iterator_t<Rng>>
+            whole(Rng &rng, R &pred, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), pred, proj);
+            }
+        public:
             template<typename I, typename S, typename R, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value &&
@@ -59,9 +92,65 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputRange<Rng>() && IndirectCallablePredicate<R, Project<I, P> >())>
 #endif
             iterator_difference_t<I>
-            operator()(Rng &&rng, R pred, P proj = P{}) const
+            operator()(Rng &&rng, R pred_, P proj_ = P{}) const
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                return this->whole(rng, pred, proj, detail::is_pushable<Rng>{});
+            }
+
+            /// \overload
+            /// With a parallel policy, every chunk of the range is counted on the
+            /// library's thread pool and the partial counts are summed.
+            template<typename E, typename I, typename S, typename R, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value &&
+                    IndirectCallablePredicate<R, Project<I, P> >::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                    SizedIteratorRange<I, S>() &&
+                    IndirectCallablePredicate<R, Project<I, P> >())>
+#endif
+            iterator_difference_t<I>
+            operator()(E &&, I begin, S end, R pred_, P proj_ = P{}) const
+            {
+                if(!detail::is_parallel_policy<E>())
+                    return (*this)(begin, end, std::move(pred_), std::move(proj_));
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                std::atomic<iterator_difference_t<I>> total{0};
+                detail::parallel_for(iterator_difference_t<I>(end - begin),
+                    [&](iterator_difference_t<I> lo, iterator_difference_t<I> hi)
+                    {
+                        iterator_difference_t<I> n = 0;
+                        for(I i = begin + lo, e = begin + hi; i != e; ++i)
+                            if(pred(proj(*i)))
+                                ++n;
+                        total.fetch_add(n, std::memory_order_relaxed);
+                    });
+                return total.load();
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename R, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value &&
+                    SizedRange<Rng>::value && IndirectCallablePredicate<R, Project<I, P> >::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() &&
+                    SizedRange<Rng>() && IndirectCallablePredicate<R, Project<I, P> >())>
+#endif
+            iterator_difference_t<I>
+            operator()(E &&policy, Rng &&rng, R pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
             }
         };
 
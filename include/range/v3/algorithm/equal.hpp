@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_EQUAL_HPP
 #define RANGES_V3_ALGORITHM_EQUAL_HPP
 
+#include <memory>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -23,6 +24,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/simd.hpp>
 
 namespace ranges
 {
@@ -33,10 +35,37 @@ namespace ranges
         struct equal_fn
         {
         private:
+            template<typename I0, typename S0, typename I1,
+                typename C, typename P0, typename P1>
+            static bool prefix(I0 begin0, S0 end0, I1 begin1, C &pred_,
+                P0 &proj0_, P1 &proj1_, std::false_type)
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj0 = as_function(proj0_);
+                auto &&proj1 = as_function(proj1_);
+                for(; begin0 != end0; ++begin0, ++begin1)
+                    if(!pred(proj0(*begin0), proj1(*begin1)))
+                        return false;
+                return true;
+            }
+
+            // Integers have no padding bits and no two representations of a
+            // value, so equal integers are equal bytes.
+            template<typename I0, typename I1>
+            static bool prefix(I0 begin0, I0 end0, I1 begin1, equal_to &, ident &, ident &,
+                std::true_type)
+            {
+                if(begin0 == end0)
+                    return true;
+                auto const first0 = std::addressof(*begin0);
+                return detail::simd::equal(first0, first0 + (end0 - begin0),
+                    std::addressof(*begin1));
+            }
+
             template<typename I0, typename S0, typename I1, typename S1,
                 typename C, typename P0, typename P1>
             bool nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred_,
-                P0 proj0_, P1 proj1_) const
+                P0 proj0_, P1 proj1_, std::false_type) const
             {
                 auto &&pred = as_function(pred_);
                 auto &&proj0 = as_function(proj0_);
@@ -47,6 +76,16 @@ namespace ranges
                 return begin0 == end0 && begin1 == end1;
             }
 
+            template<typename I0, typename I1>
+            bool nocheck(I0 begin0, I0 end0, I1 begin1, I1 end1, equal_to pred,
+                ident proj0, ident proj1, std::true_type) const
+            {
+                if(end0 - begin0 != end1 - begin1)
+                    return false;
+                return equal_fn::prefix(std::move(begin0), std::move(end0), std::move(begin1),
+                    pred, proj0, proj1, std::true_type{});
+            }
+
         public:
             template<typename I0, typename S0, typename I1,
                 typename C = equal_to, typename P0 = ident, typename P1 = ident,
@@ -61,16 +100,11 @@ namespace ranges
                     WeaklyComparable<I0, I1, C, P0, P1>()
                 )>
 #endif
-            bool operator()(I0 begin0, S0 end0, I1 begin1, C pred_ = C{},
-                P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+            bool operator()(I0 begin0, S0 end0, I1 begin1, C pred = C{},
+                P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj0 = as_function(proj0_);
-                auto &&proj1 = as_function(proj1_);
-                for(; begin0 != end0; ++begin0, ++begin1)
-                    if(!pred(proj0(*begin0), proj1(*begin1)))
-                        return false;
-                return true;
+                return equal_fn::prefix(std::move(begin0), std::move(end0), std::move(begin1),
+                    pred, proj0, proj1, detail::simd_range_compare<I0, S0, I1, I1, C, P0, P1>{});
             }
 
             template<typename I0, typename S0, typename I1, typename S1,
@@ -93,7 +127,8 @@ namespace ranges
                     if(distance(begin0, end0) != distance(begin1, end1))
                         return false;
                 return this->nocheck(std::move(begin0), std::move(end0), std::move(begin1),
-                    std::move(end1), std::move(pred_), std::move(proj0_), std::move(proj1_));
+                    std::move(end1), std::move(pred_), std::move(proj0_), std::move(proj1_),
+                    detail::simd_range_compare<I0, S0, I1, S1, C, P0, P1>{});
             }
 
             template<typename Rng0, typename I1Ref,
@@ -140,7 +175,9 @@ namespace ranges
                     if(distance(rng0) != distance(rng1))
                         return false;
                 return this->nocheck(begin(rng0), end(rng0), begin(rng1), end(rng1),
-                    std::move(pred_), std::move(proj0_), std::move(proj1_));
+                    std::move(pred_), std::move(proj0_), std::move(proj1_),
+                    detail::simd_range_compare<I0, range_sentinel_t<Rng0>, I1,
+                        range_sentinel_t<Rng1>, C, P0, P1>{});
             }
         };
 
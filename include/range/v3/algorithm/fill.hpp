@@ -13,12 +13,14 @@
 #ifndef RANGES_V3_ALGORITHM_FILL_HPP
 #define RANGES_V3_ALGORITHM_FILL_HPP
 
+#include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/segmented.hpp>
 
 namespace ranges
 {
@@ -28,6 +30,32 @@ namespace ranges
         /// @{
         struct fill_fn
         {
+        private:
+            template<typename V>
+            struct segment_fn
+            {
+                V const &val;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    return fill_fn::impl(std::move(begin), std::move(end), val,
+                        detail::is_segmented<L, LS>{});
+                }
+            };
+            template<typename O, typename S, typename V>
+            static O impl(O begin, S end, V const &val, std::true_type)
+            {
+                segment_fn<V> seg{val};
+                return detail::for_each_segment(std::move(begin), end, seg);
+            }
+            template<typename O, typename S, typename V>
+            static O impl(O begin, S end, V const &val, std::false_type)
+            {
+                for(; begin != end; ++begin)
+                    *begin = val;
+                return begin;
+            }
+        public:
             template<typename O, typename S, typename V,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(OutputIterator<O, V>::value && IteratorRange<O, S>::value)>
@@ -36,9 +64,8 @@ namespace ranges
 #endif
             O operator()(O begin, S end, V const & val) const
             {
-                for(; begin != end; ++begin)
-                    *begin = val;
-                return begin;
+                return fill_fn::impl(std::move(begin), std::move(end), val,
+                    detail::is_segmented<O, S>{});
             }
 
             template<typename Rng, typename V,
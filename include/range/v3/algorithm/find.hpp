@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_HPP
 #define RANGES_V3_ALGORITHM_FIND_HPP
 
+#include <memory>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -22,6 +23,8 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/simd.hpp>
+#include <range/v3/detail/segmented.hpp>
 
 namespace ranges
 {
@@ -31,6 +34,60 @@ namespace ranges
         /// @{
         struct find_fn
         {
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static I impl(I begin, S end, V const &val, P &proj_, std::false_type)
+            {
+                auto &&proj = as_function(proj_);
+                for(; begin != end; ++begin)
+                    if(proj(*begin) == val)
+                        break;
+                return begin;
+            }
+
+            // Integers in contiguous storage are searched with memchr or a
+            // vector kernel. Only elements with the bits of val converted to
+            // their type can compare equal to val, and none can if that
+            // conversion changed its value.
+            template<typename I, typename V>
+            static I impl(I begin, I end, V const &val, ident &, std::true_type)
+            {
+                using T = detail::simd_element_t<I>;
+                T const t = static_cast<T>(val);
+                if(begin == end || !(t == val))
+                    return end;
+                auto const first = std::addressof(*begin);
+                return begin + (detail::simd::find(first, first + (end - begin), t) - first);
+            }
+
+            // In a flattened range each segment gets its own search, so
+            // segments in contiguous storage still take the vector path.
+            template<typename V, typename P>
+            struct segment_fn
+            {
+                V const &val;
+                P &proj;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    return find_fn::segmented(std::move(begin), std::move(end), val, proj,
+                        detail::is_segmented<L, LS>{});
+                }
+            };
+            template<typename I, typename S, typename V, typename P>
+            static I segmented(I begin, S end, V const &val, P &proj, std::true_type)
+            {
+                segment_fn<V, P> seg{val, proj};
+                return detail::for_each_segment(std::move(begin), end, seg);
+            }
+            template<typename I, typename S, typename V, typename P>
+            static I segmented(I begin, S end, V const &val, P &proj, std::false_type)
+            {
+                return find_fn::impl(std::move(begin), std::move(end), val, proj,
+                    detail::simd_value_search<I, S, V, P>{});
+            }
+
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -48,13 +105,10 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectCallableRelation<equal_to, Project<I, P>, V const *>())>
 #endif
-            I operator()(I begin, S end, V const &val, P proj_ = P{}) const
+            I operator()(I begin, S end, V const &val, P proj = P{}) const
             {
-                auto &&proj = as_function(proj_);
-                for(; begin != end; ++begin)
-                    if(proj(*begin) == val)
-                        break;
-                return begin;
+                return find_fn::segmented(std::move(begin), std::move(end), val, proj,
+                    detail::is_segmented<I, S>{});
             }
 
             /// \overload
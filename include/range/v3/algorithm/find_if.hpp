@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_IF_HPP
 #define RANGES_V3_ALGORITHM_FIND_IF_HPP
 
+#include <atomic>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -74,6 +75,74 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// With a parallel policy, chunks of the range are searched
+            /// concurrently. Chunks that lie entirely after a match found by
+            /// another thread are skipped, and the first match in the range is
+            /// returned.
+            template<typename E, typename I, typename S, typename F, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value &&
+                    IndirectCallablePredicate<F, Project<I, P> >::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                    SizedIteratorRange<I, S>() &&
+                    IndirectCallablePredicate<F, Project<I, P> >())>
+#endif
+            I operator()(E &&, I begin, S end, F pred_, P proj_ = P{}) const
+            {
+                if(!detail::is_parallel_policy<E>())
+                    return (*this)(begin, end, std::move(pred_), std::move(proj_));
+                using D = iterator_difference_t<I>;
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                D const n = end - begin;
+                std::atomic<D> found{n};
+                detail::parallel_for(n, [&](D lo, D hi)
+                {
+                    // Look for a match by another thread every so often.
+                    constexpr D stride = 1 << 10;
+                    while(lo != hi && lo < found.load(std::memory_order_relaxed))
+                    {
+                        D const stop = hi - lo > stride ? lo + stride : hi;
+                        for(; lo != stop; ++lo)
+                        {
+                            if(pred(proj(*(begin + lo))))
+                            {
+                                D prev = found.load(std::memory_order_relaxed);
+                                while(lo < prev && !found.compare_exchange_weak(prev, lo))
+                                    ;
+                                return;
+                            }
+                        }
+                    }
+                });
+                return begin + found.load();
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value &&
+                    SizedRange<Rng>::value &&
+                    IndirectCallablePredicate<F, Project<I, P>>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() &&
+                    SizedRange<Rng>() &&
+                    IndirectCallablePredicate<F, Project<I, P>>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, F pred, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `find_if_fn`
@@ -21,6 +21,10 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/bulk_read.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/for_each_index.hpp>
 
 namespace ranges
 {
@@ -30,6 +34,92 @@ namespace ranges
         /// @{
         struct for_each_fn
         {
+        private:
+            template<typename I, typename S, typename F, typename P>
+            static I impl(I begin, S end, F &fun, P &proj, std::false_type)
+            {
+                for(; begin != end; ++begin)
+                {
+                    fun(proj(*begin));
+                }
+                return begin;
+            }
+            template<typename I, typename S, typename F, typename P>
+            static I impl(I begin, S end, F &fun, P &proj, std::true_type)
+            {
+                return detail::bulk_read(std::move(begin), end,
+                    [&](iterator_value_t<I> &v) { fun(proj(std::move(v))); });
+            }
+            template<typename F, typename P>
+            struct segment_fn
+            {
+                F &fun;
+                P &proj;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    return for_each_fn::segmented(std::move(begin), std::move(end), fun, proj,
+                        detail::is_segmented<L, LS>{});
+                }
+            };
+            // Flattened ranges are walked one segment at a time, so the inner
+            // loop runs on the local iterators.
+            template<typename I, typename S, typename F, typename P>
+            static I segmented(I begin, S end, F &fun, P &proj, std::true_type)
+            {
+                segment_fn<F, P> seg{fun, proj};
+                return detail::for_each_segment(std::move(begin), end, seg);
+            }
+            template<typename I, typename S, typename F, typename P>
+            static I segmented(I begin, S end, F &fun, P &proj, std::false_type)
+            {
+                return for_each_fn::impl(std::move(begin), std::move(end), fun, proj,
+                    detail::is_bulk_readable<I, S>{});
+            }
+            template<typename F, typename P>
+            struct push_sink
+            {
+                F &fun;
+                P &proj;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    fun(proj(static_cast<T &&>(t)));
+                    return false;
+                }
+            };
+            // A whole range that can push its elements (see
+            // detail/for_each_until.hpp) is left to do so, provided its end is
+            // an iterator that can be returned.
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> whole(Rng &rng, F &fun, P &proj, std::true_type)
+            {
+                push_sink<F, P> sink{fun, proj};
+                detail::for_each_until(rng, sink);
+                return end(rng);
+            }
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> whole(Rng &rng, F &fun, P &proj, std::false_type)
+            {
+                return for_each_fn::segmented(begin(rng), end(rng), fun, proj,
+                    detail::is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>{});
+            }
+            // A zip of sized random-access ranges is walked with one index
+            // (see detail/for_each_index.hpp).
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> indexed(Rng &rng, F &fun, P &proj, std::true_type)
+            {
+                push_sink<F, P> sink{fun, proj};
+                detail::for_each_index(rng, sink);
+                return end(rng);
+            }
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> indexed(Rng &rng, F &fun, P &proj, std::false_type)
+            {
+                return for_each_fn::whole(rng, fun, proj,
+                    meta::bool_<detail::push_unsegmented<Rng>::value && BoundedRange<Rng>::value>{});
+            }
+        public:
             template<typename I, typename S, typename F, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(InputIterator<I>::value && IteratorRange<I, S>::value &&
@@ -42,11 +132,8 @@ namespace ranges
             {
                 auto &&fun = as_function(fun_);
                 auto &&proj = as_function(proj_);
-                for(; begin != end; ++begin)
-                {
-                    fun(proj(*begin));
-                }
-                return begin;
+                return for_each_fn::segmented(std::move(begin), std::move(end), fun, proj,
+                    detail::is_segmented<I, S>{});
             }
 
             template<typename Rng, typename F, typename P = ident,
@@ -56,9 +143,57 @@ namespace ranges
 #else
                 CONCEPT_REQUIRES_(InputRange<Rng>() && IndirectCallable<F, Project<I, P>>())>
 #endif
-            range_safe_iterator_t<Rng> operator()(Rng &&rng, F fun, P proj = P{}) const
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, F fun_, P proj_ = P{}) const
+            {
+                auto &&fun = as_function(fun_);
+                auto &&proj = as_function(proj_);
+                return for_each_fn::indexed(rng, fun, proj, detail::index_bounded<Rng>{});
+            }
+
+            /// \overload
+            /// With a parallel policy, `fun` is invoked concurrently on chunks
+            /// of the range from the library's thread pool.
+            template<typename E, typename I, typename S, typename F, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && IndirectCallable<F, Project<I, P>>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                    SizedIteratorRange<I, S>() && IndirectCallable<F, Project<I, P>>())>
+#endif
+            I operator()(E &&, I begin, S end, F fun_, P proj_ = P{}) const
+            {
+                if(!detail::is_parallel_policy<E>())
+                    return (*this)(begin, end, std::move(fun_), std::move(proj_));
+                auto &&fun = as_function(fun_);
+                auto &&proj = as_function(proj_);
+                iterator_difference_t<I> const n = end - begin;
+                detail::parallel_for(n, [&](iterator_difference_t<I> lo, iterator_difference_t<I> hi)
+                {
+                    for(I i = begin + lo, e = begin + hi; i != e; ++i)
+                        fun(proj(*i));
+                });
+                return begin + n;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value &&
+                    SizedRange<Rng>::value && IndirectCallable<F, Project<I, P>>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() &&
+                    SizedRange<Rng>() && IndirectCallable<F, Project<I, P>>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, F fun, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(fun), std::move(proj));
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(fun),
+                    std::move(proj));
             }
         };
 
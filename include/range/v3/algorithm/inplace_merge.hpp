@@ -206,6 +206,14 @@ namespace ranges
         /// @{
         struct inplace_merge_fn
         {
+            /// The number of objects a `scratch_buffer` must hold for the
+            /// overloads that take one to merge runs of `len1` and `len2`
+            /// elements without falling back to rotations.
+            static constexpr std::ptrdiff_t buffer_size(std::ptrdiff_t len1, std::ptrdiff_t len2)
+            {
+                return len1 < len2 ? len1 : len2;
+            }
+
             // TODO reimplement to only need forward iterators
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -245,6 +253,41 @@ namespace ranges
                 return (*this)(begin(rng), std::move(middle), end(rng), std::move(pred),
                     std::move(proj));
             }
+
+            /// \overload
+            /// Borrows `buf` instead of allocating a temporary buffer.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(BidirectionalIterator<I>::value && Sortable<I, C, P>::value)>
+#else
+                CONCEPT_REQUIRES_(BidirectionalIterator<I>() && Sortable<I, C, P>())>
+#endif
+            I operator()(I begin, I middle, S end, scratch_buffer<iterator_value_t<I>> &buf,
+                C pred = C{}, P proj = P{}) const
+            {
+                auto len1 = distance(begin, middle);
+                auto len2_and_end = enumerate(middle, end);
+                detail::merge_adaptive(std::move(begin), std::move(middle), len2_and_end.second,
+                    len1, len2_and_end.first, buf.data(), buf.capacity(), std::move(pred),
+                    std::move(proj));
+                return len2_and_end.second;
+            }
+
+            /// \overload
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(BidirectionalRange<Rng>::value && Sortable<I, C, P>::value)>
+#else
+                CONCEPT_REQUIRES_(BidirectionalRange<Rng>() && Sortable<I, C, P>())>
+#endif
+            range_safe_iterator_t<Rng>
+            operator()(Rng &&rng, I middle, scratch_buffer<iterator_value_t<I>> &buf,
+                C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), std::move(middle), end(rng), buf, std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `inplace_merge_fn`
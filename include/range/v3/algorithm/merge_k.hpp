@@ -0,0 +1,174 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_MERGE_K_HPP
+#define RANGES_V3_ALGORITHM_MERGE_K_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-concepts
+        /// @{
+        template<typename Rngs, typename O, typename C = ordered_less, typename P = ident,
+            typename Rng = range_reference_t<Rngs>>
+        using MergeableRanges = meta::fast_and<
+            ForwardRange<Rngs>,
+            std::is_lvalue_reference<Rng>,
+            InputRange<Rng>,
+            Mergeable<range_iterator_t<Rng>, range_iterator_t<Rng>, O, C, P, P>>;
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // The next element of each of k sorted ranges, in a binary heap
+            // ordered by those elements and, among equal ones, by the order of
+            // the ranges, so that taking from the top merges them stably. Each
+            // element taken costs a sift down, about 2 log k comparisons.
+            template<typename I, typename S>
+            struct merge_k_heap
+            {
+            private:
+                struct head
+                {
+                    I it;
+                    S end;
+                    std::size_t index;
+                };
+                std::vector<head> heap_;
+
+                template<typename C, typename P>
+                static bool before(head const &a, head const &b, C &pred, P &proj)
+                {
+                    return pred(proj(*a.it), proj(*b.it)) ||
+                        (a.index < b.index && !pred(proj(*b.it), proj(*a.it)));
+                }
+                template<typename C, typename P>
+                void sift_down(std::size_t i, C &pred, P &proj)
+                {
+                    std::size_t const n = heap_.size();
+                    head h = std::move(heap_[i]);
+                    for(std::size_t c; (c = 2 * i + 1) < n; i = c)
+                    {
+                        if(c + 1 < n && before(heap_[c + 1], heap_[c], pred, proj))
+                            ++c;
+                        if(!before(heap_[c], h, pred, proj))
+                            break;
+                        heap_[i] = std::move(heap_[c]);
+                    }
+                    heap_[i] = std::move(h);
+                }
+            public:
+                merge_k_heap() = default;
+                template<typename Rngs, typename C, typename P>
+                merge_k_heap(Rngs &rngs, C &pred, P &proj)
+                {
+                    std::size_t index = 0;
+                    for(auto i = ranges::begin(rngs), e = ranges::end(rngs); i != e; ++i, ++index)
+                    {
+                        auto &&rng = *i;
+                        I b = ranges::begin(rng);
+                        S s = ranges::end(rng);
+                        if(b != s)
+                            heap_.push_back(head{std::move(b), std::move(s), index});
+                    }
+                    for(std::size_t i = heap_.size() / 2; i-- != 0;)
+                        sift_down(i, pred, proj);
+                }
+                bool empty() const
+                {
+                    return heap_.empty();
+                }
+                // The position of the least element.
+                I const &front() const
+                {
+                    RANGES_ASSERT(!empty());
+                    return heap_.front().it;
+                }
+                // Moves past the least element.
+                template<typename C, typename P>
+                void next(C &pred, P &proj)
+                {
+                    RANGES_ASSERT(!empty());
+                    head &top = heap_.front();
+                    if(++top.it == top.end)
+                    {
+                        if(heap_.size() != 1)
+                            top = std::move(heap_.back());
+                        heap_.pop_back();
+                        if(heap_.empty())
+                            return;
+                    }
+                    sift_down(0, pred, proj);
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Merges any number of sorted ranges, given as a range of them, into
+        /// `out`. Equal elements keep the order of the ranges they come from, as
+        /// with `merge`, and each element costs O(log k) comparisons for k
+        /// ranges rather than the O(k) of merging them pairwise in turn.
+        struct merge_k_fn
+        {
+            template<typename Rngs, typename O, typename C = ordered_less, typename P = ident,
+                typename Rng = range_reference_t<Rngs &>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(MergeableRanges<Rngs &, O, C, P>::value)>
+#else
+                CONCEPT_REQUIRES_(MergeableRanges<Rngs &, O, C, P>())>
+#endif
+            O operator()(Rngs &&rngs, O out, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                detail::merge_k_heap<range_iterator_t<Rng>, range_sentinel_t<Rng>> heap{rngs,
+                    pred, proj};
+                for(; !heap.empty(); ++out)
+                {
+                    *out = *heap.front();
+                    heap.next(pred, proj);
+                }
+                return out;
+            }
+        };
+
+        /// \sa `merge_k_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& merge_k = static_const<with_braced_init_args<merge_k_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
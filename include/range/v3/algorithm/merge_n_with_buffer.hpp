@@ -0,0 +1,90 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+// Copyright (c) 2009 Alexander Stepanov and Paul McJones
+//
+// Permission to use, copy, modify, distribute and sell this software
+// and its documentation for any purpose is hereby granted without
+// fee, provided that the above copyright notice appear in all copies
+// and that both that copyright notice and this permission notice
+// appear in supporting documentation. The authors make no
+// representations about the suitability of this software for any
+// purpose. It is provided "as is" without express or implied
+// warranty.
+//
+// Algorithms from
+// Elements of Programming
+// by Alexander Stepanov and Paul McJones
+// Addison-Wesley Professional, 2009
+#ifndef RANGES_V3_ALGORITHM_MERGE_N_WITH_BUFFER_HPP
+#define RANGES_V3_ALGORITHM_MERGE_N_WITH_BUFFER_HPP
+
+#include <tuple>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/copy_n.hpp>
+#include <range/v3/algorithm/aux_/merge_n.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Merges the sorted ranges `[begin0, begin0 + n0)` and
+        /// `[begin1, begin1 + n1)`, which must be adjacent, in place. The first
+        /// range is copied into `buff`, which must have room for `n0` elements,
+        /// and merged back from there; nothing is allocated. The merge is
+        /// stable. Returns the end of the merged range.
+        struct merge_n_with_buffer_fn
+        {
+            template<typename I, typename B, typename C = ordered_less, typename P = ident,
+                typename VI = iterator_common_reference_t<I>,
+                typename VB = iterator_common_reference_t<B>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(
+                    Same<VI, VB>::value &&
+                    IndirectlyCopyable<I, B>::value &&
+                    Mergeable<B, I, I, C, P, P>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(
+                    Same<VI, VB>() &&
+                    IndirectlyCopyable<I, B>() &&
+                    Mergeable<B, I, I, C, P, P>()
+                )>
+#endif
+            I operator()(I begin0, iterator_difference_t<I> n0,
+                         I begin1, iterator_difference_t<I> n1,
+                         B buff, C r = C{}, P p = P{}) const
+            {
+                copy_n(begin0, n0, buff);
+                return std::get<2>(aux::merge_n(buff, n0, begin1, n1, begin0, r, p, p));
+            }
+        };
+
+        /// \sa `merge_n_with_buffer_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& merge_n_with_buffer = static_const<merge_n_with_buffer_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_MISMATCH_HPP
 #define RANGES_V3_ALGORITHM_MISMATCH_HPP
 
+#include <memory>
 #include <utility>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
@@ -25,6 +26,7 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/detail/simd.hpp>
 
 namespace ranges
 {
@@ -53,6 +55,61 @@ namespace ranges
         /// @{
         struct mismatch_fn
         {
+        private:
+            template<typename I1, typename S1, typename I2, typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, S1 end1, I2 begin2, C &pred_, P1 &proj1_, P2 &proj2_,
+                std::false_type)
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                for(; begin1 != end1; ++begin1, ++begin2)
+                    if(!pred(proj1(*begin1), proj2(*begin2)))
+                        break;
+                return {begin1, begin2};
+            }
+
+            template<typename I1, typename I2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, I1 end1, I2 begin2, equal_to &, ident &, ident &, std::true_type)
+            {
+                if(begin1 == end1)
+                    return {begin1, begin2};
+                auto const first1 = std::addressof(*begin1);
+                auto const n = detail::simd::mismatch(first1, first1 + (end1 - begin1),
+                    std::addressof(*begin2)) - first1;
+                return {begin1 + n, begin2 + n};
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred_, P1 &proj1_, P2 &proj2_,
+                std::false_type)
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                for(; begin1 != end1 &&  begin2 != end2; ++begin1, ++begin2)
+                    if(!pred(proj1(*begin1), proj2(*begin2)))
+                        break;
+                return {begin1, begin2};
+            }
+
+            // Only the shorter of the two ranges is searched.
+            template<typename I1, typename I2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(I1 begin1, I1 end1, I2 begin2, I2 end2, equal_to &pred, ident &proj1,
+                ident &proj2, std::true_type)
+            {
+                if(end2 - begin2 < end1 - begin1)
+                    end1 = begin1 + (end2 - begin2);
+                return mismatch_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    pred, proj1, proj2, std::true_type{});
+            }
+
+        public:
             template<typename I1, typename S1, typename I2, typename C = equal_to,
                 typename P1 = ident, typename P2 = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -61,16 +118,11 @@ namespace ranges
                 CONCEPT_REQUIRES_(Mismatchable1<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>())>
 #endif
             tagged_pair<tag::in1(I1), tag::in2(I2)>
-            operator()(I1 begin1, S1 end1, I2 begin2, C pred_ = C{}, P1 proj1_ = P1{},
-                P2 proj2_ = P2{}) const
+            operator()(I1 begin1, S1 end1, I2 begin2, C pred = C{}, P1 proj1 = P1{},
+                P2 proj2 = P2{}) const
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj1 = as_function(proj1_);
-                auto &&proj2 = as_function(proj2_);
-                for(; begin1 != end1; ++begin1, ++begin2)
-                    if(!pred(proj1(*begin1), proj2(*begin2)))
-                        break;
-                return {begin1, begin2};
+                return mismatch_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    pred, proj1, proj2, detail::simd_range_compare<I1, S1, I2, I2, C, P1, P2>{});
             }
 
             template<typename I1, typename S1, typename I2, typename S2, typename C = equal_to,
@@ -83,16 +135,12 @@ namespace ranges
                     IteratorRange<I2, S2>())>
 #endif
             tagged_pair<tag::in1(I1), tag::in2(I2)>
-            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred_ = C{}, P1 proj1_ = P1{},
-                P2 proj2_ = P2{}) const
+            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred = C{}, P1 proj1 = P1{},
+                P2 proj2 = P2{}) const
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj1 = as_function(proj1_);
-                auto &&proj2 = as_function(proj2_);
-                for(; begin1 != end1 &&  begin2 != end2; ++begin1, ++begin2)
-                    if(!pred(proj1(*begin1), proj2(*begin2)))
-                        break;
-                return {begin1, begin2};
+                return mismatch_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), pred, proj1, proj2,
+                    detail::simd_range_compare<I1, S1, I2, S2, C, P1, P2>{});
             }
 
             template<typename Rng1, typename I2Ref, typename C = equal_to, typename P1 = ident,
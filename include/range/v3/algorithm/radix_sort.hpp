@@ -0,0 +1,400 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+#define RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // radix_key<K> maps a key to a sequence of `size` bytes, least
+            // significant first, whose unsigned lexicographic order is the
+            // order of the keys, and less() compares keys in that order. Keys
+            // without a specialization can't be radix sorted.
+            template<typename K, typename Enable = void>
+            struct radix_key
+            {};
+
+            template<typename K>
+            struct radix_key<K, meta::if_c<std::is_integral<K>::value && std::is_unsigned<K>::value>>
+            {
+                static constexpr std::size_t size = sizeof(K);
+                static unsigned char digit(K k, std::size_t i)
+                {
+                    return static_cast<unsigned char>(k >> (i * 8));
+                }
+                static bool less(K a, K b)
+                {
+                    return a < b;
+                }
+            };
+
+            template<typename K>
+            struct radix_key<K, meta::if_c<std::is_integral<K>::value && std::is_signed<K>::value>>
+            {
+                static constexpr std::size_t size = sizeof(K);
+                static unsigned char digit(K k, std::size_t i)
+                {
+                    using U = meta::_t<std::make_unsigned<K>>;
+                    U const u = static_cast<U>(static_cast<U>(k) ^ (U(1) << (sizeof(K) * 8 - 1)));
+                    return static_cast<unsigned char>(u >> (i * 8));
+                }
+                static bool less(K a, K b)
+                {
+                    return a < b;
+                }
+            };
+
+            // Non-negative numbers sort above negative ones, and the order of
+            // negative numbers is that of their magnitudes, reversed. That is a
+            // total order: -0.0 sorts before +0.0, and NaNs sort before or
+            // after everything else, depending on their sign.
+            template<typename K>
+            struct radix_key<K, meta::if_c<std::is_floating_point<K>::value &&
+                std::numeric_limits<K>::is_iec559 && (sizeof(K) == 4 || sizeof(K) == 8)>>
+            {
+            private:
+                using U = meta::if_c<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+                static U bits(K k)
+                {
+                    U u;
+                    std::memcpy(&u, &k, sizeof(K));
+                    U const sign = U(1) << (sizeof(K) * 8 - 1);
+                    return (u & sign) ? static_cast<U>(~u) : static_cast<U>(u | sign);
+                }
+            public:
+                static constexpr std::size_t size = sizeof(K);
+                static unsigned char digit(K k, std::size_t i)
+                {
+                    return static_cast<unsigned char>(bits(k) >> (i * 8));
+                }
+                static bool less(K a, K b)
+                {
+                    return bits(a) < bits(b);
+                }
+            };
+
+            constexpr std::size_t radix_size_sum()
+            {
+                return 0;
+            }
+
+            template<typename... Ns>
+            constexpr std::size_t radix_size_sum(std::size_t n, Ns... ns)
+            {
+                return n + detail::radix_size_sum(ns...);
+            }
+
+            // Tuples and pairs compare lexicographically, so their last element
+            // holds the least significant bytes.
+            template<typename Tup, std::size_t N = std::tuple_size<Tup>::value>
+            struct radix_tuple_digit
+            {
+                static unsigned char get(Tup const &t, std::size_t i)
+                {
+                    using E = uncvref_t<meta::_t<std::tuple_element<N - 1, Tup>>>;
+                    return i < radix_key<E>::size ?
+                        radix_key<E>::digit(std::get<N - 1>(t), i) :
+                        radix_tuple_digit<Tup, N - 1>::get(t, i - radix_key<E>::size);
+                }
+            };
+
+            template<typename Tup>
+            struct radix_tuple_digit<Tup, 0>
+            {
+                static unsigned char get(Tup const &, std::size_t)
+                {
+                    return 0;
+                }
+            };
+
+            template<typename Tup, std::size_t I = 0,
+                bool Done = I == std::tuple_size<Tup>::value>
+            struct radix_tuple_less
+            {
+                static bool get(Tup const &a, Tup const &b)
+                {
+                    using E = uncvref_t<meta::_t<std::tuple_element<I, Tup>>>;
+                    return radix_key<E>::less(std::get<I>(a), std::get<I>(b)) ||
+                        (!radix_key<E>::less(std::get<I>(b), std::get<I>(a)) &&
+                            radix_tuple_less<Tup, I + 1>::get(a, b));
+                }
+            };
+
+            template<typename Tup, std::size_t I>
+            struct radix_tuple_less<Tup, I, true>
+            {
+                static bool get(Tup const &, Tup const &)
+                {
+                    return false;
+                }
+            };
+
+            template<typename... Ts>
+            struct radix_key<std::tuple<Ts...>,
+                meta::void_<decltype(radix_key<uncvref_t<Ts>>::size)...>>
+            {
+                static constexpr std::size_t size =
+                    detail::radix_size_sum(radix_key<uncvref_t<Ts>>::size...);
+                static unsigned char digit(std::tuple<Ts...> const &k, std::size_t i)
+                {
+                    return radix_tuple_digit<std::tuple<Ts...>>::get(k, i);
+                }
+                static bool less(std::tuple<Ts...> const &a, std::tuple<Ts...> const &b)
+                {
+                    return radix_tuple_less<std::tuple<Ts...>>::get(a, b);
+                }
+            };
+
+            template<typename T, typename U>
+            struct radix_key<std::pair<T, U>,
+                meta::void_<decltype(radix_key<uncvref_t<T>>::size),
+                    decltype(radix_key<uncvref_t<U>>::size)>>
+            {
+                static constexpr std::size_t size =
+                    radix_key<uncvref_t<T>>::size + radix_key<uncvref_t<U>>::size;
+                static unsigned char digit(std::pair<T, U> const &k, std::size_t i)
+                {
+                    return radix_tuple_digit<std::pair<T, U>>::get(k, i);
+                }
+                static bool less(std::pair<T, U> const &a, std::pair<T, U> const &b)
+                {
+                    return radix_tuple_less<std::pair<T, U>>::get(a, b);
+                }
+            };
+
+            // Compares keys in the order the radix sort gives them.
+            template<typename K>
+            struct radix_less
+            {
+                bool operator()(K const &a, K const &b) const
+                {
+                    return radix_key<K>::less(a, b);
+                }
+            };
+
+            template<typename I, typename P, typename Enable = void>
+            struct radix_projected_key
+            {};
+
+            template<typename I, typename P>
+            struct radix_projected_key<I, P,
+                meta::void_<concepts::Callable::result_t<P, iterator_reference_t<I>>>>
+            {
+                using type = uncvref_t<concepts::Callable::result_t<P, iterator_reference_t<I>>>;
+            };
+
+            template<typename I, typename P, typename Enable = void>
+            struct is_radix_sortable
+              : std::false_type
+            {};
+
+            template<typename I, typename P>
+            struct is_radix_sortable<I, P,
+                meta::void_<decltype(radix_key<meta::_t<radix_projected_key<I, P>>>::size)>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
+        /// \addtogroup group-concepts
+        /// @{
+        template<typename I, typename P = ident>
+        using RadixSortable = meta::fast_and<
+            RandomAccessIterator<I>,
+            Sortable<I, ordered_less, P>,
+            detail::is_radix_sortable<I, P>>;
+        /// @}
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Sorts by the key `proj` extracts from each element, which must be an
+        /// arithmetic type, or a `std::tuple` or `std::pair` of them, into the
+        /// order `ordered_less` gives the keys. Floating-point keys are put in a
+        /// total order that refines it: -0.0 before +0.0, and NaNs with the
+        /// sign bit set before everything else and the others after. Long
+        /// ranges are sorted by an LSD radix sort that scatters the elements,
+        /// one byte of the key at a time, between the range and a temporary
+        /// buffer; bytes that are the same in every key are skipped. Short
+        /// ranges, and ranges for which no buffer could be allocated, are
+        /// sorted with `sort` in the same order, so the order of elements with
+        /// equal keys is unspecified.
+        struct radix_sort_fn
+        {
+        private:
+            static constexpr std::ptrdiff_t radix_sort_threshold() { return 1 << 10; }
+
+            template<typename V, typename T>
+            static void put(V *p, T &&t, std::true_type)
+            {
+                ::new(static_cast<void *>(p)) V(static_cast<T &&>(t));
+            }
+            template<typename O, typename T>
+            static void put(O p, T &&t, std::false_type)
+            {
+                *p = static_cast<T &&>(t);
+            }
+
+            // Moves the n elements at src to dst + offsets[digit], ordered by
+            // the d-th byte of their keys; with Construct, dst is raw storage.
+            template<typename K, typename I, typename O, typename D, typename P, typename Construct>
+            static void scatter(I src, D n, O dst, D *offsets, std::size_t d, P &proj,
+                Construct construct)
+            {
+                for(D i = 0; i < n; ++i, ++src)
+                {
+                    unsigned char const b = detail::radix_key<K>::digit(proj(*src), d);
+                    radix_sort_fn::put(dst + offsets[b]++, iter_move(src), construct);
+                }
+            }
+
+        public:
+            template<typename I, typename S, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(RadixSortable<I, P>::value && IteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && IteratorRange<I, S>())>
+#endif
+            I operator()(I begin, S end_, P proj_ = P{}) const
+            {
+                auto &&proj = as_function(proj_);
+                I end = ranges::next(begin, end_);
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                using K = meta::_t<detail::radix_projected_key<I, P>>;
+                D const n = end - begin;
+                auto buf = n >= radix_sort_fn::radix_sort_threshold() ?
+                    std::get_temporary_buffer<V>(n) : detail::value_init{};
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                if(buf.first == nullptr || D(buf.second) < n)
+                {
+                    sort(begin, end, detail::radix_less<K>{}, std::ref(proj));
+                    return end;
+                }
+
+                // Count the occurrences of every byte value at every position.
+                std::size_t const digits = detail::radix_key<K>::size;
+                std::vector<D> counts(digits * 256);
+                {
+                    I it = begin;
+                    for(D i = 0; i < n; ++i, ++it)
+                    {
+                        auto &&key = proj(*it);
+                        for(std::size_t d = 0; d < digits; ++d)
+                            ++counts[d * 256 + detail::radix_key<K>::digit(key, d)];
+                    }
+                }
+
+                // Elements that are trivially destructible and can't throw while
+                // moving are moved straight into the raw buffer by the first
+                // pass; anything else is moved into it up front, so that the
+                // buffer is always fully constructed when it must be destroyed.
+                std::unique_ptr<V, detail::destroy_n<V>> live{buf.first, {}};
+                using construct_in_place = meta::bool_<
+                    std::is_trivially_destructible<V>::value &&
+                    std::is_nothrow_move_constructible<V>::value>;
+                bool constructed = false, in_buffer = false;
+                if(!construct_in_place())
+                {
+                    ranges::move(begin, end,
+                        ranges::make_counted_raw_storage_iterator(buf.first, live.get_deleter()));
+                    constructed = in_buffer = true;
+                }
+
+                for(std::size_t d = 0; d < digits; ++d)
+                {
+                    D *const offsets = &counts[d * 256];
+                    bool skip = false;
+                    D sum = 0;
+                    for(std::size_t b = 0; b < 256; ++b)
+                    {
+                        D const c = offsets[b];
+                        skip = skip || c == n;
+                        offsets[b] = sum;
+                        sum += c;
+                    }
+                    if(skip)
+                        continue;
+                    if(in_buffer)
+                        radix_sort_fn::scatter<K>(buf.first, n, begin, offsets, d, proj,
+                            std::false_type{});
+                    else if(constructed)
+                        radix_sort_fn::scatter<K>(begin, n, buf.first, offsets, d, proj,
+                            std::false_type{});
+                    else
+                    {
+                        radix_sort_fn::scatter<K>(begin, n, buf.first, offsets, d, proj,
+                            construct_in_place{});
+                        constructed = true;
+                    }
+                    in_buffer = !in_buffer;
+                }
+                if(in_buffer)
+                    ranges::move(buf.first, buf.first + n, begin);
+                return end;
+            }
+
+            template<typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(RadixSortable<I, P>::value && RandomAccessRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && RandomAccessRange<Rng>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(proj));
+            }
+        };
+
+        /// \sa `radix_sort_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& radix_sort = static_const<with_braced_init_args<radix_sort_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,200 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
+#define RANGES_V3_ALGORITHM_SAMPLE_HPP
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/tagspec.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether sample can walk [I, S) knowing its length: it either says
+            // how long it is, or can be walked twice to count it.
+            template<typename I, typename S>
+            using SampleKnowsSize = meta::or_<ForwardIterator<I>, SizedIteratorRange<I, S>>;
+
+            template<typename I, typename S, typename O, typename Gen>
+            using SampleConcept = meta::and_<
+                InputIterator<I>,
+                IteratorRange<I, S>,
+                WeaklyIncrementable<O>,
+                IndirectlyCopyable<I, O>,
+                UniformRandomNumberGenerator<Gen>,
+                meta::or_<SampleKnowsSize<I, S>, RandomAccessIterator<O>>>;
+
+            // A uniform double in (0, 1].
+            template<typename Gen>
+            double unit_interval(Gen &gen)
+            {
+                std::uniform_real_distribution<double> dist;
+                return 1.0 - dist(gen);
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+        struct sample_fn
+        {
+        private:
+            // Selection sampling (Knuth's Algorithm S): each element is taken
+            // with probability (still wanted) / (still left). One pass, and
+            // the sample keeps the order of the input.
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            select(I begin, S end, iterator_difference_t<I> size, O out,
+                iterator_difference_t<I> n, Gen &gen)
+            {
+                using D = iterator_difference_t<I>;
+                using param_t = typename std::uniform_int_distribution<D>::param_type;
+                std::uniform_int_distribution<D> uid;
+                for(; n > 0 && size > 0; ++begin, --size)
+                {
+                    if(uid(gen, param_t{0, size - 1}) < n)
+                    {
+                        *out = *begin;
+                        ++out;
+                        --n;
+                    }
+                }
+                return {ranges::next(std::move(begin), std::move(end)), std::move(out)};
+            }
+
+            // Reservoir sampling for input ranges of unknown length, with the
+            // gaps between replacements drawn from their distribution (Li's
+            // Algorithm L) rather than a random number drawn per element: the
+            // cost past the first n elements is a walk over the input and
+            // O(n log(N/n)) random numbers. The sample is in no particular
+            // order.
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            reservoir(I begin, S end, O out, iterator_difference_t<O> n, Gen &gen)
+            {
+                using D = iterator_difference_t<O>;
+                // Walk the input, as select does.
+                if(n == 0)
+                    return {ranges::next(std::move(begin), std::move(end)), std::move(out)};
+                D k = 0;
+                for(; k < n && begin != end; ++begin, ++k)
+                    out[k] = *begin;
+                if(k < n || begin == end)
+                    return {std::move(begin), out + k};
+                using param_t = typename std::uniform_int_distribution<D>::param_type;
+                std::uniform_int_distribution<D> uid;
+                double const dn = static_cast<double>(n);
+                double w = std::exp(std::log(detail::unit_interval(gen)) / dn);
+                double const most = static_cast<double>(std::numeric_limits<D>::max() / 2);
+                while(true)
+                {
+                    double const gap =
+                        std::floor(std::log(detail::unit_interval(gen)) / std::log1p(-w));
+                    // After many replacements w can underflow to 0, which
+                    // makes the gap infinite or NaN.
+                    D skip = !(gap < most) ? std::numeric_limits<D>::max() / 2 :
+                        static_cast<D>(gap);
+                    for(; skip > 0 && begin != end; --skip)
+                        ++begin;
+                    if(begin == end)
+                        break;
+                    out[uid(gen, param_t{0, n - 1})] = *begin;
+                    ++begin;
+                    w *= std::exp(std::log(detail::unit_interval(gen)) / dn);
+                }
+                return {std::move(begin), out + n};
+            }
+
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, iterator_difference_t<I> n, Gen &gen, std::true_type)
+            {
+                auto const size = iter_distance(begin, end);
+                return sample_fn::select(std::move(begin), std::move(end), size, std::move(out),
+                    n, gen);
+            }
+            template<typename I, typename S, typename O, typename Gen>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(I begin, S end, O out, iterator_difference_t<I> n, Gen &gen, std::false_type)
+            {
+                return sample_fn::reservoir(std::move(begin), std::move(end), std::move(out),
+                    static_cast<iterator_difference_t<O>>(n), gen);
+            }
+        public:
+            /// Copies `n` elements of `[begin, end)`, each subset of `n` as
+            /// likely as any other, to `out`, or all of them if there are no
+            /// more than `n`. When the length of the input is known, or it can
+            /// be walked twice to count it, the sample is taken by selection
+            /// sampling in one pass and keeps the input's order; otherwise
+            /// `out` must be random-access, and reservoir sampling fills
+            /// `[out, out + n)` in no particular order.
+            template<typename I, typename S, typename O, typename Gen,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::SampleConcept<I, S, O, Gen>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::SampleConcept<I, S, O, Gen>())>
+#endif
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(I begin, S end, O out, iterator_difference_t<I> n, Gen && gen) const
+            {
+                RANGES_ASSERT(0 <= n);
+                return sample_fn::impl(std::move(begin), std::move(end), std::move(out), n, gen,
+                    detail::SampleKnowsSize<I, S>{});
+            }
+
+            /// \overload
+            template<typename Rng, typename O, typename Gen,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value &&
+                    detail::SampleConcept<I, range_sentinel_t<Rng>, O, Gen>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>() &&
+                    detail::SampleConcept<I, range_sentinel_t<Rng>, O, Gen>())>
+#endif
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(Rng && rng, O out, range_difference_t<Rng> n, Gen && gen) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(out), n, gen);
+            }
+        };
+
+        /// \sa `sample_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& sample = static_const<with_braced_init_args<sample_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -21,6 +21,12 @@
 #ifndef RANGES_V3_ALGORITHM_SEARCH_HPP
 #define RANGES_V3_ALGORITHM_SEARCH_HPP
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -33,11 +39,290 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/find.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // The Boyer-Moore family of searches compares the pattern with the
+            // text from the pattern's last element backwards, and on a mismatch
+            // shifts the pattern by an amount looked up by the text element
+            // under the pattern's last position: the distance from the last
+            // occurrence of that element among the first m - 1 elements of the
+            // pattern to its end, or m if it doesn't occur there.
+            //
+            // Integers index a 256-entry table by their low byte. Elements that
+            // share a low byte share an entry holding the smallest of their
+            // shifts, which can only make a shift shorter than it might be.
+            template<typename V, typename C>
+            using has_byte_skip_table = meta::bool_<
+                std::is_integral<V>::value && std::is_same<C, ranges::equal_to>::value>;
+
+            struct byte_skip_table
+            {
+            private:
+                std::ptrdiff_t skip_[256];
+            public:
+                template<typename P>
+                byte_skip_table(P pat, std::ptrdiff_t m)
+                {
+                    for(auto &s : skip_)
+                        s = m;
+                    for(std::ptrdiff_t i = 0; i + 1 < m; ++i)
+                        skip_[static_cast<unsigned char>(pat[i])] = m - 1 - i;
+                }
+                template<typename V>
+                std::ptrdiff_t operator()(V const &v) const
+                {
+                    return skip_[static_cast<unsigned char>(v)];
+                }
+            };
+
+            template<typename V, typename Hash, typename C>
+            struct hashed_skip_table
+            {
+            private:
+                std::unordered_map<V, std::ptrdiff_t, Hash, C> skip_;
+                std::ptrdiff_t m_;
+            public:
+                template<typename P>
+                hashed_skip_table(P pat, std::ptrdiff_t m, Hash hash = Hash{}, C pred = C{})
+                  : skip_(static_cast<std::size_t>(m), std::move(hash), std::move(pred)), m_(m)
+                {
+                    for(std::ptrdiff_t i = 0; i + 1 < m; ++i)
+                        skip_[pat[i]] = m - 1 - i;
+                }
+                std::ptrdiff_t operator()(V const &v) const
+                {
+                    auto const it = skip_.find(v);
+                    return it == skip_.end() ? m_ : it->second;
+                }
+            };
+
+            template<typename V, typename Hash, typename C>
+            using skip_table_t =
+                meta::if_<has_byte_skip_table<V, C>, byte_skip_table, hashed_skip_table<V, Hash, C>>;
+
+            template<typename V, typename Hash, typename C>
+            byte_skip_table make_skip_table(std::vector<V> const &pat, Hash &, C &,
+                std::true_type)
+            {
+                return {pat.begin(), static_cast<std::ptrdiff_t>(pat.size())};
+            }
+
+            template<typename V, typename Hash, typename C>
+            hashed_skip_table<V, Hash, C> make_skip_table(std::vector<V> const &pat, Hash &hash,
+                C &pred, std::false_type)
+            {
+                return {pat.begin(), static_cast<std::ptrdiff_t>(pat.size()), hash, pred};
+            }
+
+            // Boyer-Moore-Horspool: the offset of the first occurrence of the m
+            // elements at pat in the n elements at text, or n.
+            template<typename I, typename D, typename P, typename Skip, typename C>
+            D bmh_search(I text, D n, P pat, D m, Skip const &skip, C &pred)
+            {
+                if(m == 0)
+                    return 0;
+                for(D pos = 0; n - pos >= m;)
+                {
+                    auto &&t = text[pos + m - 1];
+                    if(pred(t, pat[m - 1]))
+                    {
+                        D j = m - 1;
+                        while(j != 0 && pred(text[pos + j - 1], pat[j - 1]))
+                            --j;
+                        if(j == 0)
+                            return pos;
+                    }
+                    pos += static_cast<D>(skip(t));
+                }
+                return n;
+            }
+
+            // The good-suffix shifts of Boyer-Moore: good[i] is how far the
+            // pattern may move when its elements after i matched and element i
+            // didn't. See Charras and Lecroq, "Handbook of Exact String
+            // Matching Algorithms".
+            template<typename P, typename C>
+            std::vector<std::ptrdiff_t> bm_good_suffixes(P x, std::ptrdiff_t m, C &pred)
+            {
+                std::vector<std::ptrdiff_t> suff(static_cast<std::size_t>(m)),
+                    good(static_cast<std::size_t>(m), m);
+                if(m == 0)
+                    return good;
+                suff[m - 1] = m;
+                std::ptrdiff_t f = 0, g = m - 1;
+                for(std::ptrdiff_t i = m - 2; i >= 0; --i)
+                {
+                    if(i > g && suff[i + m - 1 - f] < i - g)
+                        suff[i] = suff[i + m - 1 - f];
+                    else
+                    {
+                        if(i < g)
+                            g = i;
+                        f = i;
+                        while(g >= 0 && pred(x[g], x[g + m - 1 - f]))
+                            --g;
+                        suff[i] = f - g;
+                    }
+                }
+                for(std::ptrdiff_t i = m - 1, j = 0; i >= 0; --i)
+                    if(suff[i] == i + 1)
+                        for(; j < m - 1 - i; ++j)
+                            if(good[j] == m)
+                                good[j] = m - 1 - i;
+                for(std::ptrdiff_t i = 0; i <= m - 2; ++i)
+                    good[m - 1 - suff[i]] = m - 1 - i;
+                return good;
+            }
+
+            template<typename I, typename D, typename P, typename Skip, typename C>
+            D bm_search(I text, D n, P pat, D m, Skip const &skip,
+                std::vector<std::ptrdiff_t> const &good, C &pred)
+            {
+                if(m == 0)
+                    return 0;
+                for(D pos = 0; n - pos >= m;)
+                {
+                    D i = m - 1;
+                    while(i >= 0 && pred(text[pos + i], pat[i]))
+                        --i;
+                    if(i < 0)
+                        return pos;
+                    D const bad = static_cast<D>(skip(text[pos + i])) - (m - 1 - i);
+                    D const suffix = static_cast<D>(good[static_cast<std::size_t>(i)]);
+                    pos += bad > suffix ? bad : suffix;
+                }
+                return n;
+            }
+
+            // The two-way algorithm of Crochemore and Perrin splits the pattern
+            // at a critical factorization, matches the right part left to right
+            // and then the left part right to left, and so runs in linear time
+            // and constant space. The factorization comes from the maximal
+            // suffixes of the pattern under an ordering of its elements and
+            // under the reverse ordering.
+            template<typename P, typename L>
+            std::pair<std::ptrdiff_t, std::ptrdiff_t>
+            two_way_max_suffix(P x, std::ptrdiff_t m, L &less)
+            {
+                std::ptrdiff_t ms = -1, j = 0, k = 1, p = 1;
+                while(j + k < m)
+                {
+                    auto &&a = x[j + k];
+                    auto &&b = x[ms + k];
+                    if(less(a, b))
+                    {
+                        j += k;
+                        k = 1;
+                        p = j - ms;
+                    }
+                    else if(less(b, a))
+                    {
+                        ms = j;
+                        j = ms + 1;
+                        k = p = 1;
+                    }
+                    else if(k != p)
+                        ++k;
+                    else
+                    {
+                        j += p;
+                        k = 1;
+                    }
+                }
+                return {ms, p};
+            }
+
+            struct two_way_factorization
+            {
+                std::ptrdiff_t ell, period;
+                bool periodic;
+            };
+
+            template<typename P, typename C, typename L>
+            two_way_factorization two_way_factorize(P x, std::ptrdiff_t m, C &pred, L &less)
+            {
+                auto greater = [&less](iterator_reference_t<P> a, iterator_reference_t<P> b)
+                {
+                    return less(b, a);
+                };
+                auto const u = detail::two_way_max_suffix(x, m, less);
+                auto const v = detail::two_way_max_suffix(x, m, greater);
+                auto const f = u.first > v.first ? u : v;
+                two_way_factorization res{f.first, f.second, f.first + 1 + f.second <= m};
+                for(std::ptrdiff_t i = 0; res.periodic && i <= f.first; ++i)
+                    res.periodic = pred(x[i], x[i + f.second]);
+                if(!res.periodic)
+                {
+                    auto const l = f.first + 1, r = m - f.first - 1;
+                    res.period = (l > r ? l : r) + 1;
+                }
+                return res;
+            }
+
+            template<typename I, typename D, typename P, typename C>
+            D two_way_search(I y, D n, P x, D m, two_way_factorization const &fact, C &pred)
+            {
+                if(m == 0)
+                    return 0;
+                D const ell = static_cast<D>(fact.ell), per = static_cast<D>(fact.period);
+                D memory = -1;
+                for(D j = 0; n - j >= m;)
+                {
+                    // The left part is known to match up to memory after a
+                    // shift by the period of a periodic pattern.
+                    D i = (ell > memory ? ell : memory) + 1;
+                    while(i < m && pred(y[i + j], x[i]))
+                        ++i;
+                    if(i < m)
+                    {
+                        j += i - ell;
+                        memory = -1;
+                        continue;
+                    }
+                    for(i = ell; i > memory && pred(y[i + j], x[i]); --i)
+                        ;
+                    if(i <= memory)
+                        return j;
+                    j += per;
+                    if(fact.periodic)
+                        memory = m - per - 1;
+                }
+                return n;
+            }
+
+            template<typename S, typename I, typename Sent, typename Enable = void>
+            struct is_searcher
+              : std::false_type
+            {};
+
+            template<typename S, typename I, typename Sent>
+            struct is_searcher<S, I, Sent,
+                meta::void_<decltype(std::declval<S const &>()(std::declval<I>(),
+                    std::declval<Sent>()))>>
+              : std::is_convertible<decltype(std::declval<S const &>()(std::declval<I>(),
+                    std::declval<Sent>())), std::pair<I, I>>
+            {};
+
+            // Whether search may pick a skip-table search on its own: both
+            // sequences random access with the same integral value type,
+            // compared with equal_to and no projections.
+            template<typename I1, typename I2, typename C, typename P1, typename P2,
+                typename V1 = iterator_value_t<I1>>
+            using is_skip_searchable = meta::bool_<
+                RandomAccessIterator<I1>::value && RandomAccessIterator<I2>::value &&
+                std::is_same<V1, iterator_value_t<I2>>::value &&
+                std::is_integral<V1>::value && std::is_same<C, ranges::equal_to>::value &&
+                std::is_same<P1, ident>::value && std::is_same<P2, ident>::value>;
+        }
+        /// \endcond
+
         /// \ingroup group-concepts
         template<typename I1, typename I2, typename C = equal_to, typename P1 = ident,
             typename P2 = ident>
@@ -63,6 +348,51 @@ namespace ranges
             {
                 if(d1 < d2)
                     return end1;
+                return search_fn::random_access_impl(begin1_, std::move(end1), d1,
+                    std::move(begin2), std::move(end2), d2, pred, proj1, proj2,
+                    detail::is_skip_searchable<I1, I2, C, P1, P2>{});
+            }
+
+            // The text is scanned for the pattern's first element with find,
+            // which is vectorized for contiguous storage. When that element is
+            // common, though, most candidates it stops at are false starts;
+            // once they outnumber the pattern's length by enough, the rest of
+            // the text is searched with Boyer-Moore-Horspool instead, which
+            // usually moves past a pattern's length of text per mismatch.
+            template<typename I1, typename D1, typename I2, typename S2, typename D2,
+                typename C, typename P1, typename P2>
+            static I1 random_access_impl(I1 const begin1, I1 end1, D1 d1, I2 begin2, S2,
+                D2 d2, C &pred, P1 &, P2 &, std::true_type)
+            {
+                D1 const m = static_cast<D1>(d2);
+                auto const first = *begin2;
+                I1 const last = end1 - (m - 1);
+                D1 false_starts = 0;
+                for(I1 it = begin1;; ++it)
+                {
+                    it = find(it, last, first);
+                    if(it == last)
+                        return end1;
+                    D1 i = 1;
+                    while(i != m && it[i] == begin2[i])
+                        ++i;
+                    if(i == m)
+                        return it;
+                    if(m >= 4 && ++false_starts >= 16 + 4 * m)
+                    {
+                        ++it;
+                        D1 const n = d1 - (it - begin1);
+                        detail::byte_skip_table const skip{begin2, static_cast<std::ptrdiff_t>(m)};
+                        return it + detail::bmh_search(it, n, begin2, m, skip, pred);
+                    }
+                }
+            }
+
+            template<typename I1, typename D1, typename I2, typename S2, typename D2,
+                typename C, typename P1, typename P2>
+            static I1 random_access_impl(I1 const begin1_, I1 end1, D1, I2 begin2, S2 end2,
+                D2 d2, C &pred, P1 &proj1, P2 &proj2, std::false_type)
+            {
                 auto begin1 = uncounted(begin1_);
                 auto const s = uncounted(end1 - (d2 - 1)); // Start of pattern match can't go beyond here
                 while(true)
@@ -227,6 +557,36 @@ namespace ranges
                     return search_fn::impl(begin(rng1), end(rng1),
                         begin(rng2), end(rng2), pred, proj1, proj2);
             }
+
+            /// Searches with a searcher object, such as `boyer_moore_searcher`,
+            /// which has processed the pattern already.
+            template<typename I1, typename S1, typename Searcher,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ForwardIterator<I1>::value && IteratorRange<I1, S1>::value &&
+                    detail::is_searcher<Searcher, I1, S1>::value)>
+#else
+                CONCEPT_REQUIRES_(ForwardIterator<I1>() && IteratorRange<I1, S1>() &&
+                    detail::is_searcher<Searcher, I1, S1>())>
+#endif
+            I1 operator()(I1 begin1, S1 end1, Searcher const &searcher) const
+            {
+                return searcher(std::move(begin1), std::move(end1)).first;
+            }
+
+            /// \overload
+            template<typename Rng1, typename Searcher,
+                typename I1 = range_iterator_t<Rng1>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ForwardRange<Rng1>::value &&
+                    detail::is_searcher<Searcher, I1, range_sentinel_t<Rng1>>::value)>
+#else
+                CONCEPT_REQUIRES_(ForwardRange<Rng1>() &&
+                    detail::is_searcher<Searcher, I1, range_sentinel_t<Rng1>>())>
+#endif
+            range_safe_iterator_t<Rng1> operator()(Rng1 &&rng1, Searcher const &searcher) const
+            {
+                return searcher(begin(rng1), end(rng1)).first;
+            }
         };
 
         /// \sa `search_fn`
@@ -236,6 +596,359 @@ namespace ranges
             constexpr auto&& search = static_const<with_braced_init_args<search_fn>>::value;
         }
 
+        /// \cond
+        namespace detail
+        {
+            template<typename V, typename Rng>
+            std::vector<V> searcher_pattern(Rng &&rng)
+            {
+                std::vector<V> pat;
+                for(auto it = begin(rng), e = end(rng); it != e; ++it)
+                    pat.push_back(*it);
+                return pat;
+            }
+        }
+        /// \endcond
+
+        /// A searcher object finds a pattern in ranges with `search(rng, s)`,
+        /// or with `view::split(rng, s)`, after processing the pattern once
+        /// when the searcher is constructed. Calling it with an iterator and
+        /// sentinel returns the iterators that delimit the first occurrence
+        /// of the pattern, or two iterators at the end of the range if there
+        /// is none. Searchers keep a copy of the pattern, and copies of a
+        /// searcher share it and the tables computed from it.
+        ///
+        /// `default_searcher` is `search` with a stored pattern, and accepts
+        /// forward ranges of any type comparable with the pattern's.
+        template<typename V, typename C = equal_to>
+        struct default_searcher
+        {
+        private:
+            struct state
+            {
+                std::vector<V> pattern_;
+                C pred_;
+            };
+            std::shared_ptr<state const> state_;
+        public:
+            default_searcher() = default;
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            explicit default_searcher(Rng &&pattern, C pred = C{})
+              : state_(std::make_shared<state>(state{
+                    detail::searcher_pattern<V>(pattern), std::move(pred)}))
+            {}
+            std::ptrdiff_t size() const
+            {
+                return state_ ? static_cast<std::ptrdiff_t>(state_->pattern_.size()) : 0;
+            }
+            template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ForwardIterator<I>::value && IteratorRange<I, S>::value &&
+                    Comparable<I, V const *, C>::value)>
+#else
+                CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
+                    Comparable<I, V const *, C>())>
+#endif
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                if(!state_ || state_->pattern_.empty())
+                    return {begin, begin};
+                auto const &pat = state_->pattern_;
+                I it = search_fn{}(std::move(begin), end, pat.data(), pat.data() + pat.size(),
+                    state_->pred_);
+                I last = it;
+                if(it != end)
+                    advance(last, static_cast<iterator_difference_t<I>>(pat.size()));
+                return {it, last};
+            }
+        };
+
+        /// Boyer-Moore-Horspool search: on a mismatch, the pattern moves
+        /// ahead by a distance looked up by the text element under its last
+        /// position. Fast when the pattern is long and its elements are
+        /// varied; O(n * m) at worst. The table is a 256-entry array indexed
+        /// by the low byte when `V` is an integer compared with `equal_to`,
+        /// and a `std::unordered_map` using `Hash` and `C` otherwise.
+        template<typename V, typename Hash = std::hash<V>, typename C = equal_to>
+        struct boyer_moore_horspool_searcher
+        {
+        private:
+            struct state
+            {
+                std::vector<V> pattern_;
+                detail::skip_table_t<V, Hash, C> skip_;
+                C pred_;
+                state(std::vector<V> pattern, Hash hash, C pred)
+                  : pattern_(std::move(pattern))
+                  , skip_(detail::make_skip_table(pattern_, hash, pred,
+                        detail::has_byte_skip_table<V, C>{}))
+                  , pred_(std::move(pred))
+                {}
+            };
+            std::shared_ptr<state const> state_;
+        public:
+            boyer_moore_horspool_searcher() = default;
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            explicit boyer_moore_horspool_searcher(Rng &&pattern, Hash hash = Hash{},
+                C pred = C{})
+              : state_(std::make_shared<state>(detail::searcher_pattern<V>(pattern),
+                    std::move(hash), std::move(pred)))
+            {}
+            std::ptrdiff_t size() const
+            {
+                return state_ ? static_cast<std::ptrdiff_t>(state_->pattern_.size()) : 0;
+            }
+            template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && Same<iterator_value_t<I>, V>::value)>
+#else
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    Same<iterator_value_t<I>, V>())>
+#endif
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                using D = iterator_difference_t<I>;
+                D const n = end - begin, m = static_cast<D>(size());
+                if(m == 0)
+                    return {begin, begin};
+                auto const &s = *state_;
+                D const pos = detail::bmh_search(begin, n, s.pattern_.begin(), m, s.skip_,
+                    s.pred_);
+                return {begin + pos, begin + (pos == n ? n : pos + m)};
+            }
+        };
+
+        /// Boyer-Moore search: Boyer-Moore-Horspool's table, plus the
+        /// good-suffix rule, which moves the pattern by what the part that
+        /// matched before a mismatch says about where it can next occur. Its
+        /// setup costs O(m) more time and space, and it makes fewer
+        /// comparisons on repetitive patterns.
+        template<typename V, typename Hash = std::hash<V>, typename C = equal_to>
+        struct boyer_moore_searcher
+        {
+        private:
+            struct state
+            {
+                std::vector<V> pattern_;
+                detail::skip_table_t<V, Hash, C> skip_;
+                std::vector<std::ptrdiff_t> good_;
+                C pred_;
+                state(std::vector<V> pattern, Hash hash, C pred)
+                  : pattern_(std::move(pattern))
+                  , skip_(detail::make_skip_table(pattern_, hash, pred,
+                        detail::has_byte_skip_table<V, C>{}))
+                  , good_(detail::bm_good_suffixes(pattern_.begin(),
+                        static_cast<std::ptrdiff_t>(pattern_.size()), pred))
+                  , pred_(std::move(pred))
+                {}
+            };
+            std::shared_ptr<state const> state_;
+        public:
+            boyer_moore_searcher() = default;
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            explicit boyer_moore_searcher(Rng &&pattern, Hash hash = Hash{}, C pred = C{})
+              : state_(std::make_shared<state>(detail::searcher_pattern<V>(pattern),
+                    std::move(hash), std::move(pred)))
+            {}
+            std::ptrdiff_t size() const
+            {
+                return state_ ? static_cast<std::ptrdiff_t>(state_->pattern_.size()) : 0;
+            }
+            template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && Same<iterator_value_t<I>, V>::value)>
+#else
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    Same<iterator_value_t<I>, V>())>
+#endif
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                using D = iterator_difference_t<I>;
+                D const n = end - begin, m = static_cast<D>(size());
+                if(m == 0)
+                    return {begin, begin};
+                auto const &s = *state_;
+                D const pos = detail::bm_search(begin, n, s.pattern_.begin(), m,
+                    s.skip_, s.good_, s.pred_);
+                return {begin + pos, begin + (pos == n ? n : pos + m)};
+            }
+        };
+
+        /// The two-way search of Crochemore and Perrin: linear time in the
+        /// worst case, with no tables, at the price of an ordering `L` on the
+        /// pattern's elements that is consistent with `C`.
+        template<typename V, typename C = equal_to, typename L = ordered_less>
+        struct two_way_searcher
+        {
+        private:
+            struct state
+            {
+                std::vector<V> pattern_;
+                detail::two_way_factorization fact_;
+                C pred_;
+                state(std::vector<V> pattern, C pred, L less)
+                  : pattern_(std::move(pattern))
+                  , fact_(detail::two_way_factorize(pattern_.cbegin(),
+                        static_cast<std::ptrdiff_t>(pattern_.size()), pred, less))
+                  , pred_(std::move(pred))
+                {}
+            };
+            std::shared_ptr<state const> state_;
+        public:
+            two_way_searcher() = default;
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            explicit two_way_searcher(Rng &&pattern, C pred = C{}, L less = L{})
+              : state_(std::make_shared<state>(detail::searcher_pattern<V>(pattern),
+                    std::move(pred), std::move(less)))
+            {}
+            std::ptrdiff_t size() const
+            {
+                return state_ ? static_cast<std::ptrdiff_t>(state_->pattern_.size()) : 0;
+            }
+            template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value &&
+                    IndirectCallableRelation<C, I, V const *>::value)>
+#else
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    IndirectCallableRelation<C, I, V const *>())>
+#endif
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                using D = iterator_difference_t<I>;
+                D const n = end - begin, m = static_cast<D>(size());
+                if(m == 0)
+                    return {begin, begin};
+                auto const &s = *state_;
+                D const pos = detail::two_way_search(begin, n, s.pattern_.begin(), m, s.fact_,
+                    s.pred_);
+                return {begin + pos, begin + (pos == n ? n : pos + m)};
+            }
+        };
+
+        /// Makes a `default_searcher` for the elements of `pattern`.
+        struct make_default_searcher_fn
+        {
+            template<typename Rng, typename C = equal_to,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            default_searcher<range_value_t<Rng>, C> operator()(Rng &&pattern, C pred = C{}) const
+            {
+                return default_searcher<range_value_t<Rng>, C>{pattern, std::move(pred)};
+            }
+        };
+
+        /// Makes a `boyer_moore_horspool_searcher` for the elements of `pattern`.
+        struct make_boyer_moore_horspool_searcher_fn
+        {
+            template<typename Rng, typename Hash = std::hash<range_value_t<Rng>>,
+                typename C = equal_to,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            boyer_moore_horspool_searcher<range_value_t<Rng>, Hash, C>
+            operator()(Rng &&pattern, Hash hash = Hash{}, C pred = C{}) const
+            {
+                return boyer_moore_horspool_searcher<range_value_t<Rng>, Hash, C>{pattern,
+                    std::move(hash), std::move(pred)};
+            }
+        };
+
+        /// Makes a `boyer_moore_searcher` for the elements of `pattern`.
+        struct make_boyer_moore_searcher_fn
+        {
+            template<typename Rng, typename Hash = std::hash<range_value_t<Rng>>,
+                typename C = equal_to,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            boyer_moore_searcher<range_value_t<Rng>, Hash, C>
+            operator()(Rng &&pattern, Hash hash = Hash{}, C pred = C{}) const
+            {
+                return boyer_moore_searcher<range_value_t<Rng>, Hash, C>{pattern,
+                    std::move(hash), std::move(pred)};
+            }
+        };
+
+        /// Makes a `two_way_searcher` for the elements of `pattern`.
+        struct make_two_way_searcher_fn
+        {
+            template<typename Rng, typename C = equal_to, typename L = ordered_less,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(InputRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(InputRange<Rng>())>
+#endif
+            two_way_searcher<range_value_t<Rng>, C, L>
+            operator()(Rng &&pattern, C pred = C{}, L less = L{}) const
+            {
+                return two_way_searcher<range_value_t<Rng>, C, L>{pattern, std::move(pred),
+                    std::move(less)};
+            }
+        };
+
+        /// \sa `make_default_searcher_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& make_default_searcher =
+                static_const<with_braced_init_args<make_default_searcher_fn>>::value;
+        }
+
+        /// \sa `make_boyer_moore_horspool_searcher_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& make_boyer_moore_horspool_searcher =
+                static_const<with_braced_init_args<make_boyer_moore_horspool_searcher_fn>>::value;
+        }
+
+        /// \sa `make_boyer_moore_searcher_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& make_boyer_moore_searcher =
+                static_const<with_braced_init_args<make_boyer_moore_searcher_fn>>::value;
+        }
+
+        /// \sa `make_two_way_searcher_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& make_two_way_searcher =
+                static_const<with_braced_init_args<make_two_way_searcher_fn>>::value;
+        }
+
         /// @}
     } // namespace v3
 } // namespace ranges
@@ -23,6 +23,8 @@
 
 #include <tuple>
 #include <utility>
+#include <functional>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -31,6 +33,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/aux_/gallop.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/utility/tagged_tuple.hpp>
@@ -44,6 +47,54 @@ namespace ranges
         /// @{
         struct includes_fn
         {
+        private:
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static bool impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1, P2 &proj2,
+                std::false_type)
+            {
+                for(; begin2 != end2; ++begin1)
+                {
+                    if(begin1 == end1 || pred(proj2(*begin2), proj1(*begin1)))
+                        return false;
+                    if(!pred(proj1(*begin1), proj2(*begin2)))
+                        ++begin2;
+                }
+                return true;
+            }
+            // As above, but galloping over long runs of the first input when
+            // the second is much shorter (see detail::gallop_block).
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static bool impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1, P2 &proj2,
+                std::true_type)
+            {
+                if(!detail::skewed(end1 - begin1, end2 - begin2))
+                    return includes_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), pred, proj1, proj2,
+                        std::false_type{});
+                while(end1 - begin1 >= detail::gallop_block &&
+                    end2 - begin2 >= detail::gallop_block)
+                {
+                    I2 const s2 = begin2;
+                    for(int k = 0; k != detail::gallop_block; ++k)
+                    {
+                        if(pred(proj2(*begin2), proj1(*begin1)))
+                            return false;
+                        if(!pred(proj1(*begin1), proj2(*begin2)))
+                            ++begin2;
+                        ++begin1;
+                    }
+                    if(begin2 == s2)
+                    {
+                        begin1 = aux::gallop_lower_bound_n(begin1, end1 - begin1,
+                            proj2(*begin2), std::ref(pred), std::ref(proj1));
+                    }
+                }
+                return includes_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), pred, proj1, proj2, std::false_type{});
+            }
+        public:
             template<typename I1, typename S1, typename I2, typename S2,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -59,14 +110,9 @@ namespace ranges
                 auto &&pred = as_function(pred_);
                 auto &&proj1 = as_function(proj1_);
                 auto &&proj2 = as_function(proj2_);
-                for(; begin2 != end2; ++begin1)
-                {
-                    if(begin1 == end1 || pred(proj2(*begin2), proj1(*begin1)))
-                        return false;
-                    if(!pred(proj1(*begin1), proj2(*begin2)))
-                        ++begin2;
-                }
-                return true;
+                return includes_fn::impl(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), pred, proj1, proj2,
+                    detail::can_gallop<I1, S1, I2, S2>{});
             }
 
             template<typename Rng1, typename Rng2, typename C = ordered_less,
@@ -168,21 +214,13 @@ namespace ranges
 
         struct set_intersection_fn
         {
-            template<typename I1, typename S1, typename I2, typename S2, typename O,
-                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>::value &&
-                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
-#else
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
-                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
-#endif
-            O operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
-                C pred_ = C{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+        private:
+            template<typename I1, typename S1, typename I2, typename S2, typename O, typename C,
+                typename P1, typename P2>
+            static O
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2,
+                std::false_type)
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj1 = as_function(proj1_);
-                auto &&proj2 = as_function(proj2_);
                 while(begin1 != end1 && begin2 != end2)
                 {
                     if(pred(proj1(*begin1), proj2(*begin2)))
@@ -200,6 +238,73 @@ namespace ranges
                 }
                 return out;
             }
+            // As above, but galloping over long runs of either input when the
+            // other is much shorter (see detail::gallop_block).
+            template<typename I1, typename S1, typename I2, typename S2, typename O, typename C,
+                typename P1, typename P2>
+            static O
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2,
+                std::true_type)
+            {
+                if(!detail::skewed(end1 - begin1, end2 - begin2))
+                    return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                        std::false_type{});
+                while(end1 - begin1 >= detail::gallop_block &&
+                    end2 - begin2 >= detail::gallop_block)
+                {
+                    I1 const s1 = begin1;
+                    I2 const s2 = begin2;
+                    for(int k = 0; k != detail::gallop_block; ++k)
+                    {
+                        if(pred(proj1(*begin1), proj2(*begin2)))
+                            ++begin1;
+                        else
+                        {
+                            if(!pred(proj2(*begin2), proj1(*begin1)))
+                            {
+                                *out = *begin1;
+                                ++out;
+                                ++begin1;
+                            }
+                            ++begin2;
+                        }
+                    }
+                    if(begin2 == s2)
+                    {
+                        begin1 = aux::gallop_lower_bound_n(begin1, end1 - begin1,
+                            proj2(*begin2), std::ref(pred), std::ref(proj1));
+                    }
+                    else if(begin1 == s1)
+                    {
+                        begin2 = aux::gallop_lower_bound_n(begin2, end2 - begin2,
+                            proj1(*begin1), std::ref(pred), std::ref(proj2));
+                    }
+                }
+                return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    std::false_type{});
+            }
+        public:
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            O operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C pred_ = C{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    detail::can_gallop<I1, S1, I2, S2>{});
+            }
 
             template<typename Rng1, typename Rng2, typename O,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
@@ -229,25 +334,20 @@ namespace ranges
 
         struct set_difference_fn
         {
-            template<typename I1, typename S1, typename I2, typename S2, typename O,
-                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
-#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>::value &&
-                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
-#else
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
-                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
-#endif
-            tagged_pair<tag::in1(I1), tag::out(O)> operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
-                C pred_ = C{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+        private:
+            template<typename I1, typename S1, typename I2, typename S2, typename O, typename C,
+                typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::out(O)>
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2,
+                std::false_type)
             {
-                auto &&pred = as_function(pred_);
-                auto &&proj1 = as_function(proj1_);
-                auto &&proj2 = as_function(proj2_);
                 while(begin1 != end1)
                 {
                     if(begin2 == end2)
-                        return copy(begin1, end1, out);
+                    {
+                        auto tmp = copy(begin1, end1, out);
+                        return {tmp.first, tmp.second};
+                    }
                     if(pred(proj1(*begin1), proj2(*begin2)))
                     {
                         *out = *begin1;
@@ -263,6 +363,69 @@ namespace ranges
                 }
                 return {begin1, out};
             }
+            // As above, but galloping over long runs of the second input when
+            // the first is much shorter (see detail::gallop_block). Runs of the
+            // first are written out, which costs as much as stepping through
+            // them.
+            template<typename I1, typename S1, typename I2, typename S2, typename O, typename C,
+                typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::out(O)>
+            impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2,
+                std::true_type)
+            {
+                if(!detail::skewed(end1 - begin1, end2 - begin2))
+                    return set_difference_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                        std::false_type{});
+                while(end1 - begin1 >= detail::gallop_block &&
+                    end2 - begin2 >= detail::gallop_block)
+                {
+                    I1 const s1 = begin1;
+                    for(int k = 0; k != detail::gallop_block; ++k)
+                    {
+                        if(pred(proj1(*begin1), proj2(*begin2)))
+                        {
+                            *out = *begin1;
+                            ++out;
+                            ++begin1;
+                        }
+                        else
+                        {
+                            if(!pred(proj2(*begin2), proj1(*begin1)))
+                                ++begin1;
+                            ++begin2;
+                        }
+                    }
+                    if(begin1 == s1)
+                    {
+                        begin2 = aux::gallop_lower_bound_n(begin2, end2 - begin2,
+                            proj1(*begin1), std::ref(pred), std::ref(proj2));
+                    }
+                }
+                return set_difference_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    std::false_type{});
+            }
+        public:
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            tagged_pair<tag::in1(I1), tag::out(O)> operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C pred_ = C{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                return set_difference_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    detail::can_gallop<I1, S1, I2, S2>{});
+            }
 
             template<typename Rng1, typename Rng2, typename O,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
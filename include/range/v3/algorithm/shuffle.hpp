@@ -13,8 +13,11 @@
 #ifndef RANGES_V3_ALGORITHM_SHUFFLE_HPP
 #define RANGES_V3_ALGORITHM_SHUFFLE_HPP
 
+#include <cstdint>
 #include <random>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -48,6 +51,200 @@ namespace ranges
         using UniformRandomNumberGenerator = concepts::models<concepts::UniformRandomNumberGenerator, Gen>;
         /// @}
 
+        /// \cond
+        namespace detail
+        {
+            // SplitMix64: a generator small and cheap enough to give each task
+            // of a parallel algorithm its own, seeded from the caller's, so the
+            // tasks draw independent streams without sharing (or having to
+            // copy) the caller's generator.
+            struct splitmix64
+            {
+                using result_type = std::uint64_t;
+                std::uint64_t state;
+
+                static constexpr result_type min()
+                {
+                    return 0;
+                }
+                static constexpr result_type max()
+                {
+                    return ~result_type{0};
+                }
+                result_type operator()()
+                {
+                    std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+                    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                    return z ^ (z >> 31);
+                }
+            };
+
+            template<typename Gen>
+            splitmix64 split_generator(Gen &gen)
+            {
+                std::uniform_int_distribution<std::uint64_t> uid;
+                return {uid(gen)};
+            }
+
+            template<typename I, typename Gen>
+            void fisher_yates(I begin, I end, Gen &gen)
+            {
+                auto d = end - begin;
+                if(d > 1)
+                {
+                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
+                    std::uniform_int_distribution<std::ptrdiff_t> uid;
+                    for(--end, --d; begin < end; ++begin, --d)
+                    {
+                        auto i = uid(gen, param_t{0, d});
+                        if(i != 0)
+                            ranges::iter_swap(begin, begin + i);
+                    }
+                }
+            }
+
+            // Blocks of this many elements or fewer are shuffled by
+            // Fisher-Yates, whose random swaps then stay in cache.
+            constexpr std::ptrdiff_t merge_shuffle_block()
+            {
+                return 1 << 18;
+            }
+
+            // While neither run is used up, the steps of merge_shuffled can
+            // be taken without branching on the coin: the two elements are
+            // written back swapped or not. Half the branches would be
+            // mispredicted.
+            template<typename I>
+            void merge_shuffled_scalars(I &u, I &v, I end, std::uint64_t &bits, int &nbits,
+                splitmix64 &gen, std::true_type)
+            {
+                // A word of coin flips at a time while both runs have that
+                // many elements left, so the inner loop has no other test.
+                while(v - u >= 64 && end - v >= 64)
+                {
+                    std::uint64_t b = gen();
+                    for(int k = 0; k != 64; ++k)
+                    {
+                        bool const flip = (b & 1u) != 0;
+                        b >>= 1;
+                        auto const x = *u, y = *v;
+                        *u = flip ? y : x;
+                        *v = flip ? x : y;
+                        v += flip;
+                        ++u;
+                    }
+                }
+                while(u != v && v != end)
+                {
+                    if(nbits == 0)
+                    {
+                        bits = gen();
+                        nbits = 64;
+                    }
+                    bool const flip = (bits & 1u) != 0;
+                    bits >>= 1;
+                    --nbits;
+                    auto const x = *u, y = *v;
+                    *u = flip ? y : x;
+                    *v = flip ? x : y;
+                    v += flip;
+                    ++u;
+                }
+            }
+            template<typename I>
+            void merge_shuffled_scalars(I &, I &, I, std::uint64_t &, int &, splitmix64 &,
+                std::false_type)
+            {}
+
+            // The merge step of MergeShuffle (Bacher, Bodini, Hollender and
+            // Lumbroso): given shuffled [begin, mid) and [mid, end), leaves
+            // [begin, end) shuffled. Fair coin flips take the next element from
+            // one run or the other until one runs out; the elements left over
+            // are each swapped with a random position at or before them. Both
+            // runs are read front to back, so it costs a streaming pass and
+            // about one random bit per element.
+            template<typename I>
+            void merge_shuffled(I begin, I mid, I end, splitmix64 &gen)
+            {
+                I u = begin, v = mid;
+                std::uint64_t bits = 0;
+                int nbits = 0;
+                detail::merge_shuffled_scalars(u, v, end, bits, nbits, gen,
+                    meta::bool_<std::is_scalar<iterator_value_t<I>>::value &&
+                        std::is_same<iterator_reference_t<I>, iterator_value_t<I> &>::value>{});
+                while(true)
+                {
+                    if(nbits == 0)
+                    {
+                        bits = gen();
+                        nbits = 64;
+                    }
+                    bool const flip = (bits & 1u) != 0;
+                    bits >>= 1;
+                    --nbits;
+                    if(flip)
+                    {
+                        if(v == end)
+                            break;
+                        ranges::iter_swap(u, v);
+                        ++v;
+                    }
+                    else if(u == v)
+                        break;
+                    ++u;
+                }
+                using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
+                std::uniform_int_distribution<std::ptrdiff_t> uid;
+                for(; u != end; ++u)
+                    ranges::iter_swap(u, begin + uid(gen, param_t{0, u - begin}));
+            }
+
+            // Shuffles the blocks of [begin, end), of at most `block`
+            // elements each, concurrently, then merges neighbouring blocks in
+            // pairs, each level of merges concurrently, until one block is
+            // left. Every block has its own generator, which goes on to drive
+            // the merges it is the left half of.
+            template<typename I, typename Gen>
+            void merge_shuffle(I begin, I end, Gen &gen, std::ptrdiff_t block)
+            {
+                std::ptrdiff_t const n = end - begin;
+                std::ptrdiff_t blocks = 1;
+                while(n / blocks > block)
+                    blocks *= 2;
+                std::vector<splitmix64> gens;
+                gens.reserve(static_cast<std::size_t>(blocks));
+                for(std::ptrdiff_t k = 0; k != blocks; ++k)
+                    gens.push_back(detail::split_generator(gen));
+                auto const bound = [=](std::ptrdiff_t k)
+                {
+                    return begin + static_cast<std::ptrdiff_t>(
+                        static_cast<std::uint64_t>(n) * static_cast<std::uint64_t>(k) /
+                            static_cast<std::uint64_t>(blocks));
+                };
+                detail::parallel_for(blocks, [&](std::ptrdiff_t lo, std::ptrdiff_t hi)
+                {
+                    for(; lo != hi; ++lo)
+                        detail::fisher_yates(bound(lo), bound(lo + 1),
+                            gens[static_cast<std::size_t>(lo)]);
+                }, std::ptrdiff_t(1));
+                for(std::ptrdiff_t width = 1; width < blocks; width *= 2)
+                {
+                    detail::parallel_for(blocks / (2 * width),
+                        [&](std::ptrdiff_t lo, std::ptrdiff_t hi)
+                        {
+                            for(; lo != hi; ++lo)
+                            {
+                                std::ptrdiff_t const k = lo * 2 * width;
+                                detail::merge_shuffled(bound(k), bound(k + width),
+                                    bound(k + 2 * width), gens[static_cast<std::size_t>(k)]);
+                            }
+                        }, std::ptrdiff_t(1));
+                }
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct shuffle_fn
@@ -68,20 +265,9 @@ namespace ranges
 #endif
             I operator()(I begin, S end_, Gen && gen) const
             {
-                I end = ranges::next(begin, end_), orig = end;
-                auto d = end - begin;
-                if(d > 1)
-                {
-                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
-                    std::uniform_int_distribution<std::ptrdiff_t> uid;
-                    for(--end, --d; begin < end; ++begin, --d)
-                    {
-                        auto i = uid(gen, param_t{0, d});
-                        if(i != 0)
-                            ranges::iter_swap(begin, begin + i);
-                    }
-                }
-                return orig;
+                I end = ranges::next(begin, end_);
+                detail::fisher_yates(begin, end, gen);
+                return end;
             }
 
             template<typename Rng, typename Gen,
@@ -101,6 +287,64 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::forward<Gen>(rand));
             }
+
+            /// \overload
+            /// With a parallel policy, shuffles by MergeShuffle on the
+            /// library's thread pool: blocks small enough to stay in cache are
+            /// shuffled concurrently, then merged into one shuffled range by
+            /// streaming passes. There the generator only seeds one small
+            /// generator per block, so the result differs from the sequential
+            /// shuffle's. With `execution::seq`, or a range of at most 2^18
+            /// elements, which is one block, the range is shuffled by the same
+            /// Fisher-Yates pass as without a policy, and the result, like the
+            /// state `gen` is left in, is the same.
+            template<typename E, typename I, typename S, typename Gen,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value && IteratorRange<I, S>::value &&
+                    Permutable<I>::value && UniformRandomNumberGenerator<Gen>::value &&
+                    ConvertibleTo<
+                    concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                    iterator_difference_t<I>>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() &&
+                    Permutable<I>() && UniformRandomNumberGenerator<Gen>() &&
+                    ConvertibleTo<
+                        concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                        iterator_difference_t<I>>())>
+#endif
+            I operator()(E &&, I begin, S end_, Gen && gen) const
+            {
+                I end = ranges::next(begin, end_);
+                if(!detail::is_parallel_policy<E>() || end - begin <= detail::merge_shuffle_block())
+                    detail::fisher_yates(begin, end, gen);
+                else
+                    detail::merge_shuffle(begin, end, gen, detail::merge_shuffle_block());
+                return end;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename Gen,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && Permutable<I>::value &&
+                    UniformRandomNumberGenerator<Gen>::value && ConvertibleTo<
+                    concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                    iterator_difference_t<I>>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && Permutable<I>() &&
+                    UniformRandomNumberGenerator<Gen>() && ConvertibleTo<
+                        concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                        iterator_difference_t<I>>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, Gen && rand) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<Gen>(rand));
+            }
         };
 
         /// \sa `shuffle_fn`
@@ -36,6 +36,10 @@
 #ifndef RANGES_V3_ALGORITHM_SORT_HPP
 #define RANGES_V3_ALGORITHM_SORT_HPP
 
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -127,32 +131,499 @@ namespace ranges
                 for(I i = begin; i != end; ++i)
                     detail::unguarded_linear_insert(i, iter_move(i), pred, proj);
             }
-        }
-        /// \endcond
 
-        /// \addtogroup group-algorithms
-        /// @{
+            // Pattern-defeating quicksort (pdqsort, after Orson Peters): an
+            // introsort that notices when a partition did no work and finishes
+            // such ranges with a bounded insertion sort, puts runs of elements
+            // equal to the previous pivot in place with a single partition,
+            // and shuffles a few elements when a partition comes out badly
+            // unbalanced. For arithmetic keys compared with `less`, elements
+            // are partitioned in blocks, without data-dependent branches
+            // (BlockQuicksort, Edelkamp and Weiß).
+            constexpr std::ptrdiff_t pdq_insertion_sort_threshold() { return 24; }
+            constexpr std::ptrdiff_t pdq_ninther_threshold() { return 128; }
+            constexpr std::ptrdiff_t pdq_partial_insertion_sort_limit() { return 8; }
+            constexpr std::ptrdiff_t pdq_block_size() { return 64; }
 
-        // Introsort: Quicksort to a certain depth, then Heapsort. Insertion
-        // sort below a certain threshold.
-        // TODO Forward iterators, like EoP?
-        struct sort_fn
-        {
-        private:
-            static constexpr int introsort_threshold() { return 16; }
+            template<typename I, typename C, typename P,
+                typename K = uncvref_t<decltype(std::declval<P &>()(
+                    std::declval<iterator_reference_t<I>>()))>>
+            using pdq_branchless = meta::and_<
+                meta::or_<std::is_same<uncvref_t<C>, less>, std::is_same<uncvref_t<C>, ordered_less>>,
+                std::is_arithmetic<K>>;
+
+            template<typename I, typename C, typename P>
+            inline void pdq_sort2(I a, I b, C &pred, P &proj)
+            {
+                if(pred(proj(*b), proj(*a)))
+                    ranges::iter_swap(a, b);
+            }
+
+            template<typename I, typename C, typename P>
+            inline void pdq_sort3(I a, I b, I c, C &pred, P &proj)
+            {
+                detail::pdq_sort2(a, b, pred, proj);
+                detail::pdq_sort2(b, c, pred, proj);
+                detail::pdq_sort2(a, b, pred, proj);
+            }
 
+            // Insertion sort that gives up, returning false, once it has moved
+            // more than a handful of elements.
             template<typename I, typename C, typename P>
-            static void final_insertion_sort(I begin, I end, C &pred, P &proj)
+            bool partial_insertion_sort(I begin, I end, C &pred, P &proj)
             {
-                if(end - begin > sort_fn::introsort_threshold())
+                if(begin == end)
+                    return true;
+                iterator_difference_t<I> moved = 0;
+                for(I cur = ranges::next(begin); cur != end; ++cur)
                 {
-                    detail::insertion_sort(begin, begin + sort_fn::introsort_threshold(), pred, proj);
-                    detail::unguarded_insertion_sort(begin + sort_fn::introsort_threshold(), end, pred, proj);
+                    if(moved > detail::pdq_partial_insertion_sort_limit())
+                        return false;
+                    I sift = cur, sift_1 = ranges::prev(cur);
+                    if(pred(proj(*sift), proj(*sift_1)))
+                    {
+                        iterator_value_t<I> tmp = iter_move(sift);
+                        do
+                        {
+                            *sift = iter_move(sift_1);
+                            --sift;
+                        } while(sift != begin && pred(proj(tmp), proj(*--sift_1)));
+                        *sift = std::move(tmp);
+                        moved += cur - sift;
+                    }
                 }
+                return true;
+            }
+
+            // Partitions [begin, end) around the pivot *begin into the elements
+            // that are less than it and the rest, and returns the pivot's final
+            // position along with whether the range was already partitioned.
+            // Requires that some element past begin is not less than the pivot.
+            template<typename I, typename C, typename P>
+            std::pair<I, bool> partition_right(I begin, I end, C &pred, P &proj)
+            {
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&key = proj(pivot);
+                I first = begin, last = end;
+                while(pred(proj(*++first), key))
+                    ;
+                if(ranges::prev(first) == begin)
+                    while(first < last && !pred(proj(*--last), key))
+                        ;
                 else
-                    detail::insertion_sort(begin, end, pred, proj);
+                    while(!pred(proj(*--last), key))
+                        ;
+                bool const already_partitioned = !(first < last);
+                while(first < last)
+                {
+                    ranges::iter_swap(first, last);
+                    while(pred(proj(*++first), key))
+                        ;
+                    while(!pred(proj(*--last), key))
+                        ;
+                }
+                I pivot_pos = ranges::prev(first);
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return {pivot_pos, already_partitioned};
+            }
+
+            // Moves the elements at first + offsets_l[i] and last - offsets_r[i]
+            // across the partition point, for i in [0, num).
+            template<typename I>
+            void swap_offsets(I first, I last, unsigned char const *offsets_l,
+                unsigned char const *offsets_r, std::ptrdiff_t num, bool use_swaps)
+            {
+                if(use_swaps)
+                {
+                    // The blocks are the same size, so the elements must be
+                    // swapped pairwise to keep the partition balanced.
+                    for(std::ptrdiff_t i = 0; i < num; ++i)
+                        ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+                }
+                else if(num > 0)
+                {
+                    I l = first + offsets_l[0], r = last - offsets_r[0];
+                    iterator_value_t<I> tmp = iter_move(l);
+                    *l = iter_move(r);
+                    for(std::ptrdiff_t i = 1; i < num; ++i)
+                    {
+                        l = first + offsets_l[i];
+                        *r = iter_move(l);
+                        r = last - offsets_r[i];
+                        *l = iter_move(r);
+                    }
+                    *r = std::move(tmp);
+                }
             }
 
+            // partition_right without branches that depend on the comparisons:
+            // the outcomes are recorded as offsets into blocks of each side, and
+            // the misplaced elements are then exchanged in bulk.
+            template<typename I, typename C, typename P>
+            std::pair<I, bool> partition_right_branchless(I begin, I end, C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const block = detail::pdq_block_size();
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&key = proj(pivot);
+                I first = begin, last = end;
+                while(pred(proj(*++first), key))
+                    ;
+                if(ranges::prev(first) == begin)
+                    while(first < last && !pred(proj(*--last), key))
+                        ;
+                else
+                    while(!pred(proj(*--last), key))
+                        ;
+                bool const already_partitioned = !(first < last);
+                if(!already_partitioned)
+                {
+                    ranges::iter_swap(first, last);
+                    ++first;
+
+                    unsigned char offsets_l[detail::pdq_block_size()];
+                    unsigned char offsets_r[detail::pdq_block_size()];
+                    I offsets_l_base = first, offsets_r_base = last;
+                    D num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+                    while(first < last)
+                    {
+                        // Fill the offset blocks that are empty with the elements
+                        // that are on the wrong side.
+                        D const num_unknown = last - first;
+                        D const left_split =
+                            num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                        D const right_split = num_r == 0 ? num_unknown - left_split : 0;
+                        for(D i = 0, n = (std::min)(left_split, block); i < n; ++i, ++first)
+                        {
+                            offsets_l[num_l] = static_cast<unsigned char>(i);
+                            num_l += !pred(proj(*first), key);
+                        }
+                        for(D i = 0, n = (std::min)(right_split, block); i < n;)
+                        {
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += pred(proj(*--last), key);
+                        }
+
+                        D const num = (std::min)(num_l, num_r);
+                        detail::swap_offsets(offsets_l_base, offsets_r_base,
+                            offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+                        num_l -= num;
+                        num_r -= num;
+                        start_l += num;
+                        start_r += num;
+                        if(num_l == 0)
+                        {
+                            start_l = 0;
+                            offsets_l_base = first;
+                        }
+                        if(num_r == 0)
+                        {
+                            start_r = 0;
+                            offsets_r_base = last;
+                        }
+                    }
+
+                    // Whatever is left in one of the blocks goes next to the
+                    // partition point.
+                    if(num_l != 0)
+                    {
+                        while(num_l--)
+                            ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                        first = last;
+                    }
+                    if(num_r != 0)
+                    {
+                        while(num_r--)
+                        {
+                            ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                            ++first;
+                        }
+                        last = first;
+                    }
+                }
+                I pivot_pos = ranges::prev(first);
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return {pivot_pos, already_partitioned};
+            }
+
+            // Partitions [begin, end) around the pivot *begin into the elements
+            // that are not greater than it and the rest. Used when the pivot is
+            // equal to the element just before begin, which then puts the whole
+            // run of equal elements in place.
+            template<typename I, typename C, typename P>
+            I partition_left(I begin, I end, C &pred, P &proj)
+            {
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&key = proj(pivot);
+                I first = begin, last = end;
+                while(pred(key, proj(*--last)))
+                    ;
+                if(ranges::next(last) == end)
+                    while(first < last && !pred(key, proj(*++first)))
+                        ;
+                else
+                    while(!pred(key, proj(*++first)))
+                        ;
+                while(first < last)
+                {
+                    ranges::iter_swap(first, last);
+                    while(pred(key, proj(*--last)))
+                        ;
+                    while(!pred(key, proj(*++first)))
+                        ;
+                }
+                I pivot_pos = last;
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return pivot_pos;
+            }
+
+            template<typename I, typename C, typename P>
+            std::pair<I, bool> pdq_partition(I begin, I end, C &pred, P &proj, std::false_type)
+            {
+                return detail::partition_right(begin, end, pred, proj);
+            }
+
+            template<typename I, typename C, typename P>
+            std::pair<I, bool> pdq_partition(I begin, I end, C &pred, P &proj, std::true_type)
+            {
+                return detail::partition_right_branchless(begin, end, pred, proj);
+            }
+
+            // Swaps a few elements of a badly unbalanced partition [begin, end)
+            // with ones further in, to break up the pattern that produced it.
+            template<typename I>
+            void pdq_break_pattern(I begin, I end)
+            {
+                auto const len = end - begin;
+                if(len < detail::pdq_insertion_sort_threshold())
+                    return;
+                auto const q = len / 4;
+                ranges::iter_swap(begin, begin + q);
+                ranges::iter_swap(end - 1, end - q);
+                if(len > detail::pdq_ninther_threshold())
+                {
+                    ranges::iter_swap(begin + 1, begin + (q + 1));
+                    ranges::iter_swap(begin + 2, begin + (q + 2));
+                    ranges::iter_swap(end - 2, end - (q + 1));
+                    ranges::iter_swap(end - 3, end - (q + 2));
+                }
+            }
+
+            // Sorts [begin, end). When leftmost is false, the element before
+            // begin is not greater than any element in the range.
+            template<typename I, typename C, typename P, typename Branchless>
+            void pdqsort_loop(I begin, I end, C &pred, P &proj, int bad_allowed,
+                bool leftmost, Branchless branchless)
+            {
+                using D = iterator_difference_t<I>;
+                while(true)
+                {
+                    D const size = end - begin;
+                    if(size < detail::pdq_insertion_sort_threshold())
+                    {
+                        if(leftmost)
+                            detail::insertion_sort(begin, end, pred, proj);
+                        else
+                            detail::unguarded_insertion_sort(begin, end, pred, proj);
+                        return;
+                    }
+
+                    // Choose the pivot as the median of 3, or pseudomedian of 9,
+                    // and move it to begin.
+                    D const s2 = size / 2;
+                    if(size > detail::pdq_ninther_threshold())
+                    {
+                        detail::pdq_sort3(begin, begin + s2, end - 1, pred, proj);
+                        detail::pdq_sort3(begin + 1, begin + (s2 - 1), end - 2, pred, proj);
+                        detail::pdq_sort3(begin + 2, begin + (s2 + 1), end - 3, pred, proj);
+                        detail::pdq_sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), pred, proj);
+                        ranges::iter_swap(begin, begin + s2);
+                    }
+                    else
+                        detail::pdq_sort3(begin + s2, begin, end - 1, pred, proj);
+
+                    // If the pivot equals the previous pivot, everything that
+                    // equals it is in its final place after one partition, and
+                    // only the greater elements remain.
+                    if(!leftmost && !pred(proj(*ranges::prev(begin)), proj(*begin)))
+                    {
+                        begin = ranges::next(detail::partition_left(begin, end, pred, proj));
+                        continue;
+                    }
+
+                    std::pair<I, bool> part = detail::pdq_partition(begin, end, pred, proj,
+                        branchless);
+                    I pivot_pos = part.first;
+                    D const l_size = pivot_pos - begin, r_size = end - (pivot_pos + 1);
+                    if(l_size < size / 8 || r_size < size / 8)
+                    {
+                        if(--bad_allowed == 0)
+                        {
+                            partial_sort(begin, end, end, std::ref(pred), std::ref(proj));
+                            return;
+                        }
+                        detail::pdq_break_pattern(begin, pivot_pos);
+                        detail::pdq_break_pattern(pivot_pos + 1, end);
+                    }
+                    else if(part.second &&
+                        detail::partial_insertion_sort(begin, pivot_pos, pred, proj) &&
+                        detail::partial_insertion_sort(pivot_pos + 1, end, pred, proj))
+                    {
+                        // The partition moved nothing and both halves turned out
+                        // to be (nearly) sorted already.
+                        return;
+                    }
+
+                    detail::pdqsort_loop(begin, pivot_pos, pred, proj, bad_allowed, leftmost,
+                        branchless);
+                    begin = pivot_pos + 1;
+                    leftmost = false;
+                }
+            }
+
+            // With Inclusive == false, selects the elements that are less than the
+            // pivot; with Inclusive == true, the ones that are not greater.
+            template<typename C, typename P, typename V, bool Inclusive>
+            struct pivot_compare
+            {
+                C &pred;
+                P &proj;
+                V &pivot;
+
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return Inclusive ?
+                        !pred(pivot, proj(static_cast<T &&>(t))) :
+                        pred(proj(static_cast<T &&>(t)), pivot);
+                }
+            };
+
+            template<typename I, typename F>
+            inline I partition_chunk(I begin, I end, F &left)
+            {
+                while(true)
+                {
+                    while(true)
+                    {
+                        if(begin == end)
+                            return begin;
+                        if(!left(*begin))
+                            break;
+                        ++begin;
+                    }
+                    do
+                    {
+                        if(begin == --end)
+                            return begin;
+                    } while(!left(*end));
+                    ranges::iter_swap(begin, end);
+                    ++begin;
+                }
+            }
+
+            // Position of the k-th element in a list of [first, last) index
+            // intervals, as an (interval, index) pair.
+            template<typename D>
+            inline std::pair<std::size_t, D>
+            seek_interval(std::vector<std::pair<D, D>> const &blocks, D k)
+            {
+                std::size_t b = 0;
+                for(; k >= blocks[b].second - blocks[b].first; ++b)
+                    k -= blocks[b].second - blocks[b].first;
+                return {b, blocks[b].first + k};
+            }
+
+            // Swaps the k-th element of `a` with the k-th element of `b` for
+            // every k in [from, to).
+            template<typename I, typename D>
+            inline void swap_intervals(I begin, std::vector<std::pair<D, D>> const &a,
+                std::vector<std::pair<D, D>> const &b, D from, D to)
+            {
+                std::pair<std::size_t, D> pa = detail::seek_interval(a, from),
+                    pb = detail::seek_interval(b, from);
+                while(true)
+                {
+                    D len = to - from;
+                    len = (std::min)(len, a[pa.first].second - pa.second);
+                    len = (std::min)(len, b[pb.first].second - pb.second);
+                    for(D i = 0; i < len; ++i)
+                        ranges::iter_swap(begin + (pa.second + i), begin + (pb.second + i));
+                    if((from += len) == to)
+                        return;
+                    if((pa.second += len) == a[pa.first].second)
+                        pa = detail::seek_interval(a, from);
+                    if((pb.second += len) == b[pb.first].second)
+                        pb = detail::seek_interval(b, from);
+                }
+            }
+
+            // Partitions [begin, end) with respect to the unary predicate `left`
+            // on the thread pool. Every chunk is partitioned independently, then
+            // the elements that ended up on the wrong side of the final split
+            // point are exchanged pairwise, again in parallel.
+            template<typename I, typename F>
+            I parallel_partition(I begin, I end, F &left)
+            {
+                using D = iterator_difference_t<I>;
+                using interval = std::pair<D, D>;
+                D const n = end - begin;
+                D const chunks = detail::parallel_chunk_count(n);
+                auto bound = [=](D k) { return n / chunks * k + (k < n % chunks ? k : n % chunks); };
+                std::vector<D> split(static_cast<std::size_t>(chunks));
+                detail::parallel_for(chunks, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        split[static_cast<std::size_t>(lo)] =
+                            detail::partition_chunk(begin + bound(lo), begin + bound(lo + 1), left)
+                                - begin;
+                }, D(1));
+
+                D mid = 0;
+                for(D k = 0; k < chunks; ++k)
+                    mid += split[static_cast<std::size_t>(k)] - bound(k);
+
+                // Elements that fail `left` but lie in [0, mid), and elements that
+                // satisfy it but lie in [mid, n):
+                std::vector<interval> wrong_left, wrong_right;
+                D misplaced = 0;
+                for(D k = 0; k < chunks; ++k)
+                {
+                    D const s = split[static_cast<std::size_t>(k)];
+                    if(s < mid)
+                    {
+                        wrong_left.emplace_back(s, (std::min)(mid, bound(k + 1)));
+                        misplaced += wrong_left.back().second - wrong_left.back().first;
+                    }
+                    if(s > mid)
+                        wrong_right.emplace_back((std::max)(mid, bound(k)), s);
+                }
+                if(misplaced != 0)
+                {
+                    detail::parallel_for(misplaced, [&](D lo, D hi)
+                    {
+                        detail::swap_intervals(begin, wrong_left, wrong_right, lo, hi);
+                    });
+                }
+                return begin + mid;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        // Pattern-defeating quicksort: quicksort that recognizes sorted runs
+        // and repeated keys, with heapsort as the fallback for inputs that
+        // keep producing bad partitions, and insertion sort below a certain
+        // threshold.
+        // TODO Forward iterators, like EoP?
+        struct sort_fn
+        {
+        private:
             template<typename Size>
             static Size log2(Size n)
             {
@@ -162,17 +633,77 @@ namespace ranges
                 return k;
             }
 
-            template<typename I, typename Size, typename C, typename P>
-            static void introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
+            // Ranges at most this long are sorted on a single thread.
+            static constexpr std::ptrdiff_t parallel_sort_threshold() { return 1 << 13; }
+            // Ranges longer than this are partitioned on the thread pool.
+            static constexpr std::ptrdiff_t parallel_partition_threshold() { return 1 << 16; }
+
+            template<typename I, typename C, typename P>
+            static void sequential_sort(I begin, I end, C &pred, P &proj)
+            {
+                if(end - begin < 2)
+                    return;
+                detail::pdqsort_loop(begin, end, pred, proj,
+                    static_cast<int>(sort_fn::log2(end - begin)), true,
+                    detail::pdq_branchless<I, C, P>{});
+            }
+
+            // Returns the [left end, right begin) of the range between the two
+            // halves that still need sorting; the elements in between are
+            // already in their final position.
+            template<typename I, typename C, typename P>
+            static std::pair<I, I> parallel_partition(I begin, I end, C &pred, P &proj)
             {
-                while(end - begin > sort_fn::introsort_threshold())
+                if(end - begin <= sort_fn::parallel_partition_threshold())
                 {
-                    if(depth_limit == 0)
-                        return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
                     I cut = detail::unguarded_partition(begin, end, pred, proj);
-                    sort_fn::introsort_loop(cut, end, --depth_limit, pred, proj);
-                    end = cut;
+                    return {cut, cut};
                 }
+                I mid = begin + (end - begin) / 2, last = ranges::prev(end);
+                {
+                    auto &&x = *begin, &&y = *mid, &&z = *last;
+                    auto &&a = proj((decltype(x) &&)x), &&b = proj((decltype(y) &&)y), &&c = proj((decltype(z) &&)z);
+                    I pivot_pnt = pred(a, b)
+                      ? (pred(b, c) ? mid   : (pred(a, c) ? last : begin))
+                      : (pred(a, c) ? begin : (pred(b, c) ? last : mid  ));
+                    if(pivot_pnt != begin)
+                        ranges::iter_swap(begin, pivot_pnt);
+                }
+                auto &&v = *begin;
+                auto &&pivot = proj((decltype(v) &&)v);
+                using V = meta::_t<std::remove_reference<decltype(pivot)>>;
+                detail::pivot_compare<C, P, V, false> less{pred, proj, pivot};
+                I split = detail::parallel_partition(ranges::next(begin), end, less);
+                if(split == ranges::next(begin))
+                {
+                    // Nothing is less than the pivot, so gather everything that is
+                    // equivalent to it; that run needs no more sorting.
+                    detail::pivot_compare<C, P, V, true> not_greater{pred, proj, pivot};
+                    return {begin, detail::parallel_partition(split, end, not_greater)};
+                }
+                I pos = ranges::prev(split);
+                ranges::iter_swap(begin, pos);
+                return {pos, split};
+            }
+
+            template<typename I, typename Size, typename C, typename P>
+            static void parallel_introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
+            {
+                if(end - begin <= sort_fn::parallel_sort_threshold() || depth_limit == 0)
+                {
+                    sort_fn::sequential_sort(begin, end, pred, proj);
+                    return;
+                }
+                --depth_limit;
+                std::pair<I, I> cut = sort_fn::parallel_partition(begin, end, pred, proj);
+                I left_end = cut.first, right = cut.second;
+                detail::parallel_invoke([=, &pred, &proj]
+                {
+                    sort_fn::parallel_introsort_loop(right, end, depth_limit, pred, proj);
+                }, [=, &pred, &proj]
+                {
+                    sort_fn::parallel_introsort_loop(begin, left_end, depth_limit, pred, proj);
+                });
             }
 
         public:
@@ -191,8 +722,7 @@ namespace ranges
                 if(begin == end_)
                     return begin;
                 I end = ranges::next(begin, end_);
-                sort_fn::introsort_loop(begin, end, sort_fn::log2(end - begin) * 2, pred, proj);
-                sort_fn::final_insertion_sort(begin, end, pred, proj);
+                sort_fn::sequential_sort(begin, end, pred, proj);
                 return end;
             }
 
@@ -207,6 +737,54 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// Sorts on the library's thread pool when `E` is a parallel policy:
+            /// large ranges are partitioned in parallel and the two halves are
+            /// sorted as independent tasks; every leaf is finished by the
+            /// sequential sort.
+            template<typename E, typename I, typename S, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value &&
+                    RandomAccessIterator<I>::value && IteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() &&
+                    RandomAccessIterator<I>() && IteratorRange<I, S>())>
+#endif
+            I operator()(E &&, I begin, S end_, C pred_ = C{}, P proj_ = P{}) const
+            {
+                if(!detail::is_parallel_policy<E>())
+                    return (*this)(begin, end_, std::move(pred_), std::move(proj_));
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                I end = ranges::next(begin, end_);
+                if(end - begin <= sort_fn::parallel_sort_threshold())
+                    sort_fn::sequential_sort(begin, end, pred, proj);
+                else
+                    sort_fn::parallel_introsort_loop(begin, end, sort_fn::log2(end - begin) * 2,
+                        pred, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value &&
+                    RandomAccessRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() &&
+                    RandomAccessRange<Rng>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `sort_fn`
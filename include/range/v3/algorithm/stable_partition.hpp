@@ -118,7 +118,8 @@ namespace ranges
             }
 
             template<typename I, typename S, typename C, typename P>
-            static I impl(I begin, S end, C pred, P proj, concepts::ForwardIterator *fi)
+            static I impl(I begin, S end, C pred, P proj, scratch_buffer<iterator_value_t<I>> *buf,
+                concepts::ForwardIterator *fi)
             {
                 using difference_type = iterator_difference_t<I>;
                 difference_type const alloc_limit = 3;  // might want to make this a function of trivial assignment
@@ -135,9 +136,12 @@ namespace ranges
                 // *begin is known to be false
                 using value_type = iterator_value_t<I>;
                 auto len_end = enumerate(begin, end);
-                auto p = len_end.first >= alloc_limit ?
-                    std::get_temporary_buffer<value_type>(len_end.first) : detail::value_init{};
-                std::unique_ptr<value_type, detail::return_temporary_buffer> const h{p.first};
+                std::pair<value_type *, std::ptrdiff_t> p{nullptr, 0};
+                std::unique_ptr<value_type, detail::return_temporary_buffer> h;
+                if(buf)
+                    p = {buf->data(), buf->capacity()};
+                else if(len_end.first >= alloc_limit)
+                    h.reset((p = std::get_temporary_buffer<value_type>(len_end.first)).first);
                 return stable_partition_fn::impl(begin, len_end.second, pred, proj, len_end.first, p, fi);
             }
 
@@ -228,7 +232,8 @@ namespace ranges
             }
 
             template<typename I, typename S, typename C, typename P>
-            static I impl(I begin, S end_, C pred, P proj, concepts::BidirectionalIterator *bi)
+            static I impl(I begin, S end_, C pred, P proj, scratch_buffer<iterator_value_t<I>> *buf,
+                concepts::BidirectionalIterator *bi)
             {
                 using difference_type = iterator_difference_t<I>;
                 using value_type = iterator_value_t<I>;
@@ -255,13 +260,24 @@ namespace ranges
                 // *end is known to be true
                 // len >= 2
                 auto len = distance(begin, end) + 1;
-                auto p = len >= alloc_limit ?
-                    std::get_temporary_buffer<value_type>(len) : detail::value_init{};
-                std::unique_ptr<value_type, detail::return_temporary_buffer> const h{p.first};
+                std::pair<value_type *, std::ptrdiff_t> p{nullptr, 0};
+                std::unique_ptr<value_type, detail::return_temporary_buffer> h;
+                if(buf)
+                    p = {buf->data(), buf->capacity()};
+                else if(len >= alloc_limit)
+                    h.reset((p = std::get_temporary_buffer<value_type>(len)).first);
                 return stable_partition_fn::impl(begin, end, pred, proj, len, p, bi);
             }
 
         public:
+            /// The number of objects a `scratch_buffer` must hold for the
+            /// overloads that take one to partition `n` elements without
+            /// falling back to rotations.
+            static constexpr std::ptrdiff_t buffer_size(std::ptrdiff_t n)
+            {
+                return n;
+            }
+
             template<typename I, typename S, typename C, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(StablePartitionable<I, C, P>::value && IteratorRange<I, S>::value)>
@@ -273,7 +289,7 @@ namespace ranges
                 auto &&pred = as_function(pred_);
                 auto &&proj = as_function(proj_);
                 return stable_partition_fn::impl(std::move(begin), std::move(end), std::ref(pred),
-                    std::ref(proj), iterator_concept<I>());
+                    std::ref(proj), nullptr, iterator_concept<I>());
             }
 
             // BUGBUG Can this be optimized if Rng has O1 size?
@@ -288,6 +304,37 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// Borrows `buf` instead of allocating a temporary buffer.
+            template<typename I, typename S, typename C, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>::value && IteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && IteratorRange<I, S>())>
+#endif
+            I operator()(I begin, S end, scratch_buffer<iterator_value_t<I>> &buf, C pred_,
+                P proj_ = P{}) const
+            {
+                auto &&pred = as_function(pred_);
+                auto &&proj = as_function(proj_);
+                return stable_partition_fn::impl(std::move(begin), std::move(end), std::ref(pred),
+                    std::ref(proj), &buf, iterator_concept<I>());
+            }
+
+            /// \overload
+            template<typename Rng, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>::value && Range<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && Range<Rng>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, scratch_buffer<iterator_value_t<I>> &buf,
+                C pred, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), buf, std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `stable_partition_fn`
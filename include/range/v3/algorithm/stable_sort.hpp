@@ -37,6 +37,7 @@
 #define RANGES_V3_ALGORITHM_STABLE_SORT_HPP
 
 #include <memory>
+#include <climits>
 #include <iterator>
 #include <algorithm>
 #include <functional>
@@ -53,6 +54,8 @@
 #include <range/v3/algorithm/merge_move.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/reverse.hpp>
+#include <range/v3/algorithm/aux_/gallop.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -61,6 +64,15 @@ namespace ranges
     {
         /// \addtogroup group-algorithms
         /// @{
+
+        /// Passed first to `stable_sort`, selects a natural merge sort that
+        /// finds the sorted (or descending) runs already in its
+        /// input and merges them, rather than sorting from scratch. Input made
+        /// of k sorted runs costs O(n log k) instead of O(n log n), and input
+        /// that is sorted already costs n - 1 comparisons.
+        struct natural_merge_t
+        {};
+
         struct stable_sort_fn
         {
             template<typename I, typename C, typename P>
@@ -149,7 +161,135 @@ namespace ranges
                     buffer, buffer_size, std::ref(pred), std::ref(proj));
             }
 
+            // The natural merge sort is TimSort's, with the merge order of
+            // powersort (Munro and Wild): each boundary between adjacent runs
+            // gets a power, the depth at which it would split the input in a
+            // perfectly balanced merge tree, and runs are merged when a later
+            // boundary has a lower power. That keeps the merge costs within
+            // a few percent of optimal for any lengths of runs.
+            static constexpr int natural_min_run() { return 32; }
+
+            // The end of the run that starts at begin, which is reversed
+            // first if it is descending. Reversing a descending run reverses
+            // its equal elements too, so each group of them is reversed back.
+            template<typename I, typename C, typename P>
+            static I natural_run(I begin, I end, C &pred, P &proj)
+            {
+                I i = ranges::next(begin);
+                if(i == end)
+                    return i;
+                if(pred(proj(*i), proj(*begin)))
+                {
+                    for(++i; i != end && !pred(proj(*(i - 1)), proj(*i)); ++i)
+                        ;
+                    ranges::reverse(begin, i);
+                    for(I j = begin, k; j != i; j = k)
+                    {
+                        for(k = j + 1; k != i && !pred(proj(*j), proj(*k)); ++k)
+                            ;
+                        ranges::reverse(j, k);
+                    }
+                }
+                else
+                {
+                    for(++i; i != end && !pred(proj(*i), proj(*(i - 1))); ++i)
+                        ;
+                }
+                return i;
+            }
+
+            // The power of the boundary between the runs [begin1, begin1 +
+            // len1) and [begin1 + len1, begin1 + len1 + len2) of n elements:
+            // the first bit at which the binary fractions of their midpoints,
+            // as fractions of n, differ.
+            template<typename D>
+            static int natural_power(D begin1, D len1, D len2, D n)
+            {
+                int power = 0;
+                D a = 2 * begin1 + len1, b = a + len1 + len2;
+                while(true)
+                {
+                    ++power;
+                    if(a >= n)
+                    {
+                        a -= n;
+                        b -= n;
+                    }
+                    else if(b >= n)
+                        return power;
+                    a *= 2;
+                    b *= 2;
+                }
+            }
+
+            // Merges two adjacent sorted runs. Galloping from the boundary
+            // first finds the elements of each that are in place already, so
+            // that runs which barely overlap cost little more than the search.
+            template<typename I, typename V, typename C, typename P>
+            static void natural_merge_runs(I begin, I middle, I end, V *buffer,
+                std::ptrdiff_t buffer_size, C &pred, P &proj)
+            {
+                begin = aux::gallop_upper_bound_n(begin, middle - begin, proj(*middle),
+                    std::ref(pred), std::ref(proj));
+                if(begin == middle)
+                    return;
+                end = aux::gallop_lower_bound_n(middle, end - middle, proj(*(middle - 1)),
+                    std::ref(pred), std::ref(proj));
+                detail::merge_adaptive(begin, middle, end, middle - begin, end - middle, buffer,
+                    buffer_size, std::ref(pred), std::ref(proj));
+            }
+
+            template<typename I, typename V, typename C, typename P>
+            static void natural_merge_sort(I begin, I end, V *buffer, std::ptrdiff_t buffer_size,
+                C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                // The powers on the stack increase from the bottom, so there
+                // are no more runs on it than bits in D.
+                struct run
+                {
+                    D begin;
+                    int power;
+                };
+                run stack[sizeof(D) * CHAR_BIT + 1];
+                int top = 0;
+                D const n = end - begin;
+                for(D i = 0; i != n;)
+                {
+                    D j = stable_sort_fn::natural_run(begin + i, end, pred, proj) - begin;
+                    if(j - i < stable_sort_fn::natural_min_run() && j != n)
+                    {
+                        j = std::min(n, i + stable_sort_fn::natural_min_run());
+                        detail::insertion_sort(begin + i, begin + j, pred, proj);
+                    }
+                    if(top != 0)
+                    {
+                        D const begin1 = stack[top - 1].begin;
+                        int const power =
+                            stable_sort_fn::natural_power(begin1, i - begin1, j - i, n);
+                        for(; top > 1 && stack[top - 2].power > power; --top)
+                            stable_sort_fn::natural_merge_runs(begin + stack[top - 2].begin,
+                                begin + stack[top - 1].begin, begin + i, buffer, buffer_size,
+                                pred, proj);
+                        stack[top - 1].power = power;
+                    }
+                    stack[top++] = run{i, 0};
+                    i = j;
+                }
+                for(; top > 1; --top)
+                    stable_sort_fn::natural_merge_runs(begin + stack[top - 2].begin,
+                        begin + stack[top - 1].begin, end, buffer, buffer_size, pred, proj);
+            }
+
         public:
+            /// The number of objects a `scratch_buffer` must hold for the
+            /// overloads that take one to sort `n` elements without falling
+            /// back to in-place merges.
+            static constexpr std::ptrdiff_t buffer_size(std::ptrdiff_t n)
+            {
+                return (n + 1) / 2;
+            }
+
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(Sortable<I, C, P>::value && RandomAccessIterator<I>::value &&
@@ -186,6 +326,92 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// Sorts with the natural merge sort, which `natural_merge`
+            /// selects.
+            template<typename N, typename I, typename S, typename C = ordered_less,
+                typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Same<uncvref_t<N>, natural_merge_t>::value),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value && RandomAccessIterator<I>::value &&
+                    IteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(Same<uncvref_t<N>, natural_merge_t>()),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+#endif
+            I operator()(N &&, I begin, S end_, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto && pred = as_function(pred_);
+                auto && proj = as_function(proj_);
+                I end = ranges::next(begin, end_);
+                using V = iterator_value_t<I>;
+                // The longer run of a merge can be most of the input, but the
+                // shorter one is never more than half of it, and that is the
+                // one merge_adaptive moves to the buffer.
+                auto const len = end - begin;
+                auto buf = len > 256 ? std::get_temporary_buffer<V>(len / 2) : detail::value_init{};
+                std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                stable_sort_fn::natural_merge_sort(begin, end, buf.first, buf.second, pred, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename N, typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Same<uncvref_t<N>, natural_merge_t>::value),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value && RandomAccessRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(Same<uncvref_t<N>, natural_merge_t>()),
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessRange<Rng>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(N &&natural, Rng &&rng, C pred = C{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<N &&>(natural), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
+
+            /// \overload
+            /// Borrows `buf` instead of allocating a temporary buffer.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value && RandomAccessIterator<I>::value &&
+                    IteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+#endif
+            I operator()(I begin, S end_, scratch_buffer<iterator_value_t<I>> &buf,
+                C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto && pred = as_function(pred_);
+                auto && proj = as_function(proj_);
+                I end = ranges::next(begin, end_);
+                using D = iterator_difference_t<I>;
+                if(buf.capacity() == 0)
+                    stable_sort_fn::inplace_stable_sort(begin, end, pred, proj);
+                else
+                    stable_sort_fn::stable_sort_adaptive(begin, end, buf.data(), D(buf.capacity()),
+                        pred, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Sortable<I, C, P>::value && RandomAccessRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessRange<Rng>())>
+#endif
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, scratch_buffer<iterator_value_t<I>> &buf,
+                C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), buf, std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `stable_sort_fn`
@@ -195,6 +421,13 @@ namespace ranges
             constexpr auto&& stable_sort = static_const<with_braced_init_args<stable_sort_fn>>::value;
         }
 
+        /// \sa `natural_merge_t`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& natural_merge = static_const<natural_merge_t>::value;
+        }
+
         /// @}
     } // namespace v3
 } // namespace ranges
@@ -28,6 +28,8 @@
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/utility/tagged_tuple.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/for_each_index.hpp>
 
 namespace ranges
 {
@@ -63,6 +65,69 @@ namespace ranges
         /// @{
         struct transform_fn
         {
+        private:
+            template<typename O, typename F, typename P>
+            struct segment_fn
+            {
+                O &out;
+                F &fun;
+                P &proj;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    auto res = transform_fn::impl1(std::move(begin), std::move(end),
+                        std::move(out), fun, proj, detail::is_segmented<L, LS>{});
+                    out = res.out();
+                    return res.in();
+                }
+            };
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl1(I begin, S end, O out, F &fun, P &proj, std::true_type)
+            {
+                segment_fn<O, F, P> seg{out, fun, proj};
+                begin = detail::for_each_segment(std::move(begin), end, seg);
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl1(I begin, S end, O out, F &fun, P &proj, std::false_type)
+            {
+                for(; begin != end; ++begin, ++out)
+                    *out = fun(proj(*begin));
+                return {begin, out};
+            }
+            template<typename O, typename F, typename P>
+            struct index_sink
+            {
+                O &out;
+                F &fun;
+                P &proj;
+                template<typename T>
+                void operator()(T &&t) const
+                {
+                    *out = fun(proj(static_cast<T &&>(t)));
+                    ++out;
+                }
+            };
+            // A zip of sized random-access ranges is walked with one index
+            // (see detail/for_each_index.hpp).
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            indexed(Rng &rng, O out, F &fun, P &proj, std::true_type)
+            {
+                index_sink<O, F, P> sink{out, fun, proj};
+                detail::for_each_index(rng, sink);
+                return {end(rng), out};
+            }
+            template<typename Rng, typename O, typename F, typename P>
+            static tagged_pair<tag::in(range_iterator_t<Rng>), tag::out(O)>
+            indexed(Rng &rng, O out, F &fun, P &proj, std::false_type)
+            {
+                return transform_fn::impl1(begin(rng), end(rng), std::move(out), fun, proj,
+                    detail::is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>{});
+            }
+        public:
             // Single-range variant
             template<typename I, typename S, typename O, typename F, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
@@ -74,9 +139,8 @@ namespace ranges
             {
                 auto &&fun = as_function(fun_);
                 auto &&proj = as_function(proj_);
-                for(; begin != end; ++begin, ++out)
-                    *out = fun(proj(*begin));
-                return {begin, out};
+                return transform_fn::impl1(std::move(begin), std::move(end), std::move(out),
+                    fun, proj, detail::is_segmented<I, S>{});
             }
 
             template<typename Rng, typename O, typename F, typename P = ident,
@@ -87,9 +151,12 @@ namespace ranges
                 CONCEPT_REQUIRES_(Range<Rng>() && Transformable1<I, O, F, P>())>
 #endif
             tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
-            operator()(Rng &&rng, O out, F fun, P proj = P{}) const
+            operator()(Rng &&rng, O out, F fun_, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out), std::move(fun), std::move(proj));
+                auto &&fun = as_function(fun_);
+                auto &&proj = as_function(proj_);
+                return transform_fn::indexed(rng, std::move(out), fun, proj,
+                    detail::index_bounded<Rng>{});
             }
 
             // Double-range variant, 4-iterator version
@@ -167,6 +234,59 @@ namespace ranges
                 return (*this)(begin(rng0), end(rng0), std::forward<I1Ref>(begin1), unreachable{},
                     std::move(out), std::move(fun), std::move(proj0), std::move(proj1));
             }
+
+            // Single-range variant with an execution policy. With a parallel
+            // policy, chunks of the input are transformed concurrently into the
+            // corresponding chunks of the output.
+            template<typename E, typename I, typename S, typename O, typename F, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && RandomAccessIterator<O>::value &&
+                    Transformable1<I, O, F, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                    SizedIteratorRange<I, S>() && RandomAccessIterator<O>() &&
+                    Transformable1<I, O, F, P>())>
+#endif
+            tagged_pair<tag::in(I), tag::out(O)> operator()(E &&, I begin, S end, O out, F fun_,
+                P proj_ = P{}) const
+            {
+                if(!detail::is_parallel_policy<E>())
+                    return (*this)(begin, end, std::move(out), std::move(fun_), std::move(proj_));
+                using D = iterator_difference_t<I>;
+                auto &&fun = as_function(fun_);
+                auto &&proj = as_function(proj_);
+                D const n = end - begin;
+                detail::parallel_for(n, [&](D lo, D hi)
+                {
+                    O o = out + static_cast<iterator_difference_t<O>>(lo);
+                    for(I i = begin + lo, e = begin + hi; i != e; ++i, ++o)
+                        *o = fun(proj(*i));
+                });
+                return {begin + n, out + static_cast<iterator_difference_t<O>>(n)};
+            }
+
+            template<typename E, typename Rng, typename O, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value &&
+                    SizedRange<Rng>::value && RandomAccessIterator<O>::value &&
+                    Transformable1<I, O, F, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() &&
+                    SizedRange<Rng>() && RandomAccessIterator<O>() &&
+                    Transformable1<I, O, F, P>())>
+#endif
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(E &&policy, Rng &&rng, O out, F fun, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(out),
+                    std::move(fun), std::move(proj));
+            }
         };
 
         /// \sa `transform_fn`
@@ -0,0 +1,447 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_UNORDERED_SET_ALGORITHM_HPP
+#define RANGES_V3_ALGORITHM_UNORDERED_SET_ALGORITHM_HPP
+
+#include <cstddef>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/utility/tagged_tuple.hpp>
+#include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/detail/flat_hash.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// The elements of the range of `I2`, projected with `P2`, are the
+        /// keys of a hash table; those of the range of `I1`, projected with
+        /// `P1`, are converted to that key type and looked up.
+        template<typename I1, typename I2, typename H = detail::std_hash,
+            typename Eq = equal_to, typename P1 = ident, typename P2 = ident,
+            typename K = iterator_value_t<Project<I2, P2>>>
+        using HashComparable = meta::fast_and<
+            InputIterator<I1>,
+            InputIterator<I2>,
+            ConvertibleTo<iterator_reference_t<Project<I1, P1>>, K>,
+            Constructible<K, iterator_reference_t<Project<I2, P2>>>,
+            Callable<H, K const &>,
+            Relation<Eq, K const &, K const &>>;
+
+        /// For the algorithms that write elements of the first range only.
+        template<typename I1, typename I2, typename Out, typename H = detail::std_hash,
+            typename Eq = equal_to, typename P1 = ident, typename P2 = ident>
+        using HashFilterable = meta::fast_and<
+            HashComparable<I1, I2, H, Eq, P1, P2>,
+            WeaklyIncrementable<Out>,
+            IndirectlyCopyable<I1, Out>>;
+
+        template<typename I1, typename I2, typename Out, typename H = detail::std_hash,
+            typename Eq = equal_to, typename P1 = ident, typename P2 = ident>
+        using HashMergeable = meta::fast_and<
+            HashFilterable<I1, I2, Out, H, Eq, P1, P2>,
+            IndirectlyCopyable<I2, Out>>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(SizedIteratorRange<I, S>::value)>
+#else
+                CONCEPT_REQUIRES_(SizedIteratorRange<I, S>())>
+#endif
+            std::size_t expected_size_(I const &begin, S const &end, int)
+            {
+                return static_cast<std::size_t>(end - begin);
+            }
+            template<typename I, typename S>
+            std::size_t expected_size_(I const &, S const &, long)
+            {
+                return 0;
+            }
+
+            // Counts the projected elements of [begin, end) in a hash table.
+            template<typename I, typename S, typename H, typename Eq, typename P,
+                typename K = iterator_value_t<Project<I, P>>>
+            flat_hash_counter<K, H, Eq> count_keys(I begin, S end, H &hash, Eq &eq, P &proj)
+            {
+                flat_hash_counter<K, H, Eq> table{detail::expected_size_(begin, end, 42), hash,
+                    eq};
+                for(; begin != end; ++begin)
+                    table.add(proj(*begin));
+                return table;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        // The unordered_ set algorithms give the results of the set algorithms
+        // of set_algorithm.hpp, with the same multiplicities, for inputs that
+        // aren't sorted: where the sorted versions take a strict weak order,
+        // these take a hash function and an equivalence. One input is counted
+        // in a flat hash table (see detail/flat_hash.hpp), the other streamed
+        // past it, in O(N + M) time and O(M) space where the sorted versions
+        // would first need both inputs sorted. Elements are written in the
+        // order they are met.
+
+        /// Whether every element of the second range, counted with
+        /// multiplicity, is equivalent to one of the first.
+        struct unordered_includes_fn
+        {
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashComparable<I2, I1, H, Eq, P2, P1>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashComparable<I2, I1, H, Eq, P2, P1>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            bool operator()(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                H hash_ = H{}, Eq eq_ = Eq{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                using K = iterator_value_t<Project<I1, P1>>;
+                auto &&hash = as_function(hash_);
+                auto &&eq = as_function(eq_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                auto table = detail::count_keys(std::move(begin1), std::move(end1), hash, eq,
+                    proj1);
+                for(; begin2 != end2; ++begin2)
+                    if(!table.take(static_cast<K const &>(proj2(*begin2))))
+                        return false;
+                return true;
+            }
+
+            template<typename Rng1, typename Rng2, typename H = detail::std_hash,
+                typename Eq = equal_to, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashComparable<I2, I1, H, Eq, P2, P1>::value &&
+                    Range<Rng1>::value && Range<Rng2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashComparable<I2, I1, H, Eq, P2, P1>() &&
+                    Range<Rng1>() && Range<Rng2>())>
+#endif
+            bool operator()(Rng1 && rng1, Rng2 && rng2,
+                H hash = H{}, Eq eq = Eq{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(hash),
+                    std::move(eq), std::move(proj1), std::move(proj2));
+            }
+        };
+
+        /// \sa `unordered_includes_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& unordered_includes =
+                static_const<with_braced_init_args<unordered_includes_fn>>::value;
+        }
+
+        /// Writes the elements of the first range, then those of the second
+        /// that outnumber their equivalents in the first.
+        struct unordered_set_union_fn
+        {
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    ForwardIterator<I2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>() &&
+                    ForwardIterator<I2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                H hash_ = H{}, Eq eq_ = Eq{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                using K = iterator_value_t<Project<I2, P2>>;
+                auto &&hash = as_function(hash_);
+                auto &&eq = as_function(eq_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                auto table = detail::count_keys(begin2, end2, hash, eq, proj2);
+                for(; begin1 != end1; ++begin1, ++out)
+                {
+                    table.take(static_cast<K const &>(proj1(*begin1)));
+                    *out = *begin1;
+                }
+                for(; begin2 != end2; ++begin2)
+                {
+                    if(table.take(static_cast<K const &>(proj2(*begin2))))
+                    {
+                        *out = *begin2;
+                        ++out;
+                    }
+                }
+                return tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>{begin1, begin2,
+                    out};
+            }
+
+            template<typename Rng1, typename Rng2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    Range<Rng1>::value && ForwardRange<Rng2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>() &&
+                    Range<Rng1>() && ForwardRange<Rng2>())>
+#endif
+            tagged_tuple<tag::in1(range_safe_iterator_t<Rng1>),
+                tag::in2(range_safe_iterator_t<Rng2>), tag::out(O)>
+            operator()(Rng1 &&rng1, Rng2 &&rng2, O out,
+                H hash = H{}, Eq eq = Eq{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(out),
+                    std::move(hash), std::move(eq), std::move(proj1), std::move(proj2));
+            }
+        };
+
+        /// \sa `unordered_set_union_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& unordered_set_union =
+                static_const<with_braced_init_args<unordered_set_union_fn>>::value;
+        }
+
+        /// Writes the elements of the first range that are matched by as
+        /// many equivalents in the second.
+        struct unordered_set_intersection_fn
+        {
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            O operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                H hash_ = H{}, Eq eq_ = Eq{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                using K = iterator_value_t<Project<I2, P2>>;
+                auto &&hash = as_function(hash_);
+                auto &&eq = as_function(eq_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                auto table = detail::count_keys(std::move(begin2), std::move(end2), hash, eq,
+                    proj2);
+                for(; begin1 != end1; ++begin1)
+                {
+                    if(table.take(static_cast<K const &>(proj1(*begin1))))
+                    {
+                        *out = *begin1;
+                        ++out;
+                    }
+                }
+                return out;
+            }
+
+            template<typename Rng1, typename Rng2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    Range<Rng1>::value && Range<Rng2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>() &&
+                    Range<Rng1>() && Range<Rng2>())>
+#endif
+            O operator()(Rng1 && rng1, Rng2 && rng2, O out,
+                H hash = H{}, Eq eq = Eq{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(out),
+                    std::move(hash), std::move(eq), std::move(proj1), std::move(proj2));
+            }
+        };
+
+        /// \sa `unordered_set_intersection_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& unordered_set_intersection =
+                static_const<with_braced_init_args<unordered_set_intersection_fn>>::value;
+        }
+
+        /// Writes the elements of the first range that outnumber their
+        /// equivalents in the second.
+        struct unordered_set_difference_fn
+        {
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            tagged_pair<tag::in1(I1), tag::out(O)> operator()(I1 begin1, S1 end1, I2 begin2,
+                S2 end2, O out, H hash_ = H{}, Eq eq_ = Eq{}, P1 proj1_ = P1{},
+                P2 proj2_ = P2{}) const
+            {
+                using K = iterator_value_t<Project<I2, P2>>;
+                auto &&hash = as_function(hash_);
+                auto &&eq = as_function(eq_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                auto table = detail::count_keys(std::move(begin2), std::move(end2), hash, eq,
+                    proj2);
+                for(; begin1 != end1; ++begin1)
+                {
+                    if(!table.take(static_cast<K const &>(proj1(*begin1))))
+                    {
+                        *out = *begin1;
+                        ++out;
+                    }
+                }
+                return {begin1, out};
+            }
+
+            template<typename Rng1, typename Rng2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    Range<Rng1>::value && Range<Rng2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashFilterable<I1, I2, O, H, Eq, P1, P2>() &&
+                    Range<Rng1>() && Range<Rng2>())>
+#endif
+            tagged_pair<tag::in1(range_safe_iterator_t<Rng1>), tag::out(O)>
+            operator()(Rng1 &&rng1, Rng2 && rng2, O out,
+                H hash = H{}, Eq eq = Eq{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(out),
+                    std::move(hash), std::move(eq), std::move(proj1), std::move(proj2));
+            }
+        };
+
+        /// \sa `unordered_set_difference_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& unordered_set_difference =
+                static_const<with_braced_init_args<unordered_set_difference_fn>>::value;
+        }
+
+        /// Writes the elements of the first range that outnumber their
+        /// equivalents in the second, then those of the second that outnumber
+        /// theirs in the first.
+        struct unordered_set_symmetric_difference_fn
+        {
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    ForwardIterator<I2>::value &&
+                    IteratorRange<I1, S1>::value && IteratorRange<I2, S2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>() &&
+                    ForwardIterator<I2>() &&
+                    IteratorRange<I1, S1>() && IteratorRange<I2, S2>())>
+#endif
+            tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>
+            operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                H hash_ = H{}, Eq eq_ = Eq{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                using K = iterator_value_t<Project<I2, P2>>;
+                auto &&hash = as_function(hash_);
+                auto &&eq = as_function(eq_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                auto table = detail::count_keys(begin2, end2, hash, eq, proj2);
+                for(; begin1 != end1; ++begin1)
+                {
+                    if(!table.take(static_cast<K const &>(proj1(*begin1))))
+                    {
+                        *out = *begin1;
+                        ++out;
+                    }
+                }
+                for(; begin2 != end2; ++begin2)
+                {
+                    if(table.take(static_cast<K const &>(proj2(*begin2))))
+                    {
+                        *out = *begin2;
+                        ++out;
+                    }
+                }
+                return tagged_tuple<tag::in1(I1), tag::in2(I2), tag::out(O)>{begin1, begin2,
+                    out};
+            }
+
+            template<typename Rng1, typename Rng2, typename O,
+                typename H = detail::std_hash, typename Eq = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>::value &&
+                    Range<Rng1>::value && ForwardRange<Rng2>::value)>
+#else
+                CONCEPT_REQUIRES_(HashMergeable<I1, I2, O, H, Eq, P1, P2>() &&
+                    Range<Rng1>() && ForwardRange<Rng2>())>
+#endif
+            tagged_tuple<tag::in1(range_safe_iterator_t<Rng1>),
+                tag::in2(range_safe_iterator_t<Rng2>), tag::out(O)>
+            operator()(Rng1 &&rng1, Rng2 &&rng2, O out,
+                H hash = H{}, Eq eq = Eq{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(out),
+                    std::move(hash), std::move(eq), std::move(proj1), std::move(proj2));
+            }
+        };
+
+        /// \sa `unordered_set_symmetric_difference_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& unordered_set_symmetric_difference =
+                static_const<with_braced_init_args<unordered_set_symmetric_difference_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -33,5 +33,6 @@
 #include <range/v3/size.hpp>
 #include <range/v3/to_container.hpp>
 #include <range/v3/utility/common_iterator.hpp>
+#include <range/v3/utility/contiguous.hpp>
 
 #endif
@@ -0,0 +1,85 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_BULK_READ_HPP
+#define RANGES_V3_DETAIL_BULK_READ_HPP
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A cursor may offer
+            //
+            //     std::ptrdiff_t read_n(S const &end, V *out, std::ptrdiff_t n);
+            //
+            // which copies up to n elements into out, steps past them, and
+            // returns how many it copied; fewer than n means it reached end.
+            // Algorithms that visit every element of a range use it to fetch
+            // elements a block at a time, which matters when each step is an
+            // indirect call, as it is for any_view. Only iterators whose
+            // reference is a prvalue qualify: a block holds copies, so writes
+            // through an lvalue reference would be lost.
+            template<typename I, typename S, typename Enable = void>
+            struct is_bulk_readable
+              : std::false_type
+            {};
+
+            template<typename Cur, typename S>
+            struct is_bulk_readable<basic_iterator<Cur, S>, basic_sentinel<S>,
+                meta::void_<decltype(range_access::read_n(
+                    std::declval<basic_iterator<Cur, S> &>(),
+                    std::declval<basic_sentinel<S> const &>(),
+                    std::declval<iterator_value_t<basic_iterator<Cur, S>> *>(),
+                    std::ptrdiff_t{}))>>
+              : meta::not_<std::is_reference<iterator_reference_t<basic_iterator<Cur, S>>>>
+            {};
+
+            constexpr std::ptrdiff_t bulk_read_size()
+            {
+                return 64;
+            }
+
+            // Calls fun with an lvalue of every element in [begin, end) and
+            // returns the iterator that compares equal to end.
+            template<typename I, typename S, typename F>
+            I bulk_read(I begin, S const &end, F &&fun)
+            {
+                iterator_value_t<I> block[bulk_read_size()];
+                while(true)
+                {
+                    std::ptrdiff_t const n =
+                        range_access::read_n(begin, end, block, bulk_read_size());
+                    for(std::ptrdiff_t i = 0; i != n; ++i)
+                        fun(block[i]);
+                    if(n != bulk_read_size())
+                        return begin;
+                }
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
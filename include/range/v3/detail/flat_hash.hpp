@@ -0,0 +1,170 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_FLAT_HASH_HPP
+#define RANGES_V3_DETAIL_FLAT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The default hash of the unordered set algorithms.
+            struct std_hash
+            {
+                template<typename T>
+                std::size_t operator()(T const &t) const
+                {
+                    return std::hash<T>{}(t);
+                }
+            };
+
+            // Spreads the bits of a hash, so that hashes that differ only in
+            // their high bits (or, like std::hash of an integer, are the value
+            // itself) still fill an open-addressing table evenly.
+            inline std::uint64_t mix_hash(std::uint64_t h)
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdull;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ull;
+                h ^= h >> 33;
+                return h;
+            }
+
+            // A multiset of keys, as a count for each distinct key, in an
+            // open-addressing hash table. The keys and their counts are kept
+            // in insertion order in two arrays; the table itself is an array
+            // of 64-bit slots, each the index of a key plus one (zero when
+            // empty) and, in the upper half, 32 bits of the key's hash. A
+            // probe walks consecutive slots and compares a key only when the
+            // stored bits of its hash match, so a lookup typically touches one
+            // cache line of the table and one key. The table is kept at most
+            // half full.
+            template<typename K, typename H, typename Eq>
+            struct flat_hash_counter
+            {
+            private:
+                std::vector<std::uint64_t> slots_;
+                std::vector<K> keys_;
+                std::vector<std::size_t> counts_;
+                H hash_;
+                Eq eq_;
+
+                static std::size_t capacity_for(std::size_t n)
+                {
+                    std::size_t cap = 16;
+                    while(cap < 2 * n)
+                        cap *= 2;
+                    return cap;
+                }
+                template<typename T>
+                std::uint64_t hash_of(T const &t)
+                {
+                    return detail::mix_hash(static_cast<std::uint64_t>(hash_(t)));
+                }
+                // The slot that holds t, or the empty slot where it would go.
+                template<typename T>
+                std::size_t probe(T const &t, std::uint64_t h) const
+                {
+                    std::size_t const mask = slots_.size() - 1;
+                    std::uint64_t const tag = h >> 32;
+                    for(std::size_t i = static_cast<std::size_t>(h) & mask;; i = (i + 1) & mask)
+                    {
+                        std::uint64_t const s = slots_[i];
+                        if(s == 0 || ((s >> 32) == tag &&
+                            eq_(keys_[static_cast<std::size_t>(s & 0xffffffffu) - 1], t)))
+                            return i;
+                    }
+                }
+                void grow()
+                {
+                    std::vector<std::uint64_t> slots(slots_.size() * 2, 0);
+                    std::size_t const mask = slots.size() - 1;
+                    for(std::uint64_t s : slots_)
+                    {
+                        if(s == 0)
+                            continue;
+                        std::uint64_t const h =
+                            hash_of(keys_[static_cast<std::size_t>(s & 0xffffffffu) - 1]);
+                        std::size_t i = static_cast<std::size_t>(h) & mask;
+                        while(slots[i] != 0)
+                            i = (i + 1) & mask;
+                        slots[i] = s;
+                    }
+                    slots_ = std::move(slots);
+                }
+            public:
+                // Room for n distinct keys without rehashing.
+                explicit flat_hash_counter(std::size_t n, H hash = H{}, Eq eq = Eq{})
+                  : slots_(capacity_for(n), 0)
+                  , hash_(std::move(hash))
+                  , eq_(std::move(eq))
+                {
+                    keys_.reserve(n);
+                    counts_.reserve(n);
+                }
+                // Counts one more t.
+                template<typename T>
+                void add(T &&t)
+                {
+                    std::uint64_t const h = hash_of(t);
+                    std::size_t const i = probe(t, h);
+                    if(slots_[i] != 0)
+                    {
+                        ++counts_[static_cast<std::size_t>(slots_[i] & 0xffffffffu) - 1];
+                        return;
+                    }
+                    RANGES_ASSERT(keys_.size() < 0xffffffffu);
+                    keys_.emplace_back(std::forward<T>(t));
+                    counts_.push_back(1);
+                    slots_[i] = (h >> 32 << 32) | static_cast<std::uint64_t>(keys_.size());
+                    if(2 * keys_.size() > slots_.size())
+                        grow();
+                }
+                // The count of t, which may be changed, or null if t was never
+                // added.
+                template<typename T>
+                std::size_t *find(T const &t)
+                {
+                    std::uint64_t const s = slots_[probe(t, hash_of(t))];
+                    return s == 0 ? nullptr : &counts_[static_cast<std::size_t>(s & 0xffffffffu) - 1];
+                }
+                // Counts one fewer t if its count is above zero, and returns
+                // whether it was.
+                template<typename T>
+                bool take(T const &t)
+                {
+                    std::size_t *const c = find(t);
+                    if(c == nullptr || *c == 0)
+                        return false;
+                    --*c;
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
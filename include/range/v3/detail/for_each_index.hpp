@@ -0,0 +1,78 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_FOR_EACH_INDEX_HPP
+#define RANGES_V3_DETAIL_FOR_EACH_INDEX_HPP
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Indexed iteration. A view whose elements are each worked out
+            // from the same index into several sized random-access ranges
+            // (view::zip, view::zip_with) may offer
+            //
+            //     auto spans();
+            //
+            // (and a const overload) returning an object x with x.size() and
+            // x[i], its i-th element; see zip_spans. Terminal algorithms that
+            // consume the whole of such a range, with no way to stop early,
+            // walk it with
+            //
+            //     for(i = 0; i != n; ++i) ... x[i] ...
+            //
+            // The loop tests one counter against a size computed once, rather
+            // than an iterator into each range against its end, and reads each
+            // range at base + i: a loop the compiler can vectorize.
+            template<typename Rng, typename Enable = void>
+            struct is_indexable
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_indexable<Rng,
+                meta::void_<decltype(std::declval<Rng &>().spans())>>
+              : std::true_type
+            {};
+
+            // Indexable ranges that are also bounded, so that an algorithm
+            // can return their end.
+            template<typename Rng>
+            using index_bounded = meta::bool_<is_indexable<Rng>::value &&
+                BoundedRange<Rng>::value>;
+
+            // Calls body with each element of rng, which must be indexable.
+            template<typename Rng, typename Body>
+            void for_each_index(Rng &rng, Body &body)
+            {
+                auto const x = rng.spans();
+                std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(x.size());
+                for(std::ptrdiff_t i = 0; i != n; ++i)
+                    body(x[i]);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,152 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_FOR_EACH_UNTIL_HPP
+#define RANGES_V3_DETAIL_FOR_EACH_UNTIL_HPP
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/utility/functional.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Push-based iteration. A view may offer
+            //
+            //     template<typename Sink>
+            //     bool for_each_until(Sink &sink);
+            //
+            // (and a const overload) which calls sink(x) with each of its
+            // elements in order until sink returns true, and returns whether
+            // sink stopped it. The view drives the loop: an adaptor wraps sink
+            // in one that does its own work (applies a function, tests a
+            // predicate, walks an inner range) and hands that to its base. So
+            // the loop that runs is the one of the underlying container, with
+            // the adaptors' work inlined into its body, instead of a chain of
+            // cursors each testing for its end.
+            //
+            // Terminal algorithms that consume a whole range use it when the
+            // range offers it. Ranges that don't are walked with their
+            // iterators.
+            struct push_probe
+            {
+                template<typename T>
+                bool operator()(T &&) const
+                {
+                    return false;
+                }
+            };
+
+            template<typename Rng, typename Enable = void>
+            struct is_pushable
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_pushable<Rng,
+                meta::void_<decltype(std::declval<Rng &>().for_each_until(
+                    std::declval<push_probe &>()))>>
+              : std::true_type
+            {};
+
+            // join and concat are both pushable and segmented. Algorithms that can run their own loop
+            // over each segment (for_each, copy, accumulate) do better that
+            // way when the segments are contiguous, so they push only ranges
+            // that aren't segmented.
+            template<typename Rng>
+            using push_unsegmented = meta::bool_<is_pushable<Rng>::value &&
+                !is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>::value>;
+
+            template<typename Rng, typename Sink>
+            bool for_each_until_(Rng &rng, Sink &sink, std::true_type)
+            {
+                return rng.for_each_until(sink);
+            }
+            template<typename Rng, typename Sink>
+            bool for_each_until_(Rng &rng, Sink &sink, std::false_type)
+            {
+                auto it = ranges::begin(rng);
+                auto const end = ranges::end(rng);
+                for(; it != end; ++it)
+                    if(sink(*it))
+                        return true;
+                return false;
+            }
+
+            // Calls sink with each element of rng until it returns true.
+            // Returns whether it did.
+            template<typename Rng, typename Sink>
+            bool for_each_until(Rng &rng, Sink &sink)
+            {
+                return detail::for_each_until_(rng, sink, is_pushable<Rng>{});
+            }
+
+            // view::transform and view::take_while are built on iterator
+            // functions wrapped in indirected, which only dereference their
+            // arguments. Such a function can be given a pushed element through
+            // this stand-in for an iterator.
+            template<typename Ref>
+            struct pushed_ref
+            {
+                meta::_t<std::remove_reference<Ref>> *ptr;
+                Ref operator*() const
+                {
+                    return static_cast<Ref>(*ptr);
+                }
+            };
+
+            template<typename T>
+            pushed_ref<T &&> push_ref(T &&t)
+            {
+                return {std::addressof(t)};
+            }
+
+            // Views whose elements come from ranges of different types (concat,
+            // join with a separator) pass them on as their own reference type,
+            // as their iterators would.
+            template<typename Ref, typename Sink>
+            struct convert_sink
+            {
+                Sink &sink;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return sink(static_cast<Ref>(static_cast<T &&>(t)));
+                }
+            };
+
+            template<typename Fun>
+            struct is_indirected
+              : std::false_type
+            {};
+
+            template<typename Fun>
+            struct is_indirected<indirected<Fun>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+    }
+}
+
+#endif
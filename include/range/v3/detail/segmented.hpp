@@ -0,0 +1,92 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SEGMENTED_HPP
+#define RANGES_V3_DETAIL_SEGMENTED_HPP
+
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Flattening views such as join and concat are made of segments:
+            // runs of elements that are adjacent in some underlying range, and
+            // so can be traversed with that range's own (local) iterators. A
+            // cursor of such a view may offer
+            //
+            //     template<typename F>
+            //     void for_each_segment(E const &end, F &fun);
+            //
+            // where E is its end cursor or sentinel type. It calls
+            //
+            //     L fun(L local_begin, LS local_end);
+            //
+            // for each segment of the elements from its position up to end, in
+            // order, where [local_begin, local_end) are the local iterator and
+            // sentinel of that segment. fun returns the position at which it
+            // stopped. If that is local_end, the cursor goes on to the next
+            // segment; otherwise it comes to rest at that element. Either way
+            // the cursor ends up where fun stopped, or at end.
+            //
+            // This is Austern's segmented-iterator protocol with the
+            // segment iterator kept inside the cursor: the cursor knows how to
+            // step from one segment to the next and how to turn a local
+            // position back into one of its own. Algorithms that use it run
+            // their ordinary loop over each segment, which is free of the
+            // per-element segment-boundary test and, for concat, of the variant
+            // dispatch. As local iterators may be segmented themselves, they
+            // recurse.
+            struct segment_probe
+            {
+                template<typename L, typename LS>
+                L operator()(L begin, LS) const
+                {
+                    return begin;
+                }
+            };
+
+            template<typename I, typename S, typename Enable = void>
+            struct is_segmented
+              : std::false_type
+            {};
+
+            template<typename I, typename S>
+            struct is_segmented<I, S,
+                meta::void_<decltype(range_access::for_each_segment(std::declval<I &>(),
+                    std::declval<S const &>(), std::declval<segment_probe &>()))>>
+              : std::true_type
+            {};
+
+            // Calls fun for each segment of [begin, end) and returns the
+            // position at which fun stopped, or end.
+            template<typename I, typename S, typename F>
+            I for_each_segment(I begin, S const &end, F &fun)
+            {
+                range_access::for_each_segment(begin, end, fun);
+                return begin;
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
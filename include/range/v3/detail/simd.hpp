@@ -0,0 +1,425 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SIMD_HPP
+#define RANGES_V3_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/contiguous.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+// Define RANGES_DISABLE_SIMD to make the algorithms below use only the
+// portable loops (and memchr and memcmp).
+#if !defined(RANGES_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define RANGES_SIMD_X86
+#include <immintrin.h>
+#define RANGES_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // find, count, equal, mismatch and adjacent_find hand ranges of
+            // integers that they compare with plain `==` to the kernels in
+            // namespace simd. The kernels see only pointers; the traits below
+            // decide when an algorithm's arguments can be reduced to them.
+            template<typename I>
+            using simd_element_t = meta::_t<std::remove_cv<contiguous_element_t<I>>>;
+
+            template<typename I, typename Enable = void>
+            struct is_simd_iterator
+              : std::false_type
+            {};
+
+            template<typename I>
+            struct is_simd_iterator<I, meta::if_c<ContiguousIterator<I>::value>>
+              : meta::bool_<std::is_integral<simd_element_t<I>>::value &&
+                    !std::is_volatile<contiguous_element_t<I>>::value &&
+                    (sizeof(simd_element_t<I>) & (sizeof(simd_element_t<I>) - 1)) == 0 &&
+                    sizeof(simd_element_t<I>) <= 8>
+            {};
+
+            // Searching [begin, end) for a value: find and count.
+            template<typename I, typename S, typename V, typename P>
+            using simd_value_search = meta::bool_<
+                std::is_same<I, S>::value && is_simd_iterator<I>::value &&
+                std::is_same<P, ident>::value && std::is_integral<V>::value>;
+
+            // Comparing two ranges element by element: equal and mismatch.
+            // Pass S1 = I1 when the second range has no end.
+            template<typename I0, typename S0, typename I1, typename S1, typename C,
+                typename P0, typename P1>
+            using simd_range_compare = meta::bool_<
+                std::is_same<I0, S0>::value && std::is_same<I1, S1>::value &&
+                is_simd_iterator<I0>::value && is_simd_iterator<I1>::value &&
+                std::is_same<simd_element_t<I0>, simd_element_t<I1>>::value &&
+                std::is_same<C, ranges::equal_to>::value && std::is_same<P0, ident>::value &&
+                std::is_same<P1, ident>::value>;
+
+            // Comparing each element with the next: adjacent_find.
+            template<typename I, typename S, typename C, typename P>
+            using simd_adjacent_compare = meta::bool_<
+                std::is_same<I, S>::value && is_simd_iterator<I>::value &&
+                std::is_same<C, ranges::equal_to>::value && std::is_same<P, ident>::value>;
+
+            namespace simd
+            {
+                template<typename T>
+                T const *find_scalar(T const *first, T const *last, T v)
+                {
+                    for(; first != last; ++first)
+                        if(*first == v)
+                            break;
+                    return first;
+                }
+
+                template<typename T>
+                std::size_t count_scalar(T const *first, T const *last, T v)
+                {
+                    std::size_t n = 0;
+                    for(; first != last; ++first)
+                        n += *first == v;
+                    return n;
+                }
+
+                template<typename T>
+                T const *mismatch_scalar(T const *first1, T const *last1, T const *first2)
+                {
+                    for(; first1 != last1; ++first1, ++first2)
+                        if(!(*first1 == *first2))
+                            break;
+                    return first1;
+                }
+
+                template<typename T>
+                T const *adjacent_find_scalar(T const *first, T const *last)
+                {
+                    for(; last - first >= 2; ++first)
+                        if(first[0] == first[1])
+                            return first;
+                    return last;
+                }
+
+            #ifdef RANGES_SIMD_X86
+                // A vector compare yields a mask of all-ones lanes where the
+                // operands are equal. movemask gathers one bit per byte of it,
+                // so a lane of N bytes that matched shows up as N set bits.
+                template<std::size_t N>
+                struct sse2_lanes;
+
+                template<>
+                struct sse2_lanes<1>
+                {
+                    static __m128i splat(std::uint8_t v) { return _mm_set1_epi8(static_cast<char>(v)); }
+                    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+                };
+
+                template<>
+                struct sse2_lanes<2>
+                {
+                    static __m128i splat(std::uint16_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+                    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+                };
+
+                template<>
+                struct sse2_lanes<4>
+                {
+                    static __m128i splat(std::uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+                    static __m128i eq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+                };
+
+                // SSE2 has no 64-bit compare: a 64-bit lane is equal when both
+                // of its 32-bit halves are.
+                template<>
+                struct sse2_lanes<8>
+                {
+                    static __m128i splat(std::uint64_t v)
+                    {
+                        return _mm_set1_epi64x(static_cast<long long>(v));
+                    }
+                    static __m128i eq(__m128i a, __m128i b)
+                    {
+                        __m128i const e = _mm_cmpeq_epi32(a, b);
+                        return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+                    }
+                };
+
+                template<std::size_t N>
+                struct avx2_lanes;
+
+                template<>
+                struct avx2_lanes<1>
+                {
+                    RANGES_SIMD_TARGET_AVX2 static __m256i splat(std::uint8_t v)
+                    {
+                        return _mm256_set1_epi8(static_cast<char>(v));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static __m256i eq(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi8(a, b);
+                    }
+                };
+
+                template<>
+                struct avx2_lanes<2>
+                {
+                    RANGES_SIMD_TARGET_AVX2 static __m256i splat(std::uint16_t v)
+                    {
+                        return _mm256_set1_epi16(static_cast<short>(v));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static __m256i eq(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi16(a, b);
+                    }
+                };
+
+                template<>
+                struct avx2_lanes<4>
+                {
+                    RANGES_SIMD_TARGET_AVX2 static __m256i splat(std::uint32_t v)
+                    {
+                        return _mm256_set1_epi32(static_cast<int>(v));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static __m256i eq(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi32(a, b);
+                    }
+                };
+
+                template<>
+                struct avx2_lanes<8>
+                {
+                    RANGES_SIMD_TARGET_AVX2 static __m256i splat(std::uint64_t v)
+                    {
+                        return _mm256_set1_epi64x(static_cast<long long>(v));
+                    }
+                    RANGES_SIMD_TARGET_AVX2 static __m256i eq(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi64(a, b);
+                    }
+                };
+
+                template<typename T>
+                using lane_uint_t =
+                    meta::if_c<sizeof(T) == 1, std::uint8_t,
+                    meta::if_c<sizeof(T) == 2, std::uint16_t,
+                    meta::if_c<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+                template<typename T>
+                __m128i load_sse2(T const *p)
+                {
+                    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+                }
+
+                template<typename T>
+                RANGES_SIMD_TARGET_AVX2 __m256i load_avx2(T const *p)
+                {
+                    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+                }
+
+                template<typename T>
+                T const *find_sse2(T const *first, T const *last, T v)
+                {
+                    using lanes = sse2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 16 / sizeof(T);
+                    __m128i const needle = lanes::splat(static_cast<lane_uint_t<T>>(v));
+                    for(; last - first >= width; first += width)
+                        if(int const m = _mm_movemask_epi8(lanes::eq(load_sse2(first), needle)))
+                            return first + __builtin_ctz(static_cast<unsigned>(m)) / sizeof(T);
+                    return simd::find_scalar(first, last, v);
+                }
+
+                template<typename T>
+                RANGES_SIMD_TARGET_AVX2 T const *find_avx2(T const *first, T const *last, T v)
+                {
+                    using lanes = avx2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 32 / sizeof(T);
+                    __m256i const needle = lanes::splat(static_cast<lane_uint_t<T>>(v));
+                    for(; last - first >= width; first += width)
+                        if(int const m = _mm256_movemask_epi8(lanes::eq(load_avx2(first), needle)))
+                            return first + __builtin_ctz(static_cast<unsigned>(m)) / sizeof(T);
+                    return simd::find_scalar(first, last, v);
+                }
+
+                template<typename T>
+                std::size_t count_sse2(T const *first, T const *last, T v)
+                {
+                    using lanes = sse2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 16 / sizeof(T);
+                    __m128i const needle = lanes::splat(static_cast<lane_uint_t<T>>(v));
+                    std::size_t bits = 0;
+                    for(; last - first >= width; first += width)
+                        bits += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(
+                            _mm_movemask_epi8(lanes::eq(load_sse2(first), needle)))));
+                    return bits / sizeof(T) + simd::count_scalar(first, last, v);
+                }
+
+                template<typename T>
+                RANGES_SIMD_TARGET_AVX2 std::size_t count_avx2(T const *first, T const *last, T v)
+                {
+                    using lanes = avx2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 32 / sizeof(T);
+                    __m256i const needle = lanes::splat(static_cast<lane_uint_t<T>>(v));
+                    std::size_t bits = 0;
+                    for(; last - first >= width; first += width)
+                        bits += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(
+                            _mm256_movemask_epi8(lanes::eq(load_avx2(first), needle)))));
+                    return bits / sizeof(T) + simd::count_scalar(first, last, v);
+                }
+
+                // Two integers are equal exactly when their bytes are, so
+                // mismatch compares bytes whatever the element size, and
+                // rounds the first differing byte down to its element.
+                template<typename T>
+                T const *mismatch_sse2(T const *first1, T const *last1, T const *first2)
+                {
+                    constexpr std::ptrdiff_t width = 16 / sizeof(T);
+                    for(; last1 - first1 >= width; first1 += width, first2 += width)
+                    {
+                        unsigned const m = static_cast<unsigned>(_mm_movemask_epi8(
+                            _mm_cmpeq_epi8(load_sse2(first1), load_sse2(first2))));
+                        if(m != 0xFFFFu)
+                            return first1 + __builtin_ctz(~m) / sizeof(T);
+                    }
+                    return simd::mismatch_scalar(first1, last1, first2);
+                }
+
+                template<typename T>
+                RANGES_SIMD_TARGET_AVX2 T const *mismatch_avx2(T const *first1, T const *last1,
+                    T const *first2)
+                {
+                    constexpr std::ptrdiff_t width = 32 / sizeof(T);
+                    for(; last1 - first1 >= width; first1 += width, first2 += width)
+                    {
+                        unsigned const m = static_cast<unsigned>(_mm256_movemask_epi8(
+                            _mm256_cmpeq_epi8(load_avx2(first1), load_avx2(first2))));
+                        if(m != 0xFFFFFFFFu)
+                            return first1 + __builtin_ctz(~m) / sizeof(T);
+                    }
+                    return simd::mismatch_scalar(first1, last1, first2);
+                }
+
+                // Compares a block with the same block shifted by one element.
+                template<typename T>
+                T const *adjacent_find_sse2(T const *first, T const *last)
+                {
+                    using lanes = sse2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 16 / sizeof(T);
+                    for(; last - first > width; first += width)
+                        if(int const m = _mm_movemask_epi8(
+                            lanes::eq(load_sse2(first), load_sse2(first + 1))))
+                            return first + __builtin_ctz(static_cast<unsigned>(m)) / sizeof(T);
+                    return simd::adjacent_find_scalar(first, last);
+                }
+
+                template<typename T>
+                RANGES_SIMD_TARGET_AVX2 T const *adjacent_find_avx2(T const *first, T const *last)
+                {
+                    using lanes = avx2_lanes<sizeof(T)>;
+                    constexpr std::ptrdiff_t width = 32 / sizeof(T);
+                    for(; last - first > width; first += width)
+                        if(int const m = _mm256_movemask_epi8(
+                            lanes::eq(load_avx2(first), load_avx2(first + 1))))
+                            return first + __builtin_ctz(static_cast<unsigned>(m)) / sizeof(T);
+                    return simd::adjacent_find_scalar(first, last);
+                }
+
+                // Checked once per process. A build that targets AVX2 anyway
+                // needs no check.
+                inline bool has_avx2()
+                {
+                #ifdef __AVX2__
+                    return true;
+                #else
+                    static bool const avx2 =
+                        (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+                    return avx2;
+                #endif
+                }
+            #endif
+
+                template<typename T>
+                T const *find(T const *first, T const *last, T v)
+                {
+                    if(sizeof(T) == 1)
+                    {
+                        void const *p = std::memchr(first, static_cast<unsigned char>(v),
+                            static_cast<std::size_t>(last - first));
+                        return p ? static_cast<T const *>(p) : last;
+                    }
+                #ifdef RANGES_SIMD_X86
+                    return simd::has_avx2() ? simd::find_avx2(first, last, v) :
+                        simd::find_sse2(first, last, v);
+                #else
+                    return simd::find_scalar(first, last, v);
+                #endif
+                }
+
+                template<typename T>
+                std::size_t count(T const *first, T const *last, T v)
+                {
+                #ifdef RANGES_SIMD_X86
+                    return simd::has_avx2() ? simd::count_avx2(first, last, v) :
+                        simd::count_sse2(first, last, v);
+                #else
+                    return simd::count_scalar(first, last, v);
+                #endif
+                }
+
+                template<typename T>
+                bool equal(T const *first1, T const *last1, T const *first2)
+                {
+                    return first1 == last1 || std::memcmp(first1, first2,
+                        static_cast<std::size_t>(last1 - first1) * sizeof(T)) == 0;
+                }
+
+                template<typename T>
+                T const *mismatch(T const *first1, T const *last1, T const *first2)
+                {
+                #ifdef RANGES_SIMD_X86
+                    return simd::has_avx2() ? simd::mismatch_avx2(first1, last1, first2) :
+                        simd::mismatch_sse2(first1, last1, first2);
+                #else
+                    return simd::mismatch_scalar(first1, last1, first2);
+                #endif
+                }
+
+                template<typename T>
+                T const *adjacent_find(T const *first, T const *last)
+                {
+                #ifdef RANGES_SIMD_X86
+                    return simd::has_avx2() ? simd::adjacent_find_avx2(first, last) :
+                        simd::adjacent_find_sse2(first, last);
+                #else
+                    return simd::adjacent_find_scalar(first, last);
+                #endif
+                }
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
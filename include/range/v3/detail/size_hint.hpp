@@ -0,0 +1,112 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_SIZE_HINT_HPP
+#define RANGES_V3_DETAIL_SIZE_HINT_HPP
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/size.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Bounds on the number of elements of a range that can't say
+            // exactly. A view that isn't sized may offer
+            //
+            //     detail::size_hint size_hint();
+            //
+            // from what it knows of its base: a filter has at most as many
+            // elements as its base, a join at least as many as its inner ranges
+            // have together. Containers are filled with them in mind (see
+            // to_container.hpp): they reserve the lower bound up front and never
+            // grow beyond the upper one.
+            struct size_hint
+            {
+                std::size_t lower;
+                std::size_t upper;
+            };
+
+            constexpr std::size_t unbounded_size()
+            {
+                return std::numeric_limits<std::size_t>::max();
+            }
+
+            constexpr std::size_t saturating_add(std::size_t a, std::size_t b)
+            {
+                return a > unbounded_size() - b ? unbounded_size() : a + b;
+            }
+
+            template<typename Rng, typename Enable = void>
+            struct has_size_hint
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct has_size_hint<Rng, meta::void_<decltype(std::declval<Rng &>().size_hint())>>
+              : std::true_type
+            {};
+
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(SizedRange<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(SizedRange<Rng>())>
+#endif
+            size_hint range_size_hint_(Rng &rng, int)
+            {
+                auto const n = static_cast<std::size_t>(ranges::size(rng));
+                return {n, n};
+            }
+            template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(has_size_hint<Rng>::value)>
+#else
+                CONCEPT_REQUIRES_(has_size_hint<Rng>())>
+#endif
+            size_hint range_size_hint_(Rng &rng, long)
+            {
+                return rng.size_hint();
+            }
+            template<typename Rng>
+            size_hint range_size_hint_(Rng &, ...)
+            {
+                return {0, unbounded_size()};
+            }
+
+            // The exact size of a sized range, else whatever bounds the range
+            // gives, else none.
+            template<typename Rng>
+            size_hint range_size_hint(Rng &rng)
+            {
+                return detail::range_size_hint_(rng, 42);
+            }
+
+            // Whether range_size_hint says anything about a range.
+            template<typename Rng>
+            using HasSizeHint = meta::or_<SizedRange<Rng>, has_size_hint<Rng>>;
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,312 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_DETAIL_THREAD_POOL_HPP
+#define RANGES_V3_DETAIL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <range/v3/range_fwd.hpp>
+
+#if RANGES_CXX_THREAD_LOCAL < RANGES_CXX_THREAD_LOCAL_11
+#error This fork requires C++11 thread_local support.
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A small work-stealing pool backing the parallel execution policies.
+            // Every worker owns a deque: it pushes and pops at the back of its own
+            // deque and steals from the front of the others. Threads that block in
+            // task_group::wait() execute queued tasks rather than sleeping, so
+            // nested fork/join (as in the parallel sort) never deadlocks, even when
+            // the pool has a single worker.
+            class thread_pool
+            {
+                struct work_queue
+                {
+                    std::mutex mtx;
+                    std::deque<std::function<void()>> tasks;
+                };
+
+                std::vector<std::unique_ptr<work_queue>> queues_;
+                std::vector<std::thread> threads_;
+                std::mutex sleep_mtx_;
+                std::condition_variable wake_;
+                std::atomic<std::size_t> pending_;
+                std::atomic<std::size_t> next_;
+                bool done_;
+
+                struct worker_id
+                {
+                    thread_pool const *pool;
+                    std::size_t index;
+                };
+
+                static worker_id &this_worker()
+                {
+                    static thread_local worker_id id{nullptr, 0};
+                    return id;
+                }
+
+                std::size_t home_queue()
+                {
+                    worker_id const &id = this_worker();
+                    return id.pool == this ?
+                        id.index :
+                        next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+                }
+
+                bool try_pop(std::function<void()> &task)
+                {
+                    if(pending_.load(std::memory_order_acquire) == 0)
+                        return false;
+                    std::size_t const home = home_queue(), n = queues_.size();
+                    for(std::size_t i = 0; i != n; ++i)
+                    {
+                        work_queue &q = *queues_[(home + i) % n];
+                        std::lock_guard<std::mutex> lock(q.mtx);
+                        if(q.tasks.empty())
+                            continue;
+                        if(i == 0)
+                        {
+                            task = std::move(q.tasks.back());
+                            q.tasks.pop_back();
+                        }
+                        else
+                        {
+                            task = std::move(q.tasks.front());
+                            q.tasks.pop_front();
+                        }
+                        pending_.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                    return false;
+                }
+
+                void work(std::size_t index)
+                {
+                    this_worker() = worker_id{this, index};
+                    while(true)
+                    {
+                        std::function<void()> task;
+                        if(try_pop(task))
+                        {
+                            task();
+                            continue;
+                        }
+                        std::unique_lock<std::mutex> lock(sleep_mtx_);
+                        wake_.wait(lock, [this]
+                        {
+                            return done_ || pending_.load(std::memory_order_acquire) != 0;
+                        });
+                        if(done_ && pending_.load(std::memory_order_acquire) == 0)
+                            return;
+                    }
+                }
+
+            public:
+                explicit thread_pool(std::size_t workers)
+                  : queues_{}, threads_{}, sleep_mtx_{}, wake_{}, pending_{0}, next_{0}
+                  , done_(false)
+                {
+                    if(workers == 0)
+                        workers = 1;
+                    for(std::size_t i = 0; i != workers; ++i)
+                        queues_.emplace_back(new work_queue);
+                    for(std::size_t i = 0; i != workers; ++i)
+                        threads_.emplace_back(&thread_pool::work, this, i);
+                }
+                thread_pool(thread_pool const &) = delete;
+                thread_pool &operator=(thread_pool const &) = delete;
+                ~thread_pool()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(sleep_mtx_);
+                        done_ = true;
+                    }
+                    wake_.notify_all();
+                    for(auto &t : threads_)
+                        t.join();
+                }
+                // The number of threads that can make progress on the pool's work,
+                // counting the thread that is waiting for it.
+                std::size_t concurrency() const noexcept
+                {
+                    return threads_.size() + 1;
+                }
+                void submit(std::function<void()> task)
+                {
+                    std::size_t const i = home_queue();
+                    pending_.fetch_add(1, std::memory_order_release);
+                    {
+                        std::lock_guard<std::mutex> lock(queues_[i]->mtx);
+                        queues_[i]->tasks.push_back(std::move(task));
+                    }
+                    // Synchronize with a worker that is about to sleep so the
+                    // notification cannot be lost.
+                    { std::lock_guard<std::mutex> lock(sleep_mtx_); }
+                    wake_.notify_one();
+                }
+                // Runs one queued task on the calling thread, if there is one.
+                bool try_run_one()
+                {
+                    std::function<void()> task;
+                    if(!try_pop(task))
+                        return false;
+                    task();
+                    return true;
+                }
+                static thread_pool &instance()
+                {
+                    static thread_pool pool{
+                        std::thread::hardware_concurrency() > 1u ?
+                            std::thread::hardware_concurrency() - 1u : 1u};
+                    return pool;
+                }
+            };
+
+            // Fork/join over the pool: run() spawns a task, wait() blocks until
+            // every spawned task (including the ones those tasks spawned through
+            // this group) has finished and rethrows the first exception.
+            class task_group
+            {
+                thread_pool &pool_;
+                std::atomic<std::size_t> outstanding_;
+                std::mutex error_mtx_;
+                std::exception_ptr error_;
+
+                void join()
+                {
+                    while(outstanding_.load(std::memory_order_acquire) != 0)
+                        if(!pool_.try_run_one())
+                            std::this_thread::yield();
+                }
+
+            public:
+                explicit task_group(thread_pool &pool = thread_pool::instance())
+                  : pool_(pool), outstanding_{0}, error_mtx_{}, error_{}
+                {}
+                task_group(task_group const &) = delete;
+                task_group &operator=(task_group const &) = delete;
+                ~task_group()
+                {
+                    join();
+                }
+                thread_pool &pool() const noexcept
+                {
+                    return pool_;
+                }
+                template<typename F>
+                void run(F fun)
+                {
+                    outstanding_.fetch_add(1, std::memory_order_relaxed);
+                    pool_.submit([this, fun]() mutable
+                    {
+                        try
+                        {
+                            fun();
+                        }
+                        catch(...)
+                        {
+                            std::lock_guard<std::mutex> lock(error_mtx_);
+                            if(!error_)
+                                error_ = std::current_exception();
+                        }
+                        // Must be the last access to *this.
+                        outstanding_.fetch_sub(1, std::memory_order_release);
+                    });
+                }
+                void wait()
+                {
+                    join();
+                    if(error_)
+                    {
+                        std::exception_ptr error = error_;
+                        error_ = nullptr;
+                        std::rethrow_exception(error);
+                    }
+                }
+            };
+
+            // How many chunks parallel_for splits n elements into: enough to
+            // balance the load across the pool, but no chunk smaller than grain
+            // (parallel_grain_size(), the smallest number of elements worth
+            // handing to another thread, by default).
+            template<typename D>
+            D parallel_chunk_count(D n, D grain)
+            {
+                D const most = static_cast<D>(thread_pool::instance().concurrency() * 4);
+                D const chunks = n / (grain < 1 ? D(1) : grain);
+                return chunks < 1 ? D(1) : (chunks < most ? chunks : most);
+            }
+
+            // Calls fun(lo, hi) for consecutive sub-intervals that cover [0, n),
+            // concurrently. The calling thread processes the first chunk itself.
+            template<typename D, typename F>
+            void parallel_for(D n, F fun, D grain)
+            {
+                D const chunks = detail::parallel_chunk_count(n, grain);
+                if(chunks <= 1)
+                {
+                    if(n > 0)
+                        fun(D(0), n);
+                    return;
+                }
+                task_group tasks;
+                for(D k = 1; k < chunks; ++k)
+                {
+                    D const lo = n / chunks * k + (k < n % chunks ? k : n % chunks);
+                    D const hi = lo + n / chunks + (k < n % chunks ? 1 : 0);
+                    tasks.run([&fun, lo, hi] { fun(lo, hi); });
+                }
+                fun(D(0), n / chunks + (0 < n % chunks ? 1 : 0));
+                tasks.wait();
+            }
+
+            // Calls f on the pool and g on the calling thread, and returns
+            // once both have.
+            template<typename F, typename G>
+            void parallel_invoke(F f, G g)
+            {
+                task_group tasks;
+                tasks.run(std::move(f));
+                g();
+                tasks.wait();
+            }
+
+            // How many threads the hardware runs at once; 0 if unknown.
+            template<typename D>
+            D hardware_concurrency()
+            {
+                return static_cast<D>(std::thread::hardware_concurrency());
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,212 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_MMAP_RANGE_HPP
+#define RANGES_V3_MMAP_RANGE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/view_interface.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RANGES_MMAP_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// Hints for how a mapped file will be read. They are advice to the
+        /// operating system, which may ignore any of them.
+        enum class mmap_hint : unsigned
+        {
+            none = 0,
+            /// Read ahead aggressively and drop pages soon after they're read.
+            sequential = 1,
+            /// Don't read ahead.
+            random = 2,
+            /// Back the mapping with transparent huge pages where the kernel
+            /// and file system allow it.
+            huge_pages = 4,
+            /// Fault the whole file in before the mapping is returned.
+            populate = 8
+        };
+
+        constexpr mmap_hint operator|(mmap_hint a, mmap_hint b)
+        {
+            return static_cast<mmap_hint>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+        }
+
+        /// \cond
+        namespace detail
+        {
+            constexpr bool has_hint(mmap_hint hints, mmap_hint h)
+            {
+                return 0 != (static_cast<unsigned>(hints) & static_cast<unsigned>(h));
+            }
+
+            // Owns a read-only mapping of a whole file. Where mmap isn't
+            // available, the file is read into memory instead.
+            struct file_mapping
+            {
+            private:
+                char const *data_ = nullptr;
+                std::size_t size_ = 0;
+            #ifndef RANGES_MMAP_POSIX
+                std::unique_ptr<char[]> buffer_;
+            #endif
+            public:
+                file_mapping(std::string const &path, mmap_hint hints)
+                {
+                #ifdef RANGES_MMAP_POSIX
+                    int flags = O_RDONLY;
+                #ifdef O_CLOEXEC
+                    flags |= O_CLOEXEC;
+                #endif
+                    int const fd = ::open(path.c_str(), flags);
+                    if(fd < 0)
+                        throw std::system_error(errno, std::generic_category(), path);
+                    struct ::stat st;
+                    if(::fstat(fd, &st) != 0)
+                    {
+                        int const err = errno;
+                        ::close(fd);
+                        throw std::system_error(err, std::generic_category(), path);
+                    }
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    if(size_ == 0)
+                    {
+                        ::close(fd);
+                        return;
+                    }
+                    int map_flags = MAP_PRIVATE;
+                #ifdef MAP_POPULATE
+                    if(detail::has_hint(hints, mmap_hint::populate))
+                        map_flags |= MAP_POPULATE;
+                #endif
+                    void *const p = ::mmap(nullptr, size_, PROT_READ, map_flags, fd, 0);
+                    int const err = errno;
+                    // The mapping keeps the file alive; the descriptor isn't needed.
+                    ::close(fd);
+                    if(p == MAP_FAILED)
+                        throw std::system_error(err, std::generic_category(), path);
+                    data_ = static_cast<char const *>(p);
+                    if(detail::has_hint(hints, mmap_hint::sequential))
+                        ::madvise(p, size_, MADV_SEQUENTIAL);
+                    if(detail::has_hint(hints, mmap_hint::random))
+                        ::madvise(p, size_, MADV_RANDOM);
+                #ifdef MADV_HUGEPAGE
+                    if(detail::has_hint(hints, mmap_hint::huge_pages))
+                        ::madvise(p, size_, MADV_HUGEPAGE);
+                #endif
+                #else
+                    std::ifstream in(path, std::ios::binary | std::ios::ate);
+                    if(!in)
+                        throw std::system_error(
+                            std::make_error_code(std::errc::no_such_file_or_directory), path);
+                    size_ = static_cast<std::size_t>(in.tellg());
+                    buffer_.reset(new char[size_ ? size_ : 1]);
+                    in.seekg(0);
+                    in.read(buffer_.get(), static_cast<std::streamsize>(size_));
+                    data_ = buffer_.get();
+                    (void)hints;
+                #endif
+                }
+                file_mapping(file_mapping const &) = delete;
+                file_mapping &operator=(file_mapping const &) = delete;
+                ~file_mapping()
+                {
+                #ifdef RANGES_MMAP_POSIX
+                    if(data_)
+                        ::munmap(const_cast<char *>(data_), size_);
+                #endif
+                }
+                char const *data() const
+                {
+                    return data_;
+                }
+                std::size_t size() const
+                {
+                    return size_;
+                }
+            };
+        }
+        /// \endcond
+
+        /// The bytes of a file, mapped read-only into memory. Copies share
+        /// the mapping, which is released when the last copy is destroyed.
+        /// Iterators are `char const *`, so the range is contiguous and works
+        /// with `memchr` and the vectorized algorithms.
+        struct mmap_range
+          : view_interface<mmap_range>
+        {
+        private:
+            std::shared_ptr<detail::file_mapping const> map_;
+        public:
+            mmap_range() = default;
+            /// Throws `std::system_error` if the file can't be opened or mapped.
+            explicit mmap_range(std::string const &path, mmap_hint hints = mmap_hint::sequential)
+              : map_(std::make_shared<detail::file_mapping>(path, hints))
+            {}
+            char const *begin() const
+            {
+                return map_ ? map_->data() : nullptr;
+            }
+            char const *end() const
+            {
+                return map_ ? map_->data() + map_->size() : nullptr;
+            }
+            std::size_t size() const
+            {
+                return map_ ? map_->size() : 0u;
+            }
+            char const *data() const
+            {
+                return begin();
+            }
+        };
+
+        struct mmap_file_fn
+        {
+            mmap_range operator()(std::string const &path,
+                mmap_hint hints = mmap_hint::sequential) const
+            {
+                return mmap_range{path, hints};
+            }
+        };
+
+        /// \relates mmap_file_fn
+        /// \ingroup group-core
+        namespace
+        {
+            constexpr auto && mmap_file = static_const<mmap_file_fn>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -21,6 +21,10 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/bulk_read.hpp>
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/for_each_index.hpp>
 
 namespace ranges
 {
@@ -38,6 +42,84 @@ namespace ranges
 
         struct accumulate_fn
         {
+        private:
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static I impl(I begin, S end, T &init, Op &op, P &proj, std::false_type)
+            {
+                for(; begin != end; ++begin)
+                    init = op(init, proj(*begin));
+                return begin;
+            }
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static I impl(I begin, S end, T &init, Op &op, P &proj, std::true_type)
+            {
+                return detail::bulk_read(std::move(begin), end,
+                    [&](iterator_value_t<I> &v) { init = op(init, proj(std::move(v))); });
+            }
+            template<typename T, typename Op, typename P>
+            struct segment_fn
+            {
+                T &init;
+                Op &op;
+                P &proj;
+                template<typename L, typename LS>
+                L operator()(L begin, LS end) const
+                {
+                    return accumulate_fn::segmented(std::move(begin), std::move(end), init, op,
+                        proj, detail::is_segmented<L, LS>{});
+                }
+            };
+            // The fold is carried across the segments of a flattened range by
+            // reference.
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static I segmented(I begin, S end, T &init, Op &op, P &proj, std::true_type)
+            {
+                segment_fn<T, Op, P> seg{init, op, proj};
+                return detail::for_each_segment(std::move(begin), end, seg);
+            }
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static I segmented(I begin, S end, T &init, Op &op, P &proj, std::false_type)
+            {
+                return accumulate_fn::impl(std::move(begin), std::move(end), init, op, proj,
+                    detail::is_bulk_readable<I, S>{});
+            }
+            template<typename T, typename Op, typename P>
+            struct push_sink
+            {
+                T &init;
+                Op &op;
+                P &proj;
+                template<typename X>
+                bool operator()(X &&x) const
+                {
+                    init = op(init, proj(static_cast<X &&>(x)));
+                    return false;
+                }
+            };
+            template<typename Rng, typename T, typename Op, typename P>
+            static void whole(Rng &rng, T &init, Op &op, P &proj, std::true_type)
+            {
+                push_sink<T, Op, P> sink{init, op, proj};
+                detail::for_each_until(rng, sink);
+            }
+            template<typename Rng, typename T, typename Op, typename P>
+            static void whole(Rng &rng, T &init, Op &op, P &proj, std::false_type)
+            {
+                accumulate_fn::segmented(begin(rng), end(rng), init, op, proj,
+                    detail::is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>{});
+            }
+            template<typename Rng, typename T, typename Op, typename P>
+            static void indexed(Rng &rng, T &init, Op &op, P &proj, std::true_type)
+            {
+                push_sink<T, Op, P> sink{init, op, proj};
+                detail::for_each_index(rng, sink);
+            }
+            template<typename Rng, typename T, typename Op, typename P>
+            static void indexed(Rng &rng, T &init, Op &op, P &proj, std::false_type)
+            {
+                accumulate_fn::whole(rng, init, op, proj, detail::push_unsegmented<Rng>{});
+            }
+        public:
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                 CONCEPT_REQUIRES_(IteratorRange<I, S>::value && Accumulateable<I, T, Op, P>::value)>
@@ -48,8 +130,8 @@ namespace ranges
             {
                 auto &&op = as_function(op_);
                 auto &&proj = as_function(proj_);
-                for(; begin != end; ++begin)
-                    init = op(init, proj(*begin));
+                accumulate_fn::segmented(std::move(begin), std::move(end), init, op, proj,
+                    detail::is_segmented<I, S>{});
                 return init;
             }
 
@@ -60,10 +142,12 @@ namespace ranges
 #else
                 CONCEPT_REQUIRES_(Range<Rng>() && Accumulateable<I, T, Op, P>())>
 #endif
-            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            T operator()(Rng && rng, T init, Op op_ = Op{}, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
-                    std::move(proj));
+                auto &&op = as_function(op_);
+                auto &&proj = as_function(proj_);
+                accumulate_fn::indexed(rng, init, op, proj, detail::is_indexable<Rng>{});
+                return init;
             }
         };
 
@@ -0,0 +1,237 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename O, typename T, typename BOp = plus, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Callable::result_t<P, V>,
+            typename Y = concepts::Callable::result_t<BOp, T, X>>
+        using ExclusiveScannable = meta::fast_and<
+            InputIterator<I>,
+            WeakOutputIterator<O, T>,
+            Callable<P, V>,
+            CopyConstructible<T>,
+            Callable<BOp, T, X>,
+            Assignable<T&, Y>>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename T, typename BOp, typename = void>
+            struct closed_under
+              : std::false_type
+            {};
+
+            template<typename T, typename BOp>
+            struct closed_under<T, BOp, meta::if_<Callable<BOp, T, T>>>
+              : Assignable<T&, concepts::Callable::result_t<BOp, T, T>>
+            {};
+
+            // What scanning in blocks takes on top: partial totals of the
+            // elements alone, which start from an element and are added to a
+            // carry.
+            template<typename I, typename T, typename BOp, typename P,
+                typename X = concepts::Callable::result_t<P, iterator_value_t<I>>>
+            using ExclusiveScannableInBlocks = meta::fast_and<
+                ConvertibleTo<X, T>,
+                closed_under<T, BOp>>;
+        }
+        /// \endcond
+
+        /// Writes `init`, then `init` combined with each element in turn,
+        /// leaving the last element out: `result[i]` is the total of `init`
+        /// and the elements before the i-th. `bop` must be associative;
+        /// otherwise this is the counterpart of `inclusive_scan`, with the same
+        /// fast paths, and it too can scan in place.
+        struct exclusive_scan_fn
+        {
+        private:
+            template<typename I, typename O, typename T, typename BOp, typename P,
+                typename Parallel>
+            static std::pair<I, O> impl(I begin, iterator_difference_t<I> n, O result, T init,
+                BOp &bop, P &proj, Parallel parallel)
+            {
+                using D = iterator_difference_t<I>;
+                auto elem = detail::make_reduce_element(begin, proj);
+                detail::scan_n<true>(std::move(init), D(0), n, bop, elem, result, parallel);
+                return {begin + n, result + n};
+            }
+            template<typename I, typename S, typename O, typename T, typename BOp, typename P>
+            static std::pair<I, O> sequential(I begin, S end, O result, T init, BOp &bop,
+                P &proj, std::true_type)
+            {
+                return exclusive_scan_fn::impl(std::move(begin), end - begin, std::move(result),
+                    std::move(init), bop, proj, std::false_type{});
+            }
+            template<typename I, typename S, typename O, typename T, typename BOp, typename P>
+            static std::pair<I, O> sequential(I begin, S end, O result, T init, BOp &bop,
+                P &proj, std::false_type)
+            {
+                for(; begin != end; ++begin, ++result)
+                {
+                    T next = bop(init, proj(*begin));
+                    *result = init;
+                    init = std::move(next);
+                }
+                return {begin, result};
+            }
+        public:
+            template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(IteratorRange<I, S>::value &&
+                    ExclusiveScannable<I, O, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(I begin, S end, O result, T init, BOp bop_ = BOp{},
+                P proj_ = P{}) const
+            {
+                auto &&bop = as_function(bop_);
+                auto &&proj = as_function(proj_);
+                return exclusive_scan_fn::sequential(std::move(begin), std::move(end),
+                    std::move(result), std::move(init), bop, proj,
+                    meta::bool_<RandomAccessIterator<I>::value &&
+                        SizedIteratorRange<I, S>::value && RandomAccessIterator<O>::value &&
+                        detail::ExclusiveScannableInBlocks<I, T, BOp, P>::value>{});
+            }
+
+            template<typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Range<Rng &>::value &&
+                    ExclusiveScannable<I, O, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(Range<Rng &>() && ExclusiveScannable<I, O, T, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(Rng &rng, ORef &&result, T init, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(result),
+                    std::move(init), std::move(bop), std::move(proj));
+            }
+
+            /// \overload
+            /// Scans `rng` in place, and returns its end.
+            template<typename Rng, typename T, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ForwardRange<Rng &>::value &&
+                    ExclusiveScannable<I, I, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ForwardRange<Rng &>() &&
+                    ExclusiveScannable<I, I, T, BOp, P>())>
+#endif
+            I operator()(Rng &rng, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), begin(rng), std::move(init),
+                    std::move(bop), std::move(proj)).first;
+            }
+
+            /// \overload
+            template<typename E, typename I, typename S, typename O, typename T,
+                typename BOp = plus, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && RandomAccessIterator<O>::value &&
+                    ExclusiveScannable<I, O, T, BOp, P>::value &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && ExclusiveScannable<I, O, T, BOp, P>() &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(E &&, I begin, S end, O result, T init,
+                BOp bop_ = BOp{}, P proj_ = P{}) const
+            {
+                auto &&bop = as_function(bop_);
+                auto &&proj = as_function(proj_);
+                return exclusive_scan_fn::impl(std::move(begin), end - begin, std::move(result),
+                    std::move(init), bop, proj, detail::is_parallel_policy<E>{});
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>::value && SizedRange<Rng &>::value &&
+                    RandomAccessIterator<O>::value && ExclusiveScannable<I, O, T, BOp, P>::value &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>() && SizedRange<Rng &>() &&
+                    RandomAccessIterator<O>() && ExclusiveScannable<I, O, T, BOp, P>() &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(E &&policy, Rng &rng, ORef &&result, T init,
+                BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<ORef>(result), std::move(init), std::move(bop),
+                    std::move(proj));
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>::value && SizedRange<Rng &>::value &&
+                    ExclusiveScannable<I, I, T, BOp, P>::value &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>() && SizedRange<Rng &>() &&
+                    ExclusiveScannable<I, I, T, BOp, P>() &&
+                    detail::ExclusiveScannableInBlocks<I, T, BOp, P>())>
+#endif
+            I operator()(E &&policy, Rng &rng, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), begin(rng),
+                    std::move(init), std::move(bop), std::move(proj)).first;
+            }
+        };
+
+        /// \sa `exclusive_scan_fn`
+        namespace
+        {
+            constexpr auto&& exclusive_scan = static_const<exclusive_scan_fn>::value;
+        }
+    }
+}
+
+#endif
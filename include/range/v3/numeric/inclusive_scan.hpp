@@ -0,0 +1,342 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/numeric/reduce.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Writes the running totals of elem(lo), ..., elem(hi - 1), starting
+            // from carry, to out + lo, ..., out + hi - 1, and returns the total.
+            // An exclusive scan writes each total before its element is added.
+            //
+            // Eight elements at a time are read and scanned among themselves
+            // first. Those seven steps don't depend on the previous group, so
+            // they overlap with it; only one step per group waits for the
+            // carry, where a plain loop waits on every element. All eight are
+            // read before any is written, so out may be the input itself.
+            template<bool Exclusive, typename T, typename D, typename Op, typename E,
+                typename O>
+            T scan_block(D lo, D hi, T carry, Op &op, E &elem, O out)
+            {
+                for(; hi - lo >= 8; lo += 8)
+                {
+                    T const t0 = static_cast<T>(elem(lo));
+                    T const t1 = op(t0, elem(lo + 1));
+                    T const t2 = op(t1, elem(lo + 2));
+                    T const t3 = op(t2, elem(lo + 3));
+                    T const t4 = op(t3, elem(lo + 4));
+                    T const t5 = op(t4, elem(lo + 5));
+                    T const t6 = op(t5, elem(lo + 6));
+                    T const t7 = op(t6, elem(lo + 7));
+                    if(Exclusive)
+                    {
+                        *(out + lo) = carry;
+                        *(out + (lo + 1)) = op(carry, t0);
+                        *(out + (lo + 2)) = op(carry, t1);
+                        *(out + (lo + 3)) = op(carry, t2);
+                        *(out + (lo + 4)) = op(carry, t3);
+                        *(out + (lo + 5)) = op(carry, t4);
+                        *(out + (lo + 6)) = op(carry, t5);
+                        *(out + (lo + 7)) = op(carry, t6);
+                    }
+                    else
+                    {
+                        *(out + lo) = op(carry, t0);
+                        *(out + (lo + 1)) = op(carry, t1);
+                        *(out + (lo + 2)) = op(carry, t2);
+                        *(out + (lo + 3)) = op(carry, t3);
+                        *(out + (lo + 4)) = op(carry, t4);
+                        *(out + (lo + 5)) = op(carry, t5);
+                        *(out + (lo + 6)) = op(carry, t6);
+                        *(out + (lo + 7)) = op(carry, t7);
+                    }
+                    carry = op(carry, t7);
+                }
+                for(; lo != hi; ++lo)
+                {
+                    T next = op(carry, elem(lo));
+                    *(out + lo) = Exclusive ? carry : next;
+                    carry = std::move(next);
+                }
+                return carry;
+            }
+
+            // Folds elem(lo), ..., elem(hi - 1) in order. The range is cut into
+            // eight runs that are folded side by side and then combined left
+            // to right, which needs op to be associative but not commutative.
+            template<typename T, typename D, typename Op, typename E>
+            T fold_block(D lo, D hi, Op &op, E &elem)
+            {
+                D const m = (hi - lo) / 8;
+                if(m < 2)
+                {
+                    T t = static_cast<T>(elem(lo));
+                    while(++lo != hi)
+                        t = op(t, elem(lo));
+                    return t;
+                }
+                T a0 = static_cast<T>(elem(lo)), a1 = static_cast<T>(elem(lo + m)),
+                    a2 = static_cast<T>(elem(lo + 2 * m)), a3 = static_cast<T>(elem(lo + 3 * m)),
+                    a4 = static_cast<T>(elem(lo + 4 * m)), a5 = static_cast<T>(elem(lo + 5 * m)),
+                    a6 = static_cast<T>(elem(lo + 6 * m)), a7 = static_cast<T>(elem(lo + 7 * m));
+                for(D i = lo + 1; i != lo + m; ++i)
+                {
+                    a0 = op(a0, elem(i));
+                    a1 = op(a1, elem(i + m));
+                    a2 = op(a2, elem(i + 2 * m));
+                    a3 = op(a3, elem(i + 3 * m));
+                    a4 = op(a4, elem(i + 4 * m));
+                    a5 = op(a5, elem(i + 5 * m));
+                    a6 = op(a6, elem(i + 6 * m));
+                    a7 = op(a7, elem(i + 7 * m));
+                }
+                a0 = op(op(a0, a1), op(a2, a3));
+                a4 = op(op(a4, a5), op(a6, a7));
+                a0 = op(a0, a4);
+                for(D i = lo + 8 * m; i != hi; ++i)
+                    a0 = op(a0, elem(i));
+                return a0;
+            }
+
+            // Scans elements [start, n) into out, starting from carry.
+            template<bool Exclusive, typename T, typename D, typename Op, typename E,
+                typename O>
+            void scan_n(T carry, D start, D n, Op &op, E &elem, O out, std::false_type)
+            {
+                detail::scan_block<Exclusive>(start, n, std::move(carry), op, elem, out);
+            }
+
+            // As above, but the elements are split into chunks and scanned in
+            // two passes: the first folds every chunk but the last, the totals
+            // are scanned to give each chunk its carry, and the second pass
+            // scans every chunk from its carry. Each pass reads a chunk before
+            // it writes it, so this works in place too.
+            template<bool Exclusive, typename T, typename D, typename Op, typename E,
+                typename O>
+            void scan_n(T carry, D start, D n, Op &op, E &elem, O out, std::true_type)
+            {
+                // Two passes read every element twice, which only pays when
+                // there is more than one core to share them.
+                D const m = n - start;
+                D const chunks = detail::hardware_concurrency<unsigned>() > 1u ?
+                    detail::parallel_chunk_count(m) : D(1);
+                if(chunks <= 1)
+                {
+                    detail::scan_block<Exclusive>(start, n, std::move(carry), op, elem, out);
+                    return;
+                }
+                auto bound = [=](D k)
+                {
+                    return start + m / chunks * k + (k < m % chunks ? k : m % chunks);
+                };
+                std::vector<optional<T>> carries(static_cast<std::size_t>(chunks));
+                carries[0] = std::move(carry);
+                detail::parallel_for(chunks - 1, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        carries[static_cast<std::size_t>(lo + 1)] =
+                            detail::fold_block<T>(bound(lo), bound(lo + 1), op, elem);
+                }, D(1));
+                for(std::size_t k = 1; k < carries.size(); ++k)
+                    carries[k] = static_cast<T>(op(*carries[k - 1], *carries[k]));
+                detail::parallel_for(chunks, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        detail::scan_block<Exclusive>(bound(lo), bound(lo + 1),
+                            *carries[static_cast<std::size_t>(lo)], op, elem, out);
+                }, D(1));
+            }
+        }
+        /// \endcond
+
+        /// Like `partial_sum`, but `bop` must be associative, which lets it
+        /// break the chain of dependencies from one element to the next. When
+        /// both the input and the output are random-access and the input's
+        /// size is known, the elements are scanned eight at a time and, given
+        /// a parallel execution policy, in two passes over chunks on the
+        /// library's thread pool. `result` may be `begin`, and a range alone is
+        /// scanned in place. Floating-point results may differ from those of
+        /// `partial_sum` in the last bits.
+        struct inclusive_scan_fn
+        {
+        private:
+            template<typename I, typename O, typename BOp, typename P, typename Parallel>
+            static std::pair<I, O> impl(I begin, iterator_difference_t<I> n, O result, BOp &bop,
+                P &proj, Parallel parallel)
+            {
+                using D = iterator_difference_t<I>;
+                using T = uncvref_t<concepts::Callable::result_t<P, iterator_value_t<I>>>;
+                if(n > 0)
+                {
+                    auto elem = detail::make_reduce_element(begin, proj);
+                    T first = static_cast<T>(elem(D(0)));
+                    *result = first;
+                    detail::scan_n<false>(std::move(first), D(1), n, bop, elem, result,
+                        parallel);
+                }
+                return {begin + n, result + n};
+            }
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O> sequential(I begin, S end, O result, BOp &bop, P &proj,
+                std::true_type)
+            {
+                return inclusive_scan_fn::impl(std::move(begin), end - begin, std::move(result),
+                    bop, proj, std::false_type{});
+            }
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static std::pair<I, O> sequential(I begin, S end, O result, BOp &bop, P &proj,
+                std::false_type)
+            {
+                return partial_sum(std::move(begin), std::move(end), std::move(result), bop,
+                    proj);
+            }
+        public:
+            template<typename I, typename S, typename O, typename BOp = plus, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(IteratorRange<I, S>::value &&
+                    PartialSummable<I, O, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && PartialSummable<I, O, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(I begin, S end, O result, BOp bop_ = BOp{},
+                P proj_ = P{}) const
+            {
+                auto &&bop = as_function(bop_);
+                auto &&proj = as_function(proj_);
+                return inclusive_scan_fn::sequential(std::move(begin), std::move(end),
+                    std::move(result), bop, proj,
+                    meta::bool_<RandomAccessIterator<I>::value &&
+                        SizedIteratorRange<I, S>::value && RandomAccessIterator<O>::value>{});
+            }
+
+            template<typename Rng, typename ORef, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>, typename O = uncvref_t<ORef>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Range<Rng &>::value && PartialSummable<I, O, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(Range<Rng &>() && PartialSummable<I, O, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(Rng &rng, ORef &&result, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(result), std::move(bop),
+                    std::move(proj));
+            }
+
+            /// \overload
+            /// Scans `rng` in place, and returns its end.
+            template<typename Rng, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ForwardRange<Rng &>::value &&
+                    PartialSummable<I, I, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ForwardRange<Rng &>() && PartialSummable<I, I, BOp, P>())>
+#endif
+            I operator()(Rng &rng, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), begin(rng), std::move(bop),
+                    std::move(proj)).first;
+            }
+
+            /// \overload
+            template<typename E, typename I, typename S, typename O, typename BOp = plus,
+                typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && RandomAccessIterator<O>::value &&
+                    PartialSummable<I, O, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && PartialSummable<I, O, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(E &&, I begin, S end, O result, BOp bop_ = BOp{},
+                P proj_ = P{}) const
+            {
+                auto &&bop = as_function(bop_);
+                auto &&proj = as_function(proj_);
+                return inclusive_scan_fn::impl(std::move(begin), end - begin, std::move(result),
+                    bop, proj, detail::is_parallel_policy<E>{});
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename ORef, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>::value && SizedRange<Rng &>::value &&
+                    RandomAccessIterator<O>::value && PartialSummable<I, O, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>() && SizedRange<Rng &>() &&
+                    RandomAccessIterator<O>() && PartialSummable<I, O, BOp, P>())>
+#endif
+            std::pair<I, O> operator()(E &&policy, Rng &rng, ORef &&result, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<ORef>(result), std::move(bop), std::move(proj));
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>::value && SizedRange<Rng &>::value &&
+                    PartialSummable<I, I, BOp, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng &>() && SizedRange<Rng &>() &&
+                    PartialSummable<I, I, BOp, P>())>
+#endif
+            I operator()(E &&policy, Rng &rng, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), begin(rng),
+                    std::move(bop), std::move(proj)).first;
+            }
+        };
+
+        /// \sa `inclusive_scan_fn`
+        namespace
+        {
+            constexpr auto&& inclusive_scan = static_const<inclusive_scan_fn>::value;
+        }
+    }
+}
+
+#endif
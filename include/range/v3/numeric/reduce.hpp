@@ -0,0 +1,287 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_NUMERIC_REDUCE_HPP
+#define RANGES_V3_NUMERIC_REDUCE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename T, typename Op = plus, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Callable::result_t<P, V>,
+            typename Z = concepts::Callable::result_t<Op, T, T>>
+        using Reduceable = meta::fast_and<
+            Accumulateable<I, T, Op, P>,
+            ConvertibleTo<X, T>,
+            Assignable<T&, Z>>;
+
+        /// \cond
+        namespace detail
+        {
+            // How reduce groups the elements it combines. The grouping is fixed
+            // by the number of elements alone, never by the policy or by how
+            // many threads the pool has, so that a floating-point reduction
+            // gives the same result, bit for bit, every time and everywhere:
+            //
+            //  - The elements are cut into blocks of reduce_block_size().
+            //  - Within a block, eight partial results are folded side by side,
+            //    the k-th taking every eighth element from the k-th on. They
+            //    are independent, so the compiler can keep them in the lanes of
+            //    a vector register, or at least in flight together. They are
+            //    then combined pairwise.
+            //  - The blocks' results are combined by a balanced binary tree.
+            //    A parallel reduction evaluates the larger subtrees of that same
+            //    tree on the thread pool.
+            constexpr std::ptrdiff_t reduce_block_size()
+            {
+                return 1 << 11;
+            }
+
+            template<typename T, typename D, typename Op, typename E>
+            T reduce_block(D lo, D hi, Op &op, E &elem)
+            {
+                if(hi - lo < 8)
+                {
+                    T t = static_cast<T>(elem(lo));
+                    while(++lo != hi)
+                        t = op(t, elem(lo));
+                    return t;
+                }
+                T acc[8] = {
+                    static_cast<T>(elem(lo)), static_cast<T>(elem(lo + 1)),
+                    static_cast<T>(elem(lo + 2)), static_cast<T>(elem(lo + 3)),
+                    static_cast<T>(elem(lo + 4)), static_cast<T>(elem(lo + 5)),
+                    static_cast<T>(elem(lo + 6)), static_cast<T>(elem(lo + 7))};
+                D i = lo + 8;
+                for(; hi - i >= 8; i += 8)
+                {
+                    acc[0] = op(acc[0], elem(i));
+                    acc[1] = op(acc[1], elem(i + 1));
+                    acc[2] = op(acc[2], elem(i + 2));
+                    acc[3] = op(acc[3], elem(i + 3));
+                    acc[4] = op(acc[4], elem(i + 4));
+                    acc[5] = op(acc[5], elem(i + 5));
+                    acc[6] = op(acc[6], elem(i + 6));
+                    acc[7] = op(acc[7], elem(i + 7));
+                }
+                for(int k = 0; i != hi; ++i, ++k)
+                    acc[k] = op(acc[k], elem(i));
+                for(int k = 0; k != 4; ++k)
+                    acc[k] = op(acc[k], acc[k + 4]);
+                acc[0] = op(acc[0], acc[2]);
+                acc[1] = op(acc[1], acc[3]);
+                return op(acc[0], acc[1]);
+            }
+
+            // Reduces blocks [lo, hi) of the n elements on the calling thread.
+            template<typename T, typename D, typename Op, typename E>
+            T reduce_blocks(D lo, D hi, D n, Op &op, E &elem)
+            {
+                D const block = reduce_block_size();
+                if(hi - lo == 1)
+                    return detail::reduce_block<T>(lo * block,
+                        hi * block < n ? hi * block : n, op, elem);
+                D const mid = lo + (hi - lo) / 2;
+                T left = detail::reduce_blocks<T>(lo, mid, n, op, elem);
+                return op(left, detail::reduce_blocks<T>(mid, hi, n, op, elem));
+            }
+
+            // As above, but subtrees with more than spawn elements are split
+            // across threads. The grouping is the same.
+            template<typename T, typename D, typename Op, typename E>
+            T reduce_blocks(D lo, D hi, D n, D spawn, Op &op, E &elem)
+            {
+                D const block = reduce_block_size();
+                if((hi - lo) * block <= spawn)
+                    return detail::reduce_blocks<T>(lo, hi, n, op, elem);
+                D const mid = lo + (hi - lo) / 2;
+                optional<T> left, right;
+                detail::parallel_invoke([&]
+                {
+                    right = detail::reduce_blocks<T>(mid, hi, n, spawn, op, elem);
+                }, [&]
+                {
+                    left = detail::reduce_blocks<T>(lo, mid, n, spawn, op, elem);
+                });
+                return op(*left, *right);
+            }
+
+            // Folds the elements elem(0), ..., elem(n - 1) into init in the
+            // order described above.
+            template<typename T, typename D, typename Op, typename E>
+            T reduce_n(T init, D n, Op &op, E &elem, std::false_type)
+            {
+                if(n <= 0)
+                    return init;
+                D const block = reduce_block_size();
+                return op(init, detail::reduce_blocks<T>(D(0), (n + block - 1) / block, n,
+                    op, elem));
+            }
+
+            // As above, on the thread pool.
+            template<typename T, typename D, typename Op, typename E>
+            T reduce_n(T init, D n, Op &op, E &elem, std::true_type)
+            {
+                if(n <= 0)
+                    return init;
+                D const block = reduce_block_size();
+                // At most four chunks per thread.
+                D const share = n / detail::parallel_chunk_count(n, D(1));
+                D spawn = 4 * parallel_grain_size();
+                spawn = share > spawn ? share : spawn;
+                return op(init, detail::reduce_blocks<T>(D(0), (n + block - 1) / block, n, spawn,
+                    op, elem));
+            }
+
+            template<typename I, typename P>
+            struct reduce_element
+            {
+                I begin;
+                P &proj;
+                template<typename D>
+                auto operator()(D i) const ->
+                    decltype(proj(*(begin + i)))
+                {
+                    return proj(*(begin + i));
+                }
+            };
+
+            template<typename I, typename P>
+            reduce_element<I, P> make_reduce_element(I begin, P &proj)
+            {
+                return {begin, proj};
+            }
+        }
+        /// \endcond
+
+        /// Like `accumulate`, but `op` may combine the elements in any order
+        /// and grouping, so it must be associative and commutative. For
+        /// random-access ranges that know their size, that lets the fold run as
+        /// several independent ones, which vectorizes and pipelines where a
+        /// left fold can't, and, given a parallel execution policy, on the
+        /// library's thread pool. The grouping depends only on the number of
+        /// elements: the result is reproducible, including for floating-point
+        /// `T`, and the same with and without a policy. Other ranges are folded
+        /// from the left.
+        struct reduce_fn
+        {
+        private:
+            template<typename I, typename S, typename T, typename Op, typename P,
+                typename Parallel>
+            static T impl(I begin, S end, T init, Op &op, P &proj, std::true_type, Parallel parallel)
+            {
+                auto elem = detail::make_reduce_element(begin, proj);
+                return detail::reduce_n(std::move(init), end - begin, op, elem, parallel);
+            }
+            template<typename I, typename S, typename T, typename Op, typename P,
+                typename Parallel>
+            static T impl(I begin, S end, T init, Op &op, P &proj, std::false_type, Parallel)
+            {
+                for(; begin != end; ++begin)
+                    init = op(init, proj(*begin));
+                return init;
+            }
+        public:
+            template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(IteratorRange<I, S>::value && Reduceable<I, T, Op, P>::value)>
+#else
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && Reduceable<I, T, Op, P>())>
+#endif
+            T operator()(I begin, S end, T init, Op op_ = Op{}, P proj_ = P{}) const
+            {
+                auto &&op = as_function(op_);
+                auto &&proj = as_function(proj_);
+                return reduce_fn::impl(std::move(begin), std::move(end), std::move(init), op, proj,
+                    meta::bool_<RandomAccessIterator<I>::value &&
+                        SizedIteratorRange<I, S>::value>{}, std::false_type{});
+            }
+
+            template<typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Range<Rng>::value && Reduceable<I, T, Op, P>::value)>
+#else
+                CONCEPT_REQUIRES_(Range<Rng>() && Reduceable<I, T, Op, P>())>
+#endif
+            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
+                    std::move(proj));
+            }
+
+            /// \overload
+            /// With a parallel policy, the larger subtrees of the reduction are
+            /// evaluated concurrently; the result is the same as without.
+            template<typename E, typename I, typename S, typename T, typename Op = plus,
+                typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>::value &&
+                    SizedIteratorRange<I, S>::value && Reduceable<I, T, Op, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() &&
+                    SizedIteratorRange<I, S>() && Reduceable<I, T, Op, P>())>
+#endif
+            T operator()(E &&, I begin, S end, T init, Op op_ = Op{}, P proj_ = P{}) const
+            {
+                auto &&op = as_function(op_);
+                auto &&proj = as_function(proj_);
+                return reduce_fn::impl(std::move(begin), std::move(end), std::move(init), op, proj,
+                    std::true_type{}, detail::is_parallel_policy<E>{});
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename T, typename Op = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && SizedRange<Rng>::value &&
+                    Reduceable<I, T, Op, P>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && SizedRange<Rng>() &&
+                    Reduceable<I, T, Op, P>())>
+#endif
+            T operator()(E &&policy, Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(init),
+                    std::move(op), std::move(proj));
+            }
+        };
+
+        /// \sa `reduce_fn`
+        namespace
+        {
+            constexpr auto&& reduce = static_const<with_braced_init_args<reduce_fn>>::value;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,291 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_NUMERIC_TRANSFORM_REDUCE_HPP
+#define RANGES_V3_NUMERIC_TRANSFORM_REDUCE_HPP
+
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/reduce.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I1, typename I2, typename T,
+            typename BOp1 = plus, typename BOp2 = multiplies,
+            typename P1 = ident, typename P2 = ident,
+            typename V1 = iterator_value_t<I1>,
+            typename V2 = iterator_value_t<I2>,
+            typename X1 = concepts::Callable::result_t<P1, V1>,
+            typename X2 = concepts::Callable::result_t<P2, V2>,
+            typename Y2 = concepts::Callable::result_t<BOp2, X1, X2>,
+            typename Z = concepts::Callable::result_t<BOp1, T, T>>
+        using TransformReduceable = meta::fast_and<
+            InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>,
+            ConvertibleTo<Y2, T>,
+            Assignable<T&, Z>>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I1, typename I2, typename BOp2, typename P1, typename P2>
+            struct transform_reduce_element
+            {
+                I1 begin1;
+                I2 begin2;
+                BOp2 &bop2;
+                P1 &proj1;
+                P2 &proj2;
+                template<typename D>
+                auto operator()(D i) const ->
+                    decltype(bop2(proj1(*(begin1 + i)), proj2(*(begin2 + i))))
+                {
+                    return bop2(proj1(*(begin1 + i)), proj2(*(begin2 + i)));
+                }
+            };
+        }
+        /// \endcond
+
+        /// The unary form is `reduce` with `transform` applied to each element.
+        /// The binary form is `inner_product` with the freedom of `reduce`:
+        /// `bop1` must be associative and commutative, and over random-access
+        /// ranges of known size the products are summed in the same
+        /// reproducible grouping, optionally in parallel. Given two ranges, it
+        /// stops at the end of the shorter.
+        struct transform_reduce_fn
+        {
+        private:
+            template<typename I1, typename I2, typename T, typename BOp1, typename BOp2,
+                typename P1, typename P2, typename Parallel>
+            static T impl(I1 begin1, I2 begin2, iterator_difference_t<I1> n, T init, BOp1 &bop1,
+                BOp2 &bop2, P1 &proj1, P2 &proj2, Parallel parallel)
+            {
+                detail::transform_reduce_element<I1, I2, BOp2, P1, P2> elem{begin1, begin2, bop2,
+                    proj1, proj2};
+                return detail::reduce_n(std::move(init), n, bop1, elem, parallel);
+            }
+            template<typename I1, typename S1, typename I2, typename T, typename BOp1,
+                typename BOp2, typename P1, typename P2>
+            T iterators_(I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1_, BOp2 bop2_,
+                P1 proj1_, P2 proj2_, std::true_type) const
+            {
+                auto &&bop1 = as_function(bop1_);
+                auto &&bop2 = as_function(bop2_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                return transform_reduce_fn::impl(begin1, begin2, end1 - begin1, std::move(init),
+                    bop1, bop2, proj1, proj2, std::false_type{});
+            }
+            template<typename I1, typename S1, typename I2, typename T, typename BOp1,
+                typename BOp2, typename P1, typename P2>
+            T iterators_(I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1, BOp2 bop2, P1 proj1,
+                P2 proj2, std::false_type) const
+            {
+                return inner_product(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(init), std::move(bop1), std::move(bop2), std::move(proj1),
+                    std::move(proj2));
+            }
+            template<typename Rng1, typename Rng2, typename T, typename BOp1, typename BOp2,
+                typename P1, typename P2>
+            T ranges_(Rng1 &rng1, Rng2 &rng2, T init, BOp1 bop1, BOp2 bop2, P1 proj1, P2 proj2,
+                std::true_type) const
+            {
+                auto const n1 = distance(rng1), n2 = distance(rng2);
+                return this->iterators_(begin(rng1), begin(rng1) + (n1 < n2 ? n1 : n2),
+                    begin(rng2), std::move(init), std::move(bop1), std::move(bop2),
+                    std::move(proj1), std::move(proj2), std::true_type{});
+            }
+            template<typename Rng1, typename Rng2, typename T, typename BOp1, typename BOp2,
+                typename P1, typename P2>
+            T ranges_(Rng1 &rng1, Rng2 &rng2, T init, BOp1 bop1, BOp2 bop2, P1 proj1, P2 proj2,
+                std::false_type) const
+            {
+                return inner_product(rng1, rng2, std::move(init), std::move(bop1), std::move(bop2),
+                    std::move(proj1), std::move(proj2));
+            }
+        public:
+            // Unary
+            template<typename I, typename S, typename T, typename BOp, typename F,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(IteratorRange<I, S>::value && Reduceable<I, T, BOp, F>::value)>
+#else
+                CONCEPT_REQUIRES_(IteratorRange<I, S>() && Reduceable<I, T, BOp, F>())>
+#endif
+            T operator()(I begin, S end, T init, BOp bop, F transform) const
+            {
+                return reduce(std::move(begin), std::move(end), std::move(init), std::move(bop),
+                    std::move(transform));
+            }
+
+            template<typename Rng, typename T, typename BOp, typename F,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(Range<Rng>::value && Reduceable<I, T, BOp, F>::value)>
+#else
+                CONCEPT_REQUIRES_(Range<Rng>() && Reduceable<I, T, BOp, F>())>
+#endif
+            T operator()(Rng && rng, T init, BOp bop, F transform) const
+            {
+                return reduce(begin(rng), end(rng), std::move(init), std::move(bop),
+                    std::move(transform));
+            }
+
+            // Binary
+            template<typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(
+                    IteratorRange<I1, S1>::value &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(
+                    IteratorRange<I1, S1>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+#endif
+            T operator()(I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return this->iterators_(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(init), std::move(bop1), std::move(bop2), std::move(proj1),
+                    std::move(proj2),
+                    meta::bool_<RandomAccessIterator<I1>::value &&
+                        SizedIteratorRange<I1, S1>::value && RandomAccessIterator<I2>::value>{});
+            }
+
+            template<typename Rng1, typename Rng2, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(
+                    Range<Rng1>::value && Range<Rng2>::value &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(
+                    Range<Rng1>() && Range<Rng2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+#endif
+            T operator()(Rng1 && rng1, Rng2 && rng2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return this->ranges_(rng1, rng2, std::move(init), std::move(bop1), std::move(bop2),
+                    std::move(proj1), std::move(proj2),
+                    meta::bool_<RandomAccessRange<Rng1>::value && SizedRange<Rng1>::value &&
+                        RandomAccessRange<Rng2>::value && SizedRange<Rng2>::value>{});
+            }
+
+            /// \overload
+            /// With a parallel policy, the larger subtrees of the reduction are
+            /// evaluated concurrently; the result is the same as without.
+            template<typename E, typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterator<I1>::value && SizedIteratorRange<I1, S1>::value &&
+                    RandomAccessIterator<I2>::value &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterator<I1>() && SizedIteratorRange<I1, S1>() &&
+                    RandomAccessIterator<I2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+#endif
+            T operator()(E &&, I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1_ = BOp1{},
+                BOp2 bop2_ = BOp2{}, P1 proj1_ = P1{}, P2 proj2_ = P2{}) const
+            {
+                auto &&bop1 = as_function(bop1_);
+                auto &&bop2 = as_function(bop2_);
+                auto &&proj1 = as_function(proj1_);
+                auto &&proj2 = as_function(proj2_);
+                return transform_reduce_fn::impl(begin1, begin2, end1 - begin1, std::move(init),
+                    bop1, bop2, proj1, proj2, detail::is_parallel_policy<E>{});
+            }
+
+            /// \overload
+            template<typename E, typename Rng1, typename Rng2, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(
+                    RandomAccessRange<Rng1>::value && SizedRange<Rng1>::value &&
+                    RandomAccessRange<Rng2>::value && SizedRange<Rng2>::value &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>::value
+                )>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(
+                    RandomAccessRange<Rng1>() && SizedRange<Rng1>() &&
+                    RandomAccessRange<Rng2>() && SizedRange<Rng2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+#endif
+            T operator()(E &&policy, Rng1 && rng1, Rng2 && rng2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                auto const n1 = distance(rng1), n2 = distance(rng2);
+                return (*this)(static_cast<E &&>(policy), begin(rng1),
+                    begin(rng1) + (n1 < n2 ? n1 : n2), begin(rng2), std::move(init),
+                    std::move(bop1), std::move(bop2), std::move(proj1), std::move(proj2));
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename T, typename BOp, typename F,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>::value),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>::value && SizedRange<Rng>::value &&
+                    Reduceable<I, T, BOp, F>::value)>
+#else
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>()),
+                CONCEPT_REQUIRES_(RandomAccessRange<Rng>() && SizedRange<Rng>() &&
+                    Reduceable<I, T, BOp, F>())>
+#endif
+            T operator()(E &&policy, Rng && rng, T init, BOp bop, F transform) const
+            {
+                return reduce(static_cast<E &&>(policy), begin(rng), end(rng), std::move(init),
+                    std::move(bop), std::move(transform));
+            }
+
+        };
+
+        /// \sa `transform_reduce_fn`
+        namespace
+        {
+            constexpr auto&& transform_reduce =
+                static_const<with_braced_init_args<transform_reduce_fn>>::value;
+        }
+    }
+}
+
+#endif
@@ -264,6 +264,30 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            // Views that hold nothing but iterators into some other range, so
+            // an iterator obtained from one copy of the view is just as good
+            // for any other copy. Views that cache their begin iterator keep
+            // the cache when they are copied if their base is one of these.
+            template<typename Rng>
+            struct is_iterator_pair
+              : std::false_type
+            {};
+
+            template<typename I, typename S>
+            struct is_iterator_pair<range<I, S>>
+              : std::true_type
+            {};
+
+            template<typename I, typename S>
+            struct is_iterator_pair<sized_range<I, S>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         struct make_range_fn
         {
             /// \return `{begin, end}`
@@ -263,6 +263,31 @@ namespace ranges
             {
                 return std::move(s.end());
             }
+            // Copies up to n elements into out and advances it past them, for
+            // cursors that provide a bulk read_n (see detail/bulk_read.hpp).
+            template<typename Cur, typename S, typename T>
+            static auto read_n(basic_iterator<Cur, S> &it, basic_sentinel<S> const &end, T *out,
+                std::ptrdiff_t n)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                it.pos().read_n(end.end(), out, n)
+            )
+            // Visits the segments from it up to end, for cursors of segmented
+            // ranges (see detail/segmented.hpp).
+            template<typename Cur, typename S, typename F>
+            static auto for_each_segment(basic_iterator<Cur, S> &it,
+                basic_iterator<Cur, S> const &end, F &fun)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                it.pos().for_each_segment(end.pos(), fun)
+            )
+            template<typename Cur, typename S, typename F>
+            static auto for_each_segment(basic_iterator<Cur, S> &it, basic_sentinel<S> const &end,
+                F &fun)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                it.pos().for_each_segment(end.end(), fun)
+            )
 
             template<typename RangeAdaptor>
             struct base_range
@@ -15,6 +15,7 @@
 #define RANGES_V3_RANGE_FWD_HPP
 
 #include <climits>
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 #include <meta/meta.hpp>
@@ -322,6 +323,68 @@ namespace ranges
             _max_ = INT_MAX
         };
 
+        namespace execution
+        {
+            struct sequenced_policy;
+            struct parallel_policy;
+            struct parallel_unsequenced_policy;
+        }
+
+        template<typename T>
+        struct is_execution_policy
+          : std::false_type
+        {};
+
+        template<>
+        struct is_execution_policy<execution::sequenced_policy>
+          : std::true_type
+        {};
+
+        template<>
+        struct is_execution_policy<execution::parallel_policy>
+          : std::true_type
+        {};
+
+        template<>
+        struct is_execution_policy<execution::parallel_unsequenced_policy>
+          : std::true_type
+        {};
+
+        /// \ingroup group-concepts
+        template<typename T>
+        using ExecutionPolicy = is_execution_policy<uncvref_t<T>>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename T>
+            using is_parallel_policy = meta::and_<
+                is_execution_policy<uncvref_t<T>>,
+                meta::not_<std::is_same<uncvref_t<T>, execution::sequenced_policy>>>;
+
+            // The algorithms' policy overloads reach the thread pool through
+            // these, which detail/thread_pool.hpp defines. That header comes
+            // with utility/execution.hpp, which is needed to name a policy,
+            // so only the code that uses one pays for <thread> and <mutex>.
+            constexpr std::ptrdiff_t parallel_grain_size()
+            {
+                return 1 << 12;
+            }
+
+            template<typename D>
+            D parallel_chunk_count(D n, D grain = parallel_grain_size());
+
+            template<typename D, typename F>
+            void parallel_for(D n, F fun, D grain = parallel_grain_size());
+
+            template<typename F, typename G>
+            void parallel_invoke(F f, G g);
+
+            template<typename D>
+            D hardware_concurrency();
+        }
+        /// \endcond
+
         template<typename Rng, typename Void = void>
         struct range_cardinality;
 
@@ -416,6 +479,14 @@ namespace ranges
             struct bounded_fn;
         }
 
+        template<typename Rng>
+        struct cache1_view;
+
+        namespace view
+        {
+            struct cache1_fn;
+        }
+
         template<typename Rng>
         struct const_view;
 
@@ -564,6 +635,14 @@ namespace ranges
             struct split_fn;
         }
 
+        template<typename Rng, typename Gen>
+        struct sample_view;
+
+        namespace view
+        {
+            struct sample_fn;
+        }
+
         template<typename Rng>
         struct single_view;
 
@@ -692,6 +771,9 @@ namespace ranges
         using iter_zip_with_view_detail::iter_zip_with_view;
 #endif
 
+        template<typename Fun, typename...Is>
+        struct zip_spans;
+
         template<typename Fun, typename ...Rngs>
         struct zip_with_view;
 
@@ -0,0 +1,327 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_SOA_VECTOR_HPP
+#define RANGES_V3_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+#include <range/v3/utility/common_tuple.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/contiguous.hpp>
+#include <range/v3/utility/tuple_algorithm.hpp>
+#include <range/v3/view/soa.hpp>
+#include <range/v3/view/zip_with.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// A sequence of records `std::tuple<Ts...>` stored as a structure of
+        /// arrays: one `std::vector` per field. Its elements are `common_tuple`s
+        /// of references into the columns, so it can be sorted, partitioned
+        /// and otherwise rearranged like a `std::vector` of tuples, while a
+        /// loop over one field reads that field's column alone. `column<N>()`
+        /// gives the `N`th column as a contiguous range.
+        template<typename...Ts>
+        struct soa_vector
+        {
+        private:
+            static_assert(sizeof...(Ts) != 0, "A soa_vector needs at least one column.");
+            using fun_ = detail::indirect_tuple_fn_;
+            using indices_ = meta::make_index_sequence<sizeof...(Ts)>;
+            using cursor_ = detail::zip_index_cursor<fun_, typename std::vector<Ts>::iterator...>;
+            using const_cursor_ =
+                detail::zip_index_cursor<fun_, typename std::vector<Ts>::const_iterator...>;
+            std::tuple<std::vector<Ts>...> cols_;
+
+            struct reserve_fn
+            {
+                std::size_t n;
+                template<typename V>
+                void operator()(V &v) const
+                {
+                    v.reserve(n);
+                }
+            };
+            struct resize_fn
+            {
+                std::size_t n;
+                template<typename V>
+                void operator()(V &v) const
+                {
+                    v.resize(n);
+                }
+            };
+            // Drops the elements past the first n; unlike erase, this needs
+            // nothing of the element type.
+            struct truncate_fn
+            {
+                std::size_t n;
+                template<typename V>
+                void operator()(V &v) const
+                {
+                    while(v.size() > n)
+                        v.pop_back();
+                }
+            };
+            struct erase_fn
+            {
+                std::ptrdiff_t first, last;
+                template<typename V>
+                void operator()(V &v) const
+                {
+                    v.erase(v.begin() + first, v.begin() + last);
+                }
+            };
+            struct clear_fn
+            {
+                template<typename V>
+                void operator()(V &v) const
+                {
+                    v.clear();
+                }
+            };
+
+            template<std::size_t...Ns>
+            std::tuple<typename std::vector<Ts>::iterator...>
+            begins_(meta::index_sequence<Ns...>)
+            {
+                return std::make_tuple(std::get<Ns>(cols_).begin()...);
+            }
+            template<std::size_t...Ns>
+            std::tuple<typename std::vector<Ts>::const_iterator...>
+            begins_(meta::index_sequence<Ns...>) const
+            {
+                return std::make_tuple(std::get<Ns>(cols_).begin()...);
+            }
+            // Appends to each column in turn. If one of them throws, the
+            // columns already appended to are cut back, so they keep a common
+            // length.
+            template<std::size_t...Ns, typename...Args>
+            void emplace_back_(meta::index_sequence<Ns...>, Args &&...args)
+            {
+                std::size_t const n = size();
+                try
+                {
+                    (void) std::initializer_list<int>{
+                        (std::get<Ns>(cols_).emplace_back(std::forward<Args>(args)), 0)...};
+                }
+                catch(...)
+                {
+                    tuple_for_each(cols_, truncate_fn{n});
+                    throw;
+                }
+            }
+            template<std::size_t...Ns>
+            void push_back_(std::tuple<Ts...> const &t, meta::index_sequence<Ns...> is)
+            {
+                emplace_back_(is, std::get<Ns>(t)...);
+            }
+            template<std::size_t...Ns>
+            void push_back_(std::tuple<Ts...> &&t, meta::index_sequence<Ns...> is)
+            {
+                emplace_back_(is, std::get<Ns>(std::move(t))...);
+            }
+        public:
+            using value_type = std::tuple<Ts...>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using iterator = basic_iterator<cursor_, cursor_>;
+            using const_iterator = basic_iterator<const_cursor_, const_cursor_>;
+            using reference = iterator_reference_t<iterator>;
+            using const_reference = iterator_reference_t<const_iterator>;
+
+            soa_vector() = default;
+            explicit soa_vector(size_type n)
+              : cols_(std::vector<Ts>(n)...)
+            {}
+            soa_vector(std::initializer_list<value_type> il)
+            {
+                reserve(il.size());
+                for(value_type const &t : il)
+                    push_back(t);
+            }
+
+            iterator begin()
+            {
+                return iterator{cursor_{fun_{}, begins_(indices_{}), 0}};
+            }
+            iterator end()
+            {
+                return iterator{cursor_{fun_{}, begins_(indices_{}),
+                    static_cast<difference_type>(size())}};
+            }
+            const_iterator begin() const
+            {
+                return const_iterator{const_cursor_{fun_{}, begins_(indices_{}), 0}};
+            }
+            const_iterator end() const
+            {
+                return const_iterator{const_cursor_{fun_{}, begins_(indices_{}),
+                    static_cast<difference_type>(size())}};
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+
+            size_type size() const
+            {
+                return std::get<0>(cols_).size();
+            }
+            bool empty() const
+            {
+                return size() == 0;
+            }
+            void reserve(size_type n)
+            {
+                tuple_for_each(cols_, reserve_fn{n});
+            }
+            void resize(size_type n)
+            {
+                tuple_for_each(cols_, resize_fn{n});
+            }
+            void clear()
+            {
+                tuple_for_each(cols_, clear_fn{});
+            }
+
+            reference operator[](size_type i)
+            {
+                RANGES_ASSERT(i < size());
+                return begin()[static_cast<difference_type>(i)];
+            }
+            const_reference operator[](size_type i) const
+            {
+                RANGES_ASSERT(i < size());
+                return begin()[static_cast<difference_type>(i)];
+            }
+            reference front()
+            {
+                return (*this)[0];
+            }
+            const_reference front() const
+            {
+                return (*this)[0];
+            }
+            reference back()
+            {
+                return (*this)[size() - 1];
+            }
+            const_reference back() const
+            {
+                return (*this)[size() - 1];
+            }
+
+            void push_back(value_type const &t)
+            {
+                push_back_(t, indices_{});
+            }
+            void push_back(value_type &&t)
+            {
+                push_back_(std::move(t), indices_{});
+            }
+            /// Appends a record whose fields are constructed from `args`, one
+            /// argument per column.
+            template<typename...Args,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(sizeof...(Args) == sizeof...(Ts) &&
+                    meta::and_<Constructible<Ts, Args &&>...>::value)>
+#else
+                CONCEPT_REQUIRES_(sizeof...(Args) == sizeof...(Ts) &&
+                    meta::and_<Constructible<Ts, Args &&>...>())>
+#endif
+            void emplace_back(Args &&...args)
+            {
+                emplace_back_(indices_{}, std::forward<Args>(args)...);
+            }
+            void pop_back()
+            {
+                RANGES_ASSERT(!empty());
+                tuple_for_each(cols_, truncate_fn{size() - 1});
+            }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                difference_type const f = first - cbegin();
+                tuple_for_each(cols_, erase_fn{f, last - cbegin()});
+                return begin() + f;
+            }
+            iterator erase(const_iterator pos)
+            {
+                return erase(pos, pos + 1);
+            }
+
+            /// The `N`th field of every record, in a contiguous range.
+            template<std::size_t N>
+            range<meta::at_c<meta::list<Ts...>, N> *> column()
+            {
+                return as_contiguous_range(std::get<N>(cols_).begin(), std::get<N>(cols_).end());
+            }
+            template<std::size_t N>
+            range<meta::at_c<meta::list<Ts...>, N> const *> column() const
+            {
+                return as_contiguous_range(std::get<N>(cols_).begin(), std::get<N>(cols_).end());
+            }
+            std::tuple<std::vector<Ts>...> const &columns() const
+            {
+                return cols_;
+            }
+
+            /// The columns as a `zip_spans`, which the whole-range algorithms
+            /// walk with a single index.
+            zip_spans<fun_, typename std::vector<Ts>::iterator...> spans()
+            {
+                return {fun_{}, begins_(indices_{}), static_cast<difference_type>(size())};
+            }
+            zip_spans<fun_, typename std::vector<Ts>::const_iterator...> spans() const
+            {
+                return {fun_{}, begins_(indices_{}), static_cast<difference_type>(size())};
+            }
+
+            void swap(soa_vector &that)
+            {
+                cols_.swap(that.cols_);
+            }
+            friend void swap(soa_vector &a, soa_vector &b)
+            {
+                a.swap(b);
+            }
+            friend bool operator==(soa_vector const &a, soa_vector const &b)
+            {
+                return a.cols_ == b.cols_;
+            }
+            friend bool operator!=(soa_vector const &a, soa_vector const &b)
+            {
+                return !(a == b);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
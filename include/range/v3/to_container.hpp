@@ -14,12 +14,17 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/action/concepts.hpp>
+#include <range/v3/detail/bulk_read.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 #ifndef RANGES_NO_STD_FORWARD_DECLARATIONS
 // Non-portable forward declarations of standard containers
@@ -46,6 +51,195 @@ namespace ranges
                 ConvertibleTo<range_value_t<Rng>, range_value_t<Cont>>,
                 Constructible<Cont, I, I>>;
 
+            template<typename Cont, typename Ref, typename Enable = void>
+            struct is_appendable
+              : std::false_type
+            {};
+
+            template<typename Cont, typename Ref>
+            struct is_appendable<Cont, Ref,
+                meta::void_<decltype(std::declval<Cont &>().insert(std::declval<Cont &>().end(),
+                    std::declval<Ref>()))>>
+              : std::true_type
+            {};
+
+            template<typename Cont, typename I, typename Enable = void>
+            struct is_range_appendable
+              : std::false_type
+            {};
+
+            template<typename Cont, typename I>
+            struct is_range_appendable<Cont, I,
+                meta::void_<decltype(std::declval<Cont &>().insert(std::declval<Cont &>().end(),
+                    std::declval<I>(), std::declval<I>()))>>
+              : std::true_type
+            {};
+
+            // Containers that can take the elements of Rng one at a time at
+            // their end are filled by container_append; forward_list, for one,
+            // can't.
+            template<typename Cont, typename Rng>
+            using AppendableFrom = is_appendable<Cont, range_reference_t<Rng>>;
+
+            // Appends the elements of a range to a container, in the cheapest
+            // way the two allow between them:
+            //  - a random-access iterator pair is inserted at once, which
+            //    allocates once and, for a vector of trivially copyable values
+            //    read through pointers or vector iterators, is a memmove,
+            //  - a segmented range (see detail/segmented.hpp) has each of its
+            //    segments appended that way in turn,
+            //  - a range that pushes its elements (see detail/for_each_until.hpp)
+            //    pushes them into the container,
+            //  - a bulk-readable range (see detail/bulk_read.hpp) is read and
+            //    inserted a block at a time,
+            //  - anything else is inserted element by element.
+            // The container first reserves what the range's size hint says it
+            // will need at least. While it grows, its capacity doubles, but not
+            // beyond what the hint allows at most, so a filtered vector doesn't
+            // end up with nearly twice the room its elements need.
+            struct container_append
+            {
+            private:
+                template<typename Cont>
+                static void reserve_(Cont &c, std::size_t n, std::true_type)
+                {
+                    if(n > static_cast<std::size_t>(c.size()))
+                        c.reserve(n);
+                }
+                template<typename Cont>
+                static void reserve_(Cont &, std::size_t, std::false_type)
+                {}
+                template<typename Cont>
+                static void grow_(Cont &c, std::size_t n, std::size_t cap, std::true_type)
+                {
+                    auto const need = static_cast<std::size_t>(c.size()) + n;
+                    auto const have = static_cast<std::size_t>(c.capacity());
+                    if(need > have)
+                        c.reserve(std::max(need, std::min(2 * have, cap)));
+                }
+                template<typename Cont>
+                static void grow_(Cont &, std::size_t, std::size_t, std::false_type)
+                {}
+
+                template<typename Cont, typename I, typename S>
+                static I each_(Cont &c, I it, S const &end, std::size_t cap)
+                {
+                    for(; it != end; ++it)
+                    {
+                        container_append::grow_(c, 1, cap, has_capacity<Cont>{});
+                        c.insert(c.end(), *it);
+                    }
+                    return it;
+                }
+
+                template<typename Cont, typename I, typename S>
+                static I blocks_(Cont &c, I it, S const &end, std::size_t cap, std::true_type)
+                {
+                    iterator_value_t<I> block[detail::bulk_read_size()];
+                    while(true)
+                    {
+                        std::ptrdiff_t const n =
+                            range_access::read_n(it, end, block, detail::bulk_read_size());
+                        container_append::grow_(c, static_cast<std::size_t>(n), cap,
+                            has_capacity<Cont>{});
+                        c.insert(c.end(), block + 0, block + n);
+                        if(n != detail::bulk_read_size())
+                            return it;
+                    }
+                }
+                template<typename Cont, typename I, typename S>
+                static I blocks_(Cont &c, I it, S const &end, std::size_t cap, std::false_type)
+                {
+                    return container_append::each_(c, std::move(it), end, cap);
+                }
+
+                template<typename Cont>
+                struct segment_fn
+                {
+                    Cont &c;
+                    std::size_t cap;
+                    template<typename L, typename LS>
+                    L operator()(L begin, LS end) const
+                    {
+                        return container_append::iterators(c, std::move(begin), end, cap);
+                    }
+                };
+                template<typename Cont, typename I, typename S>
+                static I segments_(Cont &c, I it, S const &end, std::size_t cap, std::true_type)
+                {
+                    segment_fn<Cont> fun{c, cap};
+                    return detail::for_each_segment(std::move(it), end, fun);
+                }
+                template<typename Cont, typename I, typename S>
+                static I segments_(Cont &c, I it, S const &end, std::size_t cap, std::false_type)
+                {
+                    return container_append::blocks_(c, std::move(it), end, cap,
+                        meta::bool_<is_bulk_readable<I, S>::value &&
+                            is_range_appendable<Cont, iterator_value_t<I> *>::value>{});
+                }
+
+                template<typename Cont, typename I, typename S>
+                static I at_once_(Cont &c, I it, S const &end, std::size_t, std::true_type)
+                {
+                    c.insert(c.end(), it, end);
+                    return end;
+                }
+                template<typename Cont, typename I, typename S>
+                static I at_once_(Cont &c, I it, S const &end, std::size_t cap, std::false_type)
+                {
+                    return container_append::segments_(c, std::move(it), end, cap,
+                        is_segmented<I, S>{});
+                }
+
+                template<typename Cont, typename I, typename S>
+                using AtOnce = meta::and_<Same<I, S>, RandomAccessIterator<I>,
+                    is_range_appendable<Cont, I>>;
+
+                template<typename Cont>
+                struct push_sink
+                {
+                    Cont &c;
+                    std::size_t cap;
+                    template<typename T>
+                    bool operator()(T &&t) const
+                    {
+                        container_append::grow_(c, 1, cap, has_capacity<Cont>{});
+                        c.insert(c.end(), static_cast<T &&>(t));
+                        return false;
+                    }
+                };
+                template<typename Cont, typename Rng>
+                static void range_(Cont &c, Rng &rng, std::size_t cap, std::true_type)
+                {
+                    push_sink<Cont> sink{c, cap};
+                    detail::for_each_until(rng, sink);
+                }
+                template<typename Cont, typename Rng>
+                static void range_(Cont &c, Rng &rng, std::size_t cap, std::false_type)
+                {
+                    container_append::iterators(c, ranges::begin(rng), ranges::end(rng), cap);
+                }
+            public:
+                // Appends [it, end) to c, letting c's capacity grow up to cap,
+                // and returns the iterator that compares equal to end.
+                template<typename Cont, typename I, typename S>
+                static I iterators(Cont &c, I it, S const &end, std::size_t cap)
+                {
+                    return container_append::at_once_(c, std::move(it), end, cap,
+                        AtOnce<Cont, I, S>{});
+                }
+                template<typename Cont, typename Rng>
+                static void range(Cont &c, Rng &rng)
+                {
+                    auto const size = static_cast<std::size_t>(c.size());
+                    auto const hint = detail::range_size_hint(rng);
+                    container_append::reserve_(c, detail::saturating_add(size, hint.lower),
+                        Reservable<Cont>{});
+                    container_append::range_(c, rng, detail::saturating_add(size, hint.upper),
+                        push_unsegmented<Rng>{});
+                }
+            };
+
             template<typename ContainerMetafunctionClass>
             struct to_container_fn
               : pipeable<to_container_fn<ContainerMetafunctionClass>>
@@ -88,6 +282,19 @@ namespace ranges
                     return c;
                 }
 
+                template<typename Cont, typename Rng>
+                Cont fill_(Rng &&rng, std::true_type) const
+                {
+                    Cont c;
+                    container_append::range(c, rng);
+                    return c;
+                }
+                template<typename Cont, typename Rng>
+                Cont fill_(Rng &&rng, std::false_type) const
+                {
+                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                }
+
             public:
                 template<typename Rng,
                     typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
@@ -100,7 +307,33 @@ namespace ranges
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                    return this->fill_<Cont>(std::forward<Rng>(rng), AppendableFrom<Cont, Rng>{});
+                }
+            };
+
+            template<typename Cont>
+            struct assign_to_fn
+              : pipeable<assign_to_fn<Cont>>
+            {
+            private:
+                Cont *c_;
+            public:
+                assign_to_fn(Cont &c)
+                  : c_(&c)
+                {}
+                template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Range<Rng>::value && AppendableFrom<Cont, Rng>::value)>
+#else
+                    CONCEPT_REQUIRES_(Range<Rng>() && AppendableFrom<Cont, Rng>())>
+#endif
+                Cont &operator()(Rng && rng) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to assign an infinite range to a container.");
+                    c_->clear();
+                    container_append::range(*c_, rng);
+                    return *c_;
                 }
             };
         }
@@ -179,6 +412,17 @@ namespace ranges
             return list | ranges::to_<Cont>();
         }
 
+        /// \brief Replaces the elements of `c` with those of a Range, keeping the
+        /// storage `c` already has: `rng | assign_to(c)` returns `c`. Filling a
+        /// container that is reused across calls this way allocates only when
+        /// the range has more elements than `c` has ever held. `rng` must not
+        /// refer to the elements of `c`.
+        template<typename Cont>
+        detail::assign_to_fn<Cont> assign_to(Cont &c)
+        {
+            return {c};
+        }
+
         /// @}
     }
 }
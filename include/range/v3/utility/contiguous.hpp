@@ -0,0 +1,99 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_CONTIGUOUS_HPP
+#define RANGES_V3_UTILITY_CONTIGUOUS_HPP
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Whether the elements an `I` denotes are laid out one after another
+        /// in memory, so that `addressof(*(i + n)) == addressof(*i) + n`. It is
+        /// true for pointers and for the iterators of `std::vector`,
+        /// `std::basic_string` and `std::array` in libstdc++ and libc++;
+        /// specialize it for other iterators that have this property.
+        template<typename I>
+        struct is_contiguous_iterator
+          : std::false_type
+        {};
+
+        template<typename T>
+        struct is_contiguous_iterator<T *>
+          : std::is_object<T>
+        {};
+
+    #ifdef __GLIBCXX__
+        template<typename T, typename Container>
+        struct is_contiguous_iterator<__gnu_cxx::__normal_iterator<T *, Container>>
+          : std::is_object<T>
+        {};
+    #endif
+    #ifdef _LIBCPP_VERSION
+        template<typename T>
+        struct is_contiguous_iterator<std::__wrap_iter<T *>>
+          : std::is_object<T>
+        {};
+    #endif
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I>
+            using contiguous_element_t =
+                meta::_t<std::remove_reference<iterator_reference_t<I>>>;
+        }
+        /// \endcond
+
+        /// \ingroup group-concepts
+        template<typename I>
+        using ContiguousIterator = meta::fast_and<
+            RandomAccessIterator<I>,
+            is_contiguous_iterator<I>,
+            std::is_lvalue_reference<iterator_reference_t<I>>>;
+
+        /// The elements of `[begin, end)` as a range of pointers. An empty
+        /// range yields a pair of null pointers, since an empty range of
+        /// iterators need not have an element to take the address of.
+        template<typename I, typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES_(ContiguousIterator<I>::value && SizedIteratorRange<I, S>::value)>
+#else
+            CONCEPT_REQUIRES_(ContiguousIterator<I>() && SizedIteratorRange<I, S>())>
+#endif
+        range<detail::contiguous_element_t<I> *>
+        as_contiguous_range(I begin, S end)
+        {
+            if(begin == end)
+                return {nullptr, nullptr};
+            auto const p = std::addressof(*begin);
+            return {p, p + (end - begin)};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,55 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EXECUTION_HPP
+#define RANGES_V3_UTILITY_EXECUTION_HPP
+
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/detail/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+        namespace execution
+        {
+            /// Run the algorithm on the calling thread, exactly like the
+            /// overload that takes no policy.
+            struct sequenced_policy
+            {};
+
+            /// Allow the algorithm to split its input into chunks and process
+            /// them concurrently on the library's thread pool.
+            struct parallel_policy
+            {};
+
+            /// Like `parallel_policy`, and additionally permits the element
+            /// accesses within a chunk to be interleaved (vectorized).
+            struct parallel_unsequenced_policy
+            {};
+
+            namespace
+            {
+                constexpr auto&& seq = static_const<sequenced_policy>::value;
+                constexpr auto&& par = static_const<parallel_policy>::value;
+                constexpr auto&& par_unseq = static_const<parallel_unsequenced_policy>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
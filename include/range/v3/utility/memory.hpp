@@ -21,7 +21,9 @@
 #ifndef RANGES_V3_UTILITY_MEMORY_HPP
 #define RANGES_V3_UTILITY_MEMORY_HPP
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -166,6 +168,72 @@ namespace ranges
             return counted_iterator<raw_storage_iterator<I, V>, detail::external_count<D>>{
                 raw_storage_iterator<I, V>{std::move(i)}, d};
         }
+
+        /// Uninitialized storage for objects of type `T` that a caller owns
+        /// and lends to `stable_sort`, `stable_partition` or `inplace_merge`
+        /// in place of the temporary buffer they would otherwise allocate
+        /// on every call. The algorithms construct and destroy objects in it
+        /// as they go and never resize it; when it holds fewer objects than
+        /// the algorithm's `buffer_size()` asks for, they do more moves.
+        /// `T` must not be over-aligned.
+        template<typename T>
+        struct scratch_buffer
+        {
+        private:
+            // The storage comes from the global operator new, which only
+            // aligns it for the fundamental types.
+            static_assert(alignof(T) <= alignof(std::max_align_t),
+                "scratch_buffer can't hold over-aligned types");
+            struct deallocate
+            {
+                void operator()(T *p) const noexcept
+                {
+                    ::operator delete(static_cast<void *>(p));
+                }
+            };
+            std::unique_ptr<T, deallocate> data_;
+            std::ptrdiff_t capacity_;
+        public:
+            scratch_buffer()
+              : data_{}, capacity_(0)
+            {}
+            explicit scratch_buffer(std::ptrdiff_t n)
+              : scratch_buffer{}
+            {
+                reserve(n);
+            }
+            scratch_buffer(scratch_buffer &&that) noexcept
+              : data_(std::move(that.data_)), capacity_(that.capacity_)
+            {
+                that.capacity_ = 0;
+            }
+            scratch_buffer &operator=(scratch_buffer &&that) noexcept
+            {
+                data_ = std::move(that.data_);
+                capacity_ = that.capacity_;
+                that.capacity_ = 0;
+                return *this;
+            }
+            /// Grows the storage to room for at least `n` objects.
+            void reserve(std::ptrdiff_t n)
+            {
+                if(n <= capacity_)
+                    return;
+                data_.reset();
+                capacity_ = 0;
+                data_.reset(static_cast<T *>(
+                    ::operator new(static_cast<std::size_t>(n) * sizeof(T))));
+                capacity_ = n;
+            }
+            T *data() const noexcept
+            {
+                return data_.get();
+            }
+            std::ptrdiff_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+        };
         /// @}
     }
 }
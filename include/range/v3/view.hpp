@@ -23,6 +23,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/bounded.hpp>
 #include <range/v3/view/c_str.hpp>
+#include <range/v3/view/cache1.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/const.hpp>
 #include <range/v3/view/counted.hpp>
@@ -42,7 +43,10 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/mapped_lines.hpp>
+#include <range/v3/view/merge_k.hpp>
 #include <range/v3/view/move.hpp>
+#include <range/v3/view/parse_numbers.hpp>
 #include <range/v3/view/partial_sum.hpp>
 #include <range/v3/view/repeat.hpp>
 #include <range/v3/view/repeat_n.hpp>
@@ -50,8 +54,11 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/replace.hpp>
 #include <range/v3/view/replace_if.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/set_algorithm.hpp>
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/slice.hpp>
+#include <range/v3/view/soa.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/tail.hpp>
@@ -14,7 +14,9 @@
 #ifndef RANGES_V3_VIEW_ANY_VIEW_HPP
 #define RANGES_V3_VIEW_ANY_VIEW_HPP
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
@@ -24,6 +26,12 @@
 #include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
 
+/// The number of bytes an `any_view` iterator or sentinel stores inline before
+/// it falls back to allocating the erased iterator or sentinel on the heap.
+#ifndef RANGES_ANY_VIEW_BUFFER_SIZE
+#define RANGES_ANY_VIEW_BUFFER_SIZE (4 * sizeof(void *))
+#endif
+
 namespace ranges
 {
     inline namespace v3
@@ -39,157 +47,248 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            struct any_object
-            {
-                virtual ~any_object() {}
-            };
+            // Cursors and sentinels of the erased range live in a small inline
+            // buffer when they fit, and on the heap otherwise. Their operations
+            // are dispatched through a static table of function pointers, so
+            // copying an any_view iterator allocates nothing in the common case.
+            using any_buffer =
+                meta::_t<std::aligned_storage<RANGES_ANY_VIEW_BUFFER_SIZE, alignof(void *)>>;
 
-            template<class T>
-            struct object : any_object
-            {
-            private:
-                T obj;
-            public:
-                object() = default;
-                object(T o) : obj(std::move(o)) {}
-                T &get() { return obj; }
-                T const &get() const { return obj; }
-            };
+            template<typename T>
+            using any_fits_inline = meta::bool_<
+                sizeof(T) <= sizeof(any_buffer) &&
+                alignof(any_buffer) % alignof(T) == 0 &&
+                std::is_nothrow_move_constructible<T>::value>;
 
-            template<typename Ref, category Cat = category::input>
-            struct any_cursor_interface
+            template<typename T, bool Inline = any_fits_inline<T>::value>
+            struct any_buffer_ops
             {
-                virtual ~any_cursor_interface() {}
-                virtual any_object const &iter() const = 0;
-                virtual Ref current() const = 0;
-                virtual bool equal(any_cursor_interface const &) const = 0;
-                virtual void next() = 0;
-                virtual any_cursor_interface *clone_() const = 0;
-                any_cursor_interface *clone() const
+                static T &get(any_buffer &buf) noexcept
+                {
+                    return *static_cast<T *>(static_cast<void *>(&buf));
+                }
+                static T const &get(any_buffer const &buf) noexcept
+                {
+                    return *static_cast<T const *>(static_cast<void const *>(&buf));
+                }
+                static void create(any_buffer &buf, T t)
+                {
+                    ::new(static_cast<void *>(&buf)) T(std::move(t));
+                }
+                static void copy(any_buffer &to, any_buffer const &from)
                 {
-                    return this->clone_();
+                    ::new(static_cast<void *>(&to)) T(get(from));
+                }
+                static void move(any_buffer &to, any_buffer &from) noexcept
+                {
+                    ::new(static_cast<void *>(&to)) T(std::move(get(from)));
+                    get(from).~T();
+                }
+                static void destroy(any_buffer &buf) noexcept
+                {
+                    get(buf).~T();
                 }
             };
 
-            template<typename Ref>
-            struct any_cursor_interface<Ref, category::forward>
-              : any_cursor_interface<Ref, category::input>
+            template<typename T>
+            struct any_buffer_ops<T, false>
             {
-                any_cursor_interface *clone() const
+                static T *&ptr(any_buffer &buf) noexcept
+                {
+                    return *static_cast<T **>(static_cast<void *>(&buf));
+                }
+                static T *const &ptr(any_buffer const &buf) noexcept
+                {
+                    return *static_cast<T *const *>(static_cast<void const *>(&buf));
+                }
+                static T &get(any_buffer &buf) noexcept
+                {
+                    return *ptr(buf);
+                }
+                static T const &get(any_buffer const &buf) noexcept
+                {
+                    return *ptr(buf);
+                }
+                static void create(any_buffer &buf, T t)
+                {
+                    ptr(buf) = new T(std::move(t));
+                }
+                static void copy(any_buffer &to, any_buffer const &from)
+                {
+                    ptr(to) = new T(get(from));
+                }
+                static void move(any_buffer &to, any_buffer &from) noexcept
                 {
-                    return static_cast<any_cursor_interface *>(this->clone_());
+                    ptr(to) = ptr(from);
+                }
+                static void destroy(any_buffer &buf) noexcept
+                {
+                    delete ptr(buf);
                 }
             };
 
-            template<typename Ref>
-            struct any_cursor_interface<Ref, category::bidirectional>
-              : any_cursor_interface<Ref, category::forward>
+            // A unique address per erased iterator type, used to check that a
+            // cursor and a sentinel (or two cursors) came from the same range.
+            template<typename T>
+            struct any_type_id
             {
-                virtual void prev() = 0;
-                any_cursor_interface *clone() const
-                {
-                    return static_cast<any_cursor_interface *>(this->clone_());
-                }
+                static constexpr char id = 0;
             };
 
+            template<typename T>
+            constexpr char any_type_id<T>::id;
+
+            // Whether an erased cursor can copy its elements into a caller's
+            // buffer of values a block at a time (see detail/bulk_read.hpp).
             template<typename Ref>
-            struct any_cursor_interface<Ref, category::random_access>
-              : any_cursor_interface<Ref, category::bidirectional>
+            using any_bulk_readable = meta::and_<
+                meta::not_<std::is_reference<Ref>>,
+                std::is_default_constructible<uncvref_t<Ref>>,
+                std::is_assignable<uncvref_t<Ref> &, Ref>>;
+
+            template<typename Ref, category Cat>
+            struct any_cursor_vtable
             {
-                virtual void advance(std::ptrdiff_t) = 0;
-                virtual std::ptrdiff_t distance_to(any_cursor_interface const &) const = 0;
-                any_cursor_interface *clone() const
-                {
-                    return static_cast<any_cursor_interface *>(this->clone_());
-                }
+                void const *type;
+                void (*copy)(any_buffer &, any_buffer const &);
+                void (*move)(any_buffer &, any_buffer &);
+                void (*destroy)(any_buffer &);
+                Ref (*current)(any_buffer const &);
+                bool (*equal)(any_buffer const &, any_buffer const &);
+                void (*next)(any_buffer &);
+                void (*prev)(any_buffer &);
+                void (*advance)(any_buffer &, std::ptrdiff_t);
+                std::ptrdiff_t (*distance_to)(any_buffer const &, any_buffer const &);
+                void const *sentinel_type;
+                std::ptrdiff_t (*read_n)(any_buffer &, any_buffer const &, uncvref_t<Ref> *,
+                    std::ptrdiff_t);
             };
 
-            template<typename S, typename I>
-            struct any_sentinel_impl;
-
-            template<typename I, category Cat>
+            template<typename I, typename S, typename Ref, category Cat>
             struct any_cursor_impl
-              : any_cursor_interface<iterator_reference_t<I>, Cat>
+              : any_buffer_ops<I>
             {
             private:
-                template<typename S, typename II>
-                friend struct any_sentinel_impl;
-                using Ref = iterator_reference_t<I>;
-                object<I> it_;
-            public:
-                any_cursor_impl() = default;
-                any_cursor_impl(I it)
-                  : it_{std::move(it)}
-                {}
-                object<I> const &iter() const
+                using ops = any_buffer_ops<I>;
+                static constexpr void (*prev_(std::false_type))(any_buffer &)
                 {
-                    return it_;
+                    return nullptr;
                 }
-                Ref current() const
+                static constexpr void (*prev_(std::true_type))(any_buffer &)
                 {
-                    return *it_.get();
+                    return &any_cursor_impl::prev;
                 }
-                bool equal(any_cursor_interface<Ref, category::input> const &that) const
+                static constexpr void (*advance_(std::false_type))(any_buffer &, std::ptrdiff_t)
                 {
-                    any_cursor_impl const *pthat =
-                        dynamic_cast<any_cursor_impl const *>(&that);
-                    RANGES_ASSERT(pthat != nullptr);
-                    return pthat->it_.get() == it_.get();
+                    return nullptr;
                 }
-                void next()
+                static constexpr void (*advance_(std::true_type))(any_buffer &, std::ptrdiff_t)
                 {
-                    ++it_.get();
+                    return &any_cursor_impl::advance;
                 }
-                any_cursor_impl *clone_() const
+                static constexpr std::ptrdiff_t (*distance_to_(std::false_type))(any_buffer const &,
+                    any_buffer const &)
                 {
-                    return new any_cursor_impl{it_.get()};
+                    return nullptr;
                 }
-                void prev()
+                static constexpr std::ptrdiff_t (*distance_to_(std::true_type))(any_buffer const &,
+                    any_buffer const &)
                 {
-                    --it_.get();
+                    return &any_cursor_impl::distance_to;
                 }
-                void advance(std::ptrdiff_t n)
+                static constexpr std::ptrdiff_t (*read_n_(std::false_type))(any_buffer &,
+                    any_buffer const &, uncvref_t<Ref> *, std::ptrdiff_t)
+                {
+                    return nullptr;
+                }
+                static constexpr std::ptrdiff_t (*read_n_(std::true_type))(any_buffer &,
+                    any_buffer const &, uncvref_t<Ref> *, std::ptrdiff_t)
+                {
+                    return &any_cursor_impl::read_n;
+                }
+            public:
+                static Ref current(any_buffer const &buf)
+                {
+                    return *ops::get(buf);
+                }
+                static bool equal(any_buffer const &x, any_buffer const &y)
                 {
-                    it_.get() += n;
+                    return ops::get(x) == ops::get(y);
                 }
-                std::ptrdiff_t distance_to(
-                    any_cursor_interface<Ref, category::random_access> const &that) const
+                static void next(any_buffer &buf)
                 {
-                    any_cursor_impl const *pthat =
-                        dynamic_cast<any_cursor_impl const *>(&that);
-                    RANGES_ASSERT(pthat != nullptr);
-                    return pthat->it_.get() - it_.get();
+                    ++ops::get(buf);
                 }
+                static void prev(any_buffer &buf)
+                {
+                    --ops::get(buf);
+                }
+                static void advance(any_buffer &buf, std::ptrdiff_t n)
+                {
+                    ops::get(buf) += static_cast<iterator_difference_t<I>>(n);
+                }
+                static std::ptrdiff_t distance_to(any_buffer const &x, any_buffer const &y)
+                {
+                    return static_cast<std::ptrdiff_t>(ops::get(y) - ops::get(x));
+                }
+                static std::ptrdiff_t read_n(any_buffer &buf, any_buffer const &end,
+                    uncvref_t<Ref> *out, std::ptrdiff_t n)
+                {
+                    I &it = ops::get(buf);
+                    S const &last = any_buffer_ops<S>::get(end);
+                    std::ptrdiff_t i = 0;
+                    for(; i != n && it != last; ++i, ++it)
+                        out[i] = Ref(*it);
+                    return i;
+                }
+                static any_cursor_vtable<Ref, Cat> const vtable;
+            };
+
+            template<typename I, typename S, typename Ref, category Cat>
+            any_cursor_vtable<Ref, Cat> const any_cursor_impl<I, S, Ref, Cat>::vtable = {
+                &any_type_id<I>::id,
+                &any_cursor_impl::copy,
+                &any_cursor_impl::move,
+                &any_cursor_impl::destroy,
+                &any_cursor_impl::current,
+                &any_cursor_impl::equal,
+                &any_cursor_impl::next,
+                any_cursor_impl::prev_(meta::bool_<Cat >= category::bidirectional>{}),
+                any_cursor_impl::advance_(meta::bool_<Cat >= category::random_access>{}),
+                any_cursor_impl::distance_to_(meta::bool_<Cat >= category::random_access>{}),
+                &any_type_id<S>::id,
+                any_cursor_impl::read_n_(any_bulk_readable<Ref>{})
             };
 
-            struct any_sentinel_interface
+            struct any_sentinel_vtable
             {
-                virtual ~any_sentinel_interface() {}
-                virtual bool equal(any_object const &) const = 0;
-                virtual any_sentinel_interface *clone() const = 0;
+                void const *type;
+                void (*copy)(any_buffer &, any_buffer const &);
+                void (*move)(any_buffer &, any_buffer &);
+                void (*destroy)(any_buffer &);
+                bool (*equal)(any_buffer const &, any_buffer const &);
+                void const *sentinel_type;
             };
 
             template<typename S, typename I>
             struct any_sentinel_impl
-              : any_sentinel_interface
+              : any_buffer_ops<S>
             {
-            private:
-                S s_;
-            public:
-                any_sentinel_impl() = default;
-                any_sentinel_impl(S s)
-                  : s_(std::move(s))
-                {}
-                bool equal(any_object const &that) const
-                {
-                    object<I> const *pthat = dynamic_cast<object<I> const *>(&that);
-                    RANGES_ASSERT(pthat != nullptr);
-                    return s_ == pthat->get();
-                }
-                any_sentinel_impl *clone() const
+                static bool equal(any_buffer const &s, any_buffer const &i)
                 {
-                    return new any_sentinel_impl{s_};
+                    return any_buffer_ops<S>::get(s) == any_buffer_ops<I>::get(i);
                 }
+                static any_sentinel_vtable const vtable;
+            };
+
+            template<typename S, typename I>
+            any_sentinel_vtable const any_sentinel_impl<S, I>::vtable = {
+                &any_type_id<I>::id,
+                &any_sentinel_impl::copy,
+                &any_sentinel_impl::move,
+                &any_sentinel_impl::destroy,
+                &any_sentinel_impl::equal,
+                &any_type_id<S>::id
             };
 
             struct any_sentinel;
@@ -199,7 +298,15 @@ namespace ranges
             {
             private:
                 friend struct any_sentinel;
-                std::unique_ptr<any_cursor_interface<Ref, Cat>> ptr_;
+                any_buffer buf_;
+                any_cursor_vtable<Ref, Cat> const *vtbl_ = nullptr;
+
+                void reset() noexcept
+                {
+                    if(vtbl_)
+                        vtbl_->destroy(buf_);
+                    vtbl_ = nullptr;
+                }
             public:
                 using single_pass = meta::bool_<Cat == category::input>;
                 any_cursor() = default;
@@ -214,57 +321,112 @@ namespace ranges
                                       ConvertibleTo<range_reference_t<Rng>, Ref>())>
 #endif
                 any_cursor(Rng &&rng, begin_tag)
-                  : ptr_{new any_cursor_impl<range_iterator_t<Rng>, Cat>{begin(rng)}}
-                {}
-                any_cursor(any_cursor &&) = default;
+                {
+                    using impl = any_cursor_impl<range_iterator_t<Rng>, range_sentinel_t<Rng>,
+                        Ref, Cat>;
+                    impl::create(buf_, begin(rng));
+                    vtbl_ = &impl::vtable;
+                }
+                any_cursor(any_cursor &&that) noexcept
+                  : vtbl_(that.vtbl_)
+                {
+                    if(vtbl_)
+                        vtbl_->move(buf_, that.buf_);
+                    that.vtbl_ = nullptr;
+                }
                 any_cursor(any_cursor const &that)
-                  : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-                {}
-                any_cursor &operator=(any_cursor &&) = default;
+                {
+                    if(that.vtbl_)
+                        that.vtbl_->copy(buf_, that.buf_);
+                    vtbl_ = that.vtbl_;
+                }
+                ~any_cursor()
+                {
+                    reset();
+                }
+                any_cursor &operator=(any_cursor &&that) noexcept
+                {
+                    if(this != &that)
+                    {
+                        reset();
+                        if(that.vtbl_)
+                            that.vtbl_->move(buf_, that.buf_);
+                        vtbl_ = that.vtbl_;
+                        that.vtbl_ = nullptr;
+                    }
+                    return *this;
+                }
                 any_cursor &operator=(any_cursor const &that)
                 {
-                    ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
+                    if(this != &that)
+                        *this = any_cursor{that};
                     return *this;
                 }
                 Ref current() const
                 {
-                    RANGES_ASSERT(ptr_);
-                    return ptr_->current();
+                    RANGES_ASSERT(vtbl_);
+                    return vtbl_->current(buf_);
                 }
                 bool equal(any_cursor const &that) const
                 {
-                    RANGES_ASSERT(!ptr_ == !that.ptr_);
-                    return (!ptr_ && !that.ptr_) || ptr_->equal(*that.ptr_);
+                    RANGES_ASSERT(!vtbl_ == !that.vtbl_);
+                    RANGES_ASSERT(!vtbl_ || vtbl_->type == that.vtbl_->type);
+                    return !vtbl_ || vtbl_->equal(buf_, that.buf_);
                 }
                 void next()
                 {
-                    RANGES_ASSERT(ptr_);
-                    ptr_->next();
+                    RANGES_ASSERT(vtbl_);
+                    vtbl_->next(buf_);
                 }
                 CONCEPT_REQUIRES(Cat >= category::bidirectional)
                 void prev()
                 {
-                    RANGES_ASSERT(ptr_);
-                    ptr_->prev();
+                    RANGES_ASSERT(vtbl_);
+                    vtbl_->prev(buf_);
                 }
                 CONCEPT_REQUIRES(Cat >= category::random_access)
                 void advance(std::ptrdiff_t n)
                 {
-                    RANGES_ASSERT(ptr_);
-                    ptr_->advance(n);
+                    RANGES_ASSERT(vtbl_);
+                    vtbl_->advance(buf_, n);
                 }
                 CONCEPT_REQUIRES(Cat >= category::random_access)
                 std::ptrdiff_t distance_to(any_cursor const &that) const
                 {
-                    RANGES_ASSERT(ptr_ && that.ptr_);
-                    return ptr_->distance_to(*that.ptr_);
+                    RANGES_ASSERT(vtbl_ && that.vtbl_ && vtbl_->type == that.vtbl_->type);
+                    return vtbl_->distance_to(buf_, that.buf_);
+                }
+                template<typename S,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Same<S, any_sentinel>::value && any_bulk_readable<Ref>::value)>
+#else
+                    CONCEPT_REQUIRES_(Same<S, any_sentinel>() && any_bulk_readable<Ref>())>
+#endif
+                std::ptrdiff_t read_n(S const &end, uncvref_t<Ref> *out, std::ptrdiff_t n)
+                {
+                    RANGES_ASSERT(!vtbl_ == !end.vtbl_);
+                    if(!vtbl_)
+                        return 0;
+                    RANGES_ASSERT(vtbl_->type == end.vtbl_->type &&
+                        vtbl_->sentinel_type == end.vtbl_->sentinel_type);
+                    return vtbl_->read_n(buf_, end.buf_, out, n);
                 }
             };
 
             struct any_sentinel
             {
             private:
-                std::unique_ptr<any_sentinel_interface> ptr_;
+                template<typename Ref, category Cat>
+                friend struct any_cursor;
+                any_buffer buf_;
+                any_sentinel_vtable const *vtbl_ = nullptr;
+
+                void reset() noexcept
+                {
+                    if(vtbl_)
+                        vtbl_->destroy(buf_);
+                    vtbl_ = nullptr;
+                }
             public:
                 any_sentinel() = default;
                 template<typename Rng,
@@ -276,24 +438,52 @@ namespace ranges
                     CONCEPT_REQUIRES_(InputRange<Rng>())>
 #endif
                 any_sentinel(Rng &&rng, end_tag)
-                  : ptr_{new any_sentinel_impl<range_sentinel_t<Rng>, range_iterator_t<Rng>>{
-                        end(rng)}}
-                {}
-                any_sentinel(any_sentinel &&) = default;
+                {
+                    using impl = any_sentinel_impl<range_sentinel_t<Rng>, range_iterator_t<Rng>>;
+                    impl::create(buf_, end(rng));
+                    vtbl_ = &impl::vtable;
+                }
+                any_sentinel(any_sentinel &&that) noexcept
+                  : vtbl_(that.vtbl_)
+                {
+                    if(vtbl_)
+                        vtbl_->move(buf_, that.buf_);
+                    that.vtbl_ = nullptr;
+                }
                 any_sentinel(any_sentinel const &that)
-                  : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-                {}
-                any_sentinel &operator=(any_sentinel &&) = default;
+                {
+                    if(that.vtbl_)
+                        that.vtbl_->copy(buf_, that.buf_);
+                    vtbl_ = that.vtbl_;
+                }
+                ~any_sentinel()
+                {
+                    reset();
+                }
+                any_sentinel &operator=(any_sentinel &&that) noexcept
+                {
+                    if(this != &that)
+                    {
+                        reset();
+                        if(that.vtbl_)
+                            that.vtbl_->move(buf_, that.buf_);
+                        vtbl_ = that.vtbl_;
+                        that.vtbl_ = nullptr;
+                    }
+                    return *this;
+                }
                 any_sentinel &operator=(any_sentinel const &that)
                 {
-                    ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
+                    if(this != &that)
+                        *this = any_sentinel{that};
                     return *this;
                 }
                 template<typename Ref, category Cat>
                 bool equal(any_cursor<Ref, Cat> const &that) const
                 {
-                    RANGES_ASSERT(!ptr_ == !that.ptr_);
-                    return (!ptr_ && !that.ptr_) || ptr_->equal(that.ptr_->iter());
+                    RANGES_ASSERT(!vtbl_ == !that.vtbl_);
+                    RANGES_ASSERT(!vtbl_ || vtbl_->type == that.vtbl_->type);
+                    return !vtbl_ || vtbl_->equal(buf_, that.buf_);
                 }
             };
 
@@ -306,12 +496,11 @@ namespace ranges
                 virtual any_view_interface *clone() const = 0;
             };
 
-            template<typename Rng, category Cat>
+            template<typename Rng, typename Ref, category Cat>
             struct any_view_impl
-              : any_view_interface<range_reference_t<Rng>, Cat>
+              : any_view_interface<Ref, Cat>
             {
             private:
-                using Ref = range_reference_t<Rng>;
                 Rng rng_;
             public:
                 any_view_impl() = default;
@@ -328,7 +517,7 @@ namespace ranges
                 }
                 any_view_interface<Ref, Cat> *clone() const
                 {
-                    return new any_view_impl<Rng, Cat>{rng_};
+                    return new any_view_impl<Rng, Ref, Cat>{rng_};
                 }
             };
 
@@ -358,7 +547,7 @@ namespace ranges
             }
             template<typename Rng>
             any_view(Rng && rng, std::true_type)
-              : ptr_{new detail::any_view_impl<view::all_t<Rng>, Cat>{
+              : ptr_{new detail::any_view_impl<view::all_t<Rng>, Ref, Cat>{
                     view::all(std::forward<Rng>(rng))}}
             {}
             template<typename Rng>
@@ -0,0 +1,176 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CACHE1_HPP
+#define RANGES_V3_VIEW_CACHE1_HPP
+
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// An input view of `Rng` that dereferences each element of `Rng` at
+        /// most once: the first dereference stores the value in the view, and
+        /// later dereferences of the same position return the stored value.
+        /// Put it after an expensive `view::transform` that is followed by
+        /// adaptors that read each element more than once, such as
+        /// `view::filter`, which reads every element to test it and again to
+        /// yield it.
+        template<typename Rng>
+        struct cache1_view
+          : view_facade<cache1_view<Rng>, range_cardinality<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using value_type_ = range_value_t<Rng>;
+            Rng rng_;
+            optional<value_type_> cache_;
+
+            value_type_ & cached(range_iterator_t<Rng> const &it)
+            {
+                if(!cache_)
+                    cache_ = value_type_(*it);
+                return *cache_;
+            }
+
+            struct cursor
+            {
+            private:
+                cache1_view *view_;
+                range_iterator_t<Rng> it_;
+                // Moving the element out is the one way to modify the cache.
+                value_type_ && indirect_move_() const
+                {
+                    return std::move(view_->cached(it_));
+                }
+                template<typename Sent>
+                friend value_type_ && indirect_move(basic_iterator<cursor, Sent> const &it)
+                {
+                    return get_cursor(it).indirect_move_();
+                }
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                cursor(cache1_view &view)
+                  : view_(&view), it_(ranges::begin(view.rng_))
+                {}
+                bool done() const
+                {
+                    return it_ == ranges::end(view_->rng_);
+                }
+                value_type_ const & current() const
+                {
+                    return view_->cached(it_);
+                }
+                void next()
+                {
+                    ++it_;
+                    view_->cache_.reset();
+                }
+            };
+            cursor begin_cursor()
+            {
+                cache_.reset();
+                return {*this};
+            }
+        public:
+            cache1_view() = default;
+            explicit cache1_view(Rng rng)
+              : rng_(std::move(rng)), cache_{}
+            {}
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(SizedRange<Rng const>::value)
+#else
+            CONCEPT_REQUIRES(SizedRange<Rng const>())
+#endif
+            range_size_t<Rng> size() const
+            {
+                return ranges::size(rng_);
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct cache1_fn
+            {
+                template<typename Rng>
+                using Concept = meta::and_<
+                    InputRange<Rng>,
+                    Constructible<range_value_t<Rng>, range_reference_t<Rng> &&>>;
+
+                template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rng>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rng>())>
+#endif
+                cache1_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return cache1_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rng>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rng>())>
+#endif
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The argument to view::cache1 must be a model of the InputRange "
+                        "concept.");
+                    CONCEPT_ASSERT_MSG(Constructible<range_value_t<Rng>,
+                        range_reference_t<Rng> &&>(),
+                        "The value type of the range passed to view::cache1 must be "
+                        "constructible from its reference type.");
+                }
+            #endif
+            };
+
+            /// \relates cache1_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& cache1 = static_const<view<cache1_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
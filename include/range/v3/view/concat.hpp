@@ -30,6 +30,7 @@
 #include <range/v3/utility/tuple_algorithm.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/detail/for_each_until.hpp>
 
 namespace ranges
 {
@@ -238,6 +239,53 @@ namespace ranges
                     return distance(begin(std::get<N>(from.rng_->rngs_)), ranges::get<N>(to.its_));
 #endif
                 }
+                // Hands fun the rest of the N-th range. Returns whether fun got
+                // to its end, in which case the cursor moves to the start of
+                // the next range.
+                template<std::size_t N, typename F>
+                bool whole_segment_(meta::size_t<N>, F &fun)
+                {
+                    auto &it = ranges::get<N>(its_);
+                    auto const last = ranges::end(std::get<N>(rng_->rngs_));
+                    it = fun(std::move(it), last);
+                    if(it != last)
+                        return false;
+                    ranges::set<N + 1>(its_, ranges::begin(std::get<N + 1>(rng_->rngs_)));
+                    return true;
+                }
+                template<std::size_t N, typename F>
+                void segments_(meta::size_t<N>, cursor const &end, F &fun)
+                {
+                    if(its_.which() != N)
+                        return this->segments_(meta::size_t<N + 1>{}, end, fun);
+                    if(end.its_.which() == N)
+                    {
+                        auto &it = ranges::get<N>(its_);
+                        it = fun(std::move(it), ranges::get<N>(end.its_));
+                    }
+                    else if(this->whole_segment_(meta::size_t<N>{}, fun))
+                        this->segments_(meta::size_t<N + 1>{}, end, fun);
+                }
+                template<typename F>
+                void segments_(meta::size_t<cranges - 1>, cursor const &end, F &fun)
+                {
+                    auto &it = ranges::get<cranges - 1>(its_);
+                    it = fun(std::move(it), ranges::get<cranges - 1>(end.its_));
+                }
+                template<std::size_t N, typename F>
+                void segments_(meta::size_t<N>, sentinel<IsConst> const &end, F &fun)
+                {
+                    if(its_.which() != N)
+                        return this->segments_(meta::size_t<N + 1>{}, end, fun);
+                    if(this->whole_segment_(meta::size_t<N>{}, fun))
+                        this->segments_(meta::size_t<N + 1>{}, end, fun);
+                }
+                template<typename F>
+                void segments_(meta::size_t<cranges - 1>, sentinel<IsConst> const &end, F &fun)
+                {
+                    auto &it = ranges::get<cranges - 1>(its_);
+                    it = fun(std::move(it), end.end_);
+                }
             public:
                 // BUGBUG what about rvalue_reference and common_reference?
                 using reference = common_reference_t<range_reference_t<constify_if<Rngs>>...>;
@@ -282,6 +330,18 @@ namespace ranges
                 {
                     return its_ == pos.its_;
                 }
+                // Each of the concatenated ranges is a segment; see
+                // detail/segmented.hpp.
+                template<typename F>
+                void for_each_segment(cursor const &end, F &fun)
+                {
+                    this->segments_(meta::size_t<0>{}, end, fun);
+                }
+                template<typename F>
+                void for_each_segment(sentinel<IsConst> const &end, F &fun)
+                {
+                    this->segments_(meta::size_t<0>{}, end, fun);
+                }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
                 CONCEPT_REQUIRES(meta::and_c<(bool)BidirectionalRange<Rngs>::value...>::value)
 #else
@@ -323,6 +383,7 @@ namespace ranges
                 template<typename T>
                 using constify_if = meta::apply<meta::add_const_if_c<IsConst>, T>;
                 using concat_view_t = constify_if<concat_view>;
+                friend struct cursor<IsConst>;
                 range_sentinel_t<constify_if<meta::back<meta::list<Rngs...>>>> end_;
             public:
                 sentinel() = default;
@@ -375,11 +436,43 @@ namespace ranges
             {
                 return {*this, end_tag{}};
             }
+            template<typename Tup, typename Sink>
+            static bool push_(Tup &, Sink &, meta::size_t<cranges>)
+            {
+                return false;
+            }
+            template<typename Tup, typename Sink, std::size_t N>
+            static bool push_(Tup &rngs, Sink &sink, meta::size_t<N>)
+            {
+                return detail::for_each_until(std::get<N>(rngs), sink) ||
+                    concat_view::push_(rngs, sink, meta::size_t<N + 1>{});
+            }
         public:
             concat_view() = default;
             explicit concat_view(Rngs...rngs)
               : rngs_{std::move(rngs)...}
             {}
+            // Pushes each range in turn; see detail/for_each_until.hpp.
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                using Ref = common_reference_t<range_reference_t<Rngs>...>;
+                detail::convert_sink<Ref, Sink> s{sink};
+                return concat_view::push_(rngs_, s, meta::size_t<0>{});
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
+            template<typename Sink,
+                CONCEPT_REQUIRES_(meta::and_c<(bool)Range<Rngs const>::value...>::value)>
+#else
+            template<typename Sink,
+                CONCEPT_REQUIRES_(meta::and_c<(bool)Range<Rngs const>()...>())>
+#endif
+            bool for_each_until(Sink &sink) const
+            {
+                using Ref = common_reference_t<range_reference_t<Rngs const>...>;
+                detail::convert_sink<Ref, Sink> s{sink};
+                return concat_view::push_(rngs_, s, meta::size_t<0>{});
+            }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
             CONCEPT_REQUIRES(meta::and_c<(bool)SizedRange<Rngs>::value...>::value)
 #else
@@ -18,6 +18,7 @@
 #include <functional>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_interface.hpp>
@@ -46,6 +47,14 @@ namespace ranges
             semiregular_t<function_type<Pred>> pred_;
             optional<range_iterator_t<Rng>> begin_;
 
+            // A copy can reuse the begin_ that get_begin_() found only if Rng
+            // is a plain pair of iterators.
+            optional<range_iterator_t<Rng>> copied_begin_() const
+            {
+                return detail::is_iterator_pair<Rng>::value ?
+                    begin_ : optional<range_iterator_t<Rng>>{};
+            }
+
             range_iterator_t<Rng> get_begin_()
             {
                 if(!begin_)
@@ -55,10 +64,11 @@ namespace ranges
         public:
             drop_while_view() = default;
             drop_while_view(drop_while_view &&that)
-              : rng_(std::move(that).rng_), pred_(std::move(that).pred_), begin_{}
+              : rng_(std::move(that).rng_), pred_(std::move(that).pred_)
+              , begin_(that.copied_begin_())
             {}
             drop_while_view(drop_while_view const &that)
-              : rng_(that.rng_), pred_(that.pred_), begin_{}
+              : rng_(that.rng_), pred_(that.pred_), begin_(that.copied_begin_())
             {}
             drop_while_view(Rng rng, Pred pred)
               : rng_(std::move(rng)), pred_(as_function(std::move(pred))), begin_{}
@@ -67,14 +77,14 @@ namespace ranges
             {
                 rng_ = std::move(that).rng_;
                 pred_ = std::move(that).pred_;
-                begin_.reset();
+                begin_ = that.copied_begin_();
                 return *this;
             }
             drop_while_view& operator=(drop_while_view const &that)
             {
                 rng_ = that.rng_;
                 pred_ = that.pred_;
-                begin_.reset();
+                begin_ = that.copied_begin_();
                 return *this;
             }
             range_iterator_t<Rng> begin()
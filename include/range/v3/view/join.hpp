@@ -30,6 +30,8 @@
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 namespace ranges
 {
@@ -49,6 +51,34 @@ namespace ranges
                             Outer::value == finite || Inner::value == finite || (Joiner::value == finite && Outer::value != 0 && Outer::value != 1) ?
                                 finite :
                                 static_cast<cardinality>(Outer::value * Inner::value + (Outer::value == 0 ? 0 : (Outer::value - 1) * Joiner::value))>;
+
+            // Pushes each inner range in turn.
+            template<typename Sink>
+            struct join_sink
+            {
+                Sink &sink;
+                template<typename T>
+                bool operator()(T &&inner) const
+                {
+                    return detail::for_each_until(inner, sink);
+                }
+            };
+
+            template<typename Ref, typename ValRng, typename Sink>
+            struct join_with_sink
+            {
+                ValRng &val;
+                convert_sink<Ref, Sink> sink;
+                bool first;
+                template<typename T>
+                bool operator()(T &&inner)
+                {
+                    if(!first && detail::for_each_until(val, sink))
+                        return true;
+                    first = false;
+                    return detail::for_each_until(inner, sink);
+                }
+            };
         }
         /// \endcond
 
@@ -137,6 +167,26 @@ namespace ranges
                     ranges::indirect_move(it_)
                 )
                 void distance_to() = delete;
+                // Each inner range is a segment. The end position either is
+                // past the last one (a null rng_) or lies in one of them.
+                template<typename EndIt, typename F>
+                void for_each_segment(range_iterator_t<Rng> &it, EndIt const &end_it,
+                    adaptor const &end, F &fun)
+                {
+                    while(rng_)
+                    {
+                        if(end.rng_ && it == end_it)
+                        {
+                            it_ = fun(std::move(it_), end.it_);
+                            return;
+                        }
+                        auto const last = ranges::end(rng_->cur_);
+                        it_ = fun(std::move(it_), last);
+                        if(it_ != last)
+                            return;
+                        satisfy(it);
+                    }
+                }
             };
             adaptor begin_adaptor()
             {
@@ -157,6 +207,13 @@ namespace ranges
 #endif
               , cur_{}
             {}
+            // See detail/for_each_until.hpp.
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                detail::join_sink<Sink> s{sink};
+                return detail::for_each_until(this->base(), s);
+            }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
             CONCEPT_REQUIRES(range_cardinality<Rng>::value >= 0 && SizedRange<range_value_t<Rng>>::value)
 #else
@@ -168,6 +225,32 @@ namespace ranges
                     (size_t_)range_cardinality<join_view>::value :
                     accumulate(view::transform(this->base(), ranges::size), size_t_{0});
             }
+            // The inner ranges' bounds added up. That takes a walk over the
+            // outer range, so only one that can be walked again and that yields
+            // the inner ranges by reference.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(!(range_cardinality<Rng>::value >= 0 &&
+                    SizedRange<range_value_t<Rng>>::value) &&
+                ForwardRange<Rng>::value && std::is_reference<range_reference_t<Rng>>::value &&
+                detail::HasSizeHint<meta::_t<std::remove_reference<range_reference_t<Rng>>>>::value)
+#else
+            CONCEPT_REQUIRES(!(range_cardinality<Rng>::value >= 0 &&
+                    SizedRange<range_value_t<Rng>>()) &&
+                ForwardRange<Rng>() && std::is_reference<range_reference_t<Rng>>() &&
+                detail::HasSizeHint<meta::_t<std::remove_reference<range_reference_t<Rng>>>>())
+#endif
+            detail::size_hint size_hint()
+            {
+                detail::size_hint h{0, 0};
+                auto const end = ranges::end(this->base());
+                for(auto it = ranges::begin(this->base()); it != end; ++it)
+                {
+                    auto const inner = detail::range_size_hint(*it);
+                    h.lower = detail::saturating_add(h.lower, inner.lower);
+                    h.upper = detail::saturating_add(h.upper, inner.upper);
+                }
+                return h;
+            }
         };
 
         // Join a range of ranges, inserting a range of values between them.
@@ -305,6 +388,15 @@ namespace ranges
 #endif
               , cur_{}, val_(std::move(val))
             {}
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                using Ref = common_reference_t<
+                    range_reference_t<range_value_t<Rng>>,
+                    range_reference_t<ValRng>>;
+                detail::join_with_sink<Ref, ValRng, Sink> s{val_, {sink}, true};
+                return detail::for_each_until(this->base(), s);
+            }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
             CONCEPT_REQUIRES(range_cardinality<Rng>::value >= 0 &&
                 SizedRange<range_value_t<Rng>>::value && SizedRange<ValRng>::value)
@@ -0,0 +1,129 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MAPPED_LINES_HPP
+#define RANGES_V3_VIEW_MAPPED_LINES_HPP
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/mmap_range.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The lines of a memory-mapped file, without their delimiters. Each
+        /// line is a `range<char const *>` pointing into the mapping, so
+        /// reading a file allocates nothing per line and copies no bytes; the
+        /// next delimiter is found with `memchr`. Like `getlines`, a final
+        /// line needn't end with a delimiter, and an empty file has no lines.
+        /// Lines stay valid as long as some copy of the view does.
+        struct mapped_lines_view
+          : view_facade<mapped_lines_view, finite>
+        {
+        private:
+            friend range_access;
+            mmap_range file_;
+            char delim_;
+
+            struct cursor
+            {
+            private:
+                char const *cur_, *eol_, *last_;
+                char delim_;
+                char const *find_eol() const
+                {
+                    auto const p = static_cast<char const *>(
+                        std::memchr(cur_, delim_, static_cast<std::size_t>(last_ - cur_)));
+                    return p ? p : last_;
+                }
+            public:
+                cursor() = default;
+                cursor(char const *first, char const *last, char delim)
+                  : cur_(first), eol_(first), last_(last), delim_(delim)
+                {
+                    if(cur_ != last_)
+                        eol_ = find_eol();
+                }
+                range<char const *> current() const
+                {
+                    return {cur_, eol_};
+                }
+                void next()
+                {
+                    cur_ = eol_ == last_ ? last_ : eol_ + 1;
+                    if(cur_ != last_)
+                        eol_ = find_eol();
+                }
+                bool done() const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {file_.begin(), file_.end(), delim_};
+            }
+        public:
+            mapped_lines_view() = default;
+            explicit mapped_lines_view(mmap_range file, char delim = '\n')
+              : file_(std::move(file)), delim_(delim)
+            {}
+            mmap_range const & file() const
+            {
+                return file_;
+            }
+        };
+
+        namespace view
+        {
+            struct mapped_lines_fn
+            {
+                /// Maps the file at `path`, by default with
+                /// `mmap_hint::sequential`. Throws `std::system_error` if the
+                /// file can't be opened or mapped.
+                mapped_lines_view operator()(std::string const &path, char delim = '\n',
+                    mmap_hint hints = mmap_hint::sequential) const
+                {
+                    return mapped_lines_view{mmap_range{path, hints}, delim};
+                }
+                mapped_lines_view operator()(mmap_range file, char delim = '\n') const
+                {
+                    return mapped_lines_view{std::move(file), delim};
+                }
+            };
+
+            /// \relates mapped_lines_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& mapped_lines = static_const<mapped_lines_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
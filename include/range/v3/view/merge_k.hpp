@@ -0,0 +1,210 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MERGE_K_HPP
+#define RANGES_V3_VIEW_MERGE_K_HPP
+
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/detail/size_hint.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of a range of sorted ranges, in the order `merge_k`
+        /// would write them, taken from a heap of the ranges' heads as they
+        /// are read.
+        template<typename Rngs, typename C, typename P>
+        struct merge_k_view
+          : view_facade<
+                merge_k_view<Rngs, C, P>,
+                is_finite<Rngs>::value && is_finite<range_value_t<Rngs>>::value ?
+                    finite : unknown>
+        {
+        private:
+            friend range_access;
+            Rngs rngs_;
+            semiregular_t<function_type<C>> pred_;
+            semiregular_t<function_type<P>> proj_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access;
+                template<typename T>
+                using constify_if = meta::apply<meta::add_const_if_c<IsConst>, T>;
+                using Rng = range_reference_t<constify_if<Rngs>>;
+                semiregular_ref_or_val_t<function_type<C>, IsConst> pred_;
+                semiregular_ref_or_val_t<function_type<P>, IsConst> proj_;
+                detail::merge_k_heap<range_iterator_t<Rng>, range_sentinel_t<Rng>> heap_;
+                // How many elements have been read, which tells apart the
+                // positions of one merge.
+                std::size_t pos_;
+            public:
+                using single_pass = SinglePass<range_iterator_t<Rng>>;
+                cursor() = default;
+                cursor(constify_if<merge_k_view> &rng)
+                  : pred_(rng.pred_), proj_(rng.proj_), heap_(rng.rngs_, pred_, proj_), pos_(0)
+                {}
+                range_reference_t<Rng> current() const
+                {
+                    return *heap_.front();
+                }
+                void next()
+                {
+                    heap_.next(pred_, proj_);
+                    ++pos_;
+                }
+                bool done() const
+                {
+                    return heap_.empty();
+                }
+                CONCEPT_REQUIRES(!single_pass::value)
+                bool equal(cursor const &that) const
+                {
+                    return pos_ == that.pos_;
+                }
+            };
+            cursor<false> begin_cursor()
+            {
+                return {*this};
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(MergeableRanges<Rngs const, range_value_t<range_value_t<Rngs>> *, C, P>::value)
+#else
+            CONCEPT_REQUIRES(MergeableRanges<Rngs const, range_value_t<range_value_t<Rngs>> *, C, P>())
+#endif
+            cursor<true> begin_cursor() const
+            {
+                return {*this};
+            }
+        public:
+            merge_k_view() = default;
+            merge_k_view(Rngs rngs, C pred, P proj)
+              : rngs_(std::move(rngs))
+              , pred_(as_function(std::move(pred)))
+              , proj_(as_function(std::move(proj)))
+            {}
+            // As many elements as the ranges have together.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(detail::HasSizeHint<range_reference_t<Rngs>>::value)
+#else
+            CONCEPT_REQUIRES(detail::HasSizeHint<range_reference_t<Rngs>>())
+#endif
+            detail::size_hint size_hint()
+            {
+                detail::size_hint h{0, 0};
+                for(auto i = ranges::begin(rngs_), e = ranges::end(rngs_); i != e; ++i)
+                {
+                    auto &&rng = *i;
+                    detail::size_hint const hi = detail::range_size_hint(rng);
+                    h.lower = detail::saturating_add(h.lower, hi.lower);
+                    h.upper = detail::saturating_add(h.upper, hi.upper);
+                }
+                return h;
+            }
+        };
+
+        namespace view
+        {
+            struct merge_k_fn
+            {
+            private:
+                friend view_access;
+                template<typename C, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Range<C>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Range<C>())>
+#endif
+                static auto bind(merge_k_fn merge_k, C pred, P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(merge_k, std::placeholders::_1,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+            public:
+                template<typename Rngs, typename C, typename P>
+                using Concept = meta::and_<
+                    ForwardRange<Rngs>,
+                    MergeableRanges<Rngs, range_value_t<range_value_t<Rngs>> *, C, P>>;
+
+                template<typename Rngs, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rngs, C, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rngs, C, P>())>
+#endif
+                merge_k_view<all_t<Rngs>, C, P>
+                operator()(Rngs && rngs, C pred = C{}, P proj = P{}) const
+                {
+                    return {all(std::forward<Rngs>(rngs)), std::move(pred), std::move(proj)};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rngs, typename C = ordered_less, typename P = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Range<Rngs>::value && !Concept<Rngs, C, P>::value)>
+#else
+                    CONCEPT_REQUIRES_(Range<Rngs>() && !Concept<Rngs, C, P>())>
+#endif
+                void operator()(Rngs &&, C = C{}, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rngs>(),
+                        "The argument to view::merge_k must be a model of the ForwardRange "
+                        "concept.");
+                    CONCEPT_ASSERT_MSG(std::is_lvalue_reference<range_reference_t<Rngs>>() &&
+                        InputRange<range_reference_t<Rngs>>(),
+                        "The elements of the range passed to view::merge_k must be lvalues "
+                        "that model the InputRange concept.");
+                    CONCEPT_ASSERT_MSG(MergeableRanges<Rngs,
+                        range_value_t<range_value_t<Rngs>> *, C, P>(),
+                        "The comparison passed to view::merge_k must order the projected "
+                        "elements of the ranges.");
+                }
+            #endif
+            };
+
+            /// Lazily merges a range of sorted ranges.
+            /// \relates merge_k_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& merge_k = static_const<view<merge_k_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,569 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PARSE_NUMBERS_HPP
+#define RANGES_V3_VIEW_PARSE_NUMBERS_HPP
+
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/contiguous.hpp>
+#include <range/v3/view/all.hpp>
+
+// Define RANGES_DISABLE_SIMD to parse integers one character at a time only.
+#if !defined(RANGES_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RANGES_PARSE_NUMBERS_SWAR
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The types parse_numbers reads: arithmetic types that operator>>
+            // reads as numbers rather than as characters.
+            template<typename T>
+            using is_parsable_number = meta::bool_<
+                std::is_arithmetic<T>::value &&
+                !std::is_same<T, bool>::value &&
+                !std::is_same<T, char>::value &&
+                !std::is_same<T, signed char>::value &&
+                !std::is_same<T, unsigned char>::value &&
+                !std::is_same<T, wchar_t>::value &&
+                !std::is_same<T, char16_t>::value &&
+                !std::is_same<T, char32_t>::value>;
+
+            inline bool is_number_space(char c)
+            {
+                return c == ' ' || (c >= '\t' && c <= '\r');
+            }
+
+            inline bool is_digit(char c)
+            {
+                return static_cast<unsigned>(c - '0') < 10u;
+            }
+
+            inline bool is_number_char(char c, std::false_type)
+            {
+                return is_digit(c) || c == '-' || c == '+';
+            }
+
+            inline bool is_number_char(char c, std::true_type)
+            {
+                return is_digit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+            }
+
+            // Parses all of [first, last) as an integer in base 10.
+            template<typename T>
+            bool parse_number(char const *first, char const *last, T &out, std::false_type)
+            {
+                bool const neg = first != last && *first == '-';
+                if(first != last && (*first == '-' || *first == '+'))
+                    ++first;
+                if(first == last || (neg && std::is_unsigned<T>::value))
+                    return false;
+                while(last - first > 1 && *first == '0')
+                    ++first;
+                // Nineteen decimal digits always fit in 64 bits; only a
+                // twentieth needs an overflow check.
+                using U = unsigned long long;
+                if(last - first > 20)
+                    return false;
+                char const *const safe = last - first == 20 ? last - 1 : last;
+                U acc = 0;
+                for(; first != safe; ++first)
+                {
+                    unsigned const d = static_cast<unsigned>(*first - '0');
+                    if(d >= 10u)
+                        return false;
+                    acc = acc * 10u + d;
+                }
+                if(first != last)
+                {
+                    unsigned const d = static_cast<unsigned>(*first - '0');
+                    if(d >= 10u || acc > (std::numeric_limits<U>::max() - d) / 10u)
+                        return false;
+                    acc = acc * 10u + d;
+                }
+                if(neg)
+                {
+                    // -(min + 1) + 1 is the magnitude of min without overflow.
+                    U const lim = static_cast<U>(-(std::numeric_limits<T>::min() + 1)) + 1u;
+                    if(acc > lim)
+                        return false;
+                    out = acc == lim ? std::numeric_limits<T>::min()
+                                     : static_cast<T>(-static_cast<T>(acc));
+                    return true;
+                }
+                if(acc > static_cast<U>(std::numeric_limits<T>::max()))
+                    return false;
+                out = static_cast<T>(acc);
+                return true;
+            }
+
+        #ifdef RANGES_PARSE_NUMBERS_SWAR
+            // The number of decimal digits at the start of the eight
+            // characters in v, loaded little-endian. Bytes after the first
+            // non-digit may be garbled by carries but don't matter.
+            inline unsigned swar_digit_count(std::uint64_t v)
+            {
+                std::uint64_t const high = 0xF0F0F0F0F0F0F0F0ull, zeros = 0x3030303030303030ull;
+                std::uint64_t const bad = ((v & high) ^ zeros) |
+                    (((v + 0x0606060606060606ull) & high) ^ zeros);
+                std::uint64_t const nonzero = (((bad & 0x7F7F7F7F7F7F7F7Full) +
+                    0x7F7F7F7F7F7F7F7Full) | bad) & 0x8080808080808080ull;
+                return nonzero ? static_cast<unsigned>(__builtin_ctzll(nonzero)) / 8u : 8u;
+            }
+
+            // The value of the first 1 <= n <= 8 digits in v. Shifting the
+            // rest out turns them into leading zeros, and then pairs, quads
+            // and octets of digits are combined with three multiplies.
+            inline std::uint64_t swar_digits_value(std::uint64_t v, unsigned n)
+            {
+                v = (v - 0x3030303030303030ull) << (8u * (8u - n));
+                v = v * 10u + (v >> 8);
+                return (((v & 0x000000FF000000FFull) * (100u + (1000000ull << 32))) +
+                    (((v >> 16) & 0x000000FF000000FFull) * (1u + (10000ull << 32)))) >> 32;
+            }
+
+            // Parses an integer of up to seven digits at first, if there's
+            // room to read eight characters past its sign. Returns how many
+            // characters it took, or 0 to leave the number to parse_number.
+            template<typename T>
+            std::size_t parse_short_integer(char const *first, char const *last, T &out,
+                std::false_type)
+            {
+                char const *p = first;
+                bool const neg = *p == '-';
+                if(neg || *p == '+')
+                    ++p;
+                if(last - p < 8)
+                    return 0;
+                std::uint64_t v;
+                std::memcpy(&v, p, sizeof(v));
+                unsigned const n = detail::swar_digit_count(v);
+                if(n == 0 || n == 8 || p[n] == '-' || p[n] == '+')
+                    return 0;
+                std::uint64_t const value = detail::swar_digits_value(v, n);
+                if(neg)
+                {
+                    if(std::is_unsigned<T>::value ||
+                        value > static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+                        return 0;
+                    out = static_cast<T>(-static_cast<T>(value));
+                }
+                else
+                {
+                    if(value > static_cast<std::uint64_t>(std::numeric_limits<T>::max()))
+                        return 0;
+                    out = static_cast<T>(value);
+                }
+                return static_cast<std::size_t>(p - first) + n;
+            }
+
+            template<typename T>
+            std::size_t parse_short_integer(char const *, char const *, T &, std::true_type)
+            {
+                return 0;
+            }
+        #endif
+
+            // Decimals whose significand and power of ten are both exactly
+            // representable in F are rounded correctly by a single multiply
+            // or divide (Clinger's fast path); the rest go to strtod and
+            // friends.
+            template<typename F>
+            struct fast_float_limits;
+
+            template<>
+            struct fast_float_limits<float>
+            {
+                static constexpr unsigned long long max_significand = 1ull << 24;
+                static constexpr int max_exponent = 10;
+            };
+
+            template<>
+            struct fast_float_limits<double>
+            {
+                static constexpr unsigned long long max_significand = 1ull << 53;
+                static constexpr int max_exponent = 22;
+            };
+
+            template<>
+            struct fast_float_limits<long double>
+            {
+                static constexpr unsigned long long max_significand = 0;
+                static constexpr int max_exponent = -1;
+            };
+
+            inline double pow10(int e)
+            {
+                static constexpr double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6,
+                    1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+                    1e19, 1e20, 1e21, 1e22};
+                return powers[e];
+            }
+
+            inline void str_to(char const *s, char **end, float &out)
+            {
+                out = std::strtof(s, end);
+            }
+
+            inline void str_to(char const *s, char **end, double &out)
+            {
+                out = std::strtod(s, end);
+            }
+
+            inline void str_to(char const *s, char **end, long double &out)
+            {
+                out = std::strtold(s, end);
+            }
+
+            template<typename F>
+            bool parse_number_slow(char const *first, char const *last, F &out)
+            {
+                std::string const str(first, last);
+                char *end = nullptr;
+                int const saved = errno;
+                errno = 0;
+                F value;
+                detail::str_to(str.c_str(), &end, value);
+                bool const overflow = errno == ERANGE && std::isinf(value);
+                errno = saved;
+                if(end != str.c_str() + str.size() || overflow)
+                    return false;
+                out = value;
+                return true;
+            }
+
+            // Parses all of [first, last) as a decimal floating-point number:
+            // an optional sign, digits with an optional point, and an
+            // optional exponent.
+            template<typename F>
+            bool parse_number(char const *first, char const *last, F &out, std::true_type)
+            {
+                char const *p = first;
+                bool const neg = p != last && *p == '-';
+                if(p != last && (*p == '-' || *p == '+'))
+                    ++p;
+                unsigned long long sig = 0;
+                int digits = 0, exp10 = 0;
+                bool any = false;
+                for(; p != last && is_digit(*p); ++p, any = true)
+                {
+                    if(digits < 19)
+                    {
+                        sig = sig * 10u + static_cast<unsigned>(*p - '0');
+                        digits += sig != 0;
+                    }
+                    else
+                        ++exp10;
+                }
+                if(p != last && *p == '.')
+                {
+                    for(++p; p != last && is_digit(*p); ++p, any = true)
+                    {
+                        if(digits < 19)
+                        {
+                            sig = sig * 10u + static_cast<unsigned>(*p - '0');
+                            digits += sig != 0;
+                            --exp10;
+                        }
+                    }
+                }
+                if(!any)
+                    return false;
+                bool const truncated = digits >= 19;
+                if(p != last && (*p == 'e' || *p == 'E'))
+                {
+                    ++p;
+                    bool const eneg = p != last && *p == '-';
+                    if(p != last && (*p == '-' || *p == '+'))
+                        ++p;
+                    if(p == last)
+                        return false;
+                    int e = 0;
+                    for(; p != last && is_digit(*p); ++p)
+                        if(e < 100000)
+                            e = e * 10 + (*p - '0');
+                    exp10 += eneg ? -e : e;
+                }
+                if(p != last)
+                    return false;
+                using limits = fast_float_limits<F>;
+                if(!truncated && sig <= limits::max_significand &&
+                    exp10 >= -limits::max_exponent && exp10 <= limits::max_exponent)
+                {
+                    F value = static_cast<F>(sig);
+                    if(exp10 < 0)
+                        value /= static_cast<F>(detail::pow10(-exp10));
+                    else
+                        value *= static_cast<F>(detail::pow10(exp10));
+                    out = neg ? -value : value;
+                    return true;
+                }
+                return detail::parse_number_slow(first, last, out);
+            }
+
+            // Characters come from a stream's buffer in large blocks, bypassing
+            // the sentry and locale machinery of operator>>.
+            struct stream_chars
+            {
+            private:
+                std::istream *sin_;
+                std::vector<char> buf_;
+            public:
+                stream_chars() = default;
+                explicit stream_chars(std::istream &sin)
+                  : sin_(&sin), buf_()
+                {}
+                char const *data() const
+                {
+                    return buf_.data();
+                }
+                // Moves the unread characters [pos, size) to the front and
+                // appends the next block after them. Returns false at the end
+                // of input.
+                bool refill(std::size_t &pos, std::size_t &size)
+                {
+                    static constexpr std::size_t block = 1u << 16;
+                    if(!sin_->good())
+                        return false;
+                    std::size_t const kept = size - pos;
+                    if(buf_.size() < kept + block)
+                        buf_.resize(kept + block);
+                    if(kept && pos)
+                        std::memmove(buf_.data(), buf_.data() + pos, kept);
+                    pos = 0;
+                    size = kept;
+                    auto const got = sin_->rdbuf()->sgetn(buf_.data() + kept,
+                        static_cast<std::streamsize>(block));
+                    if(got <= 0)
+                    {
+                        sin_->setstate(std::ios_base::eofbit);
+                        return false;
+                    }
+                    size += static_cast<std::size_t>(got);
+                    return true;
+                }
+                void fail()
+                {
+                    sin_->setstate(std::ios_base::failbit);
+                }
+                bool ok() const
+                {
+                    return sin_->good();
+                }
+            };
+
+            // Characters come all at once from contiguous memory.
+            template<typename Rng>
+            struct range_chars
+            {
+            private:
+                Rng rng_;
+                bool read_ = false;
+            public:
+                range_chars() = default;
+                explicit range_chars(Rng rng)
+                  : rng_(std::move(rng))
+                {}
+                char const *data() const
+                {
+                    return as_contiguous_range(ranges::begin(rng_), ranges::end(rng_)).begin();
+                }
+                bool refill(std::size_t &pos, std::size_t &size)
+                {
+                    if(read_)
+                        return false;
+                    read_ = true;
+                    pos = 0;
+                    size = static_cast<std::size_t>(ranges::distance(rng_));
+                    return true;
+                }
+                void fail()
+                {}
+                bool ok() const
+                {
+                    return true;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The whitespace-separated numbers in some text, parsed as `T`s.
+        /// This is a single-pass range, like `istream_range`, but parses with
+        /// a hand-written decimal parser rather than `operator>>`, with no
+        /// sentry, locale or virtual call per number. The range ends at the
+        /// end of the text or at the first token that isn't a `T`, such as
+        /// text, an out-of-range value or a negative unsigned number.
+        ///
+        /// When the text comes from a `std::istream`, its buffer is read in
+        /// 64 KiB blocks, so the stream is left positioned past the last
+        /// number read. Its state is set as `operator>>` would have set it:
+        /// `eofbit` at the end of input, `failbit` on a malformed number.
+        template<typename T, typename Chars>
+        struct parse_numbers_view
+          : view_facade<parse_numbers_view<T, Chars>, unknown>
+        {
+        private:
+            friend range_access;
+            Chars chars_;
+            std::size_t pos_ = 0, size_ = 0;
+            T value_{};
+            bool done_ = true;
+
+            struct cursor
+            {
+            private:
+                parse_numbers_view *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(parse_numbers_view &rng)
+                  : rng_(&rng)
+                {}
+                void next()
+                {
+                    rng_->next();
+                }
+                T const &current() const
+                {
+                    return rng_->value_;
+                }
+                bool done() const
+                {
+                    return rng_->done_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                return cursor{*this};
+            }
+            void next()
+            {
+                using is_float = std::is_floating_point<T>;
+                done_ = true;
+                bool more = true;
+                while(true)
+                {
+                    char const *const data = chars_.data();
+                    std::size_t p = pos_;
+                    while(p != size_ && detail::is_number_space(data[p]))
+                        ++p;
+                #ifdef RANGES_PARSE_NUMBERS_SWAR
+                    if(p != size_)
+                        if(std::size_t const n = detail::parse_short_integer(data + p,
+                            data + size_, value_, is_float{}))
+                        {
+                            pos_ = p + n;
+                            done_ = false;
+                            return;
+                        }
+                #endif
+                    std::size_t q = p;
+                    while(q != size_ && detail::is_number_char(data[q], is_float{}))
+                        ++q;
+                    pos_ = p;
+                    // A token touching the end of the buffer may continue in
+                    // the next block.
+                    if(q == size_ && more)
+                    {
+                        more = chars_.refill(pos_, size_);
+                        continue;
+                    }
+                    if(p == q)
+                    {
+                        if(p != size_)
+                            chars_.fail();
+                        return;
+                    }
+                    if(!detail::parse_number(data + p, data + q, value_, is_float{}))
+                    {
+                        chars_.fail();
+                        return;
+                    }
+                    pos_ = q;
+                    done_ = false;
+                    return;
+                }
+            }
+        public:
+            parse_numbers_view() = default;
+            explicit parse_numbers_view(Chars chars)
+              : chars_(std::move(chars))
+            {
+                if(chars_.ok())
+                    next(); // prime the pump
+            }
+        };
+
+        namespace view
+        {
+            /// Parses the numbers in `sin` as `T`s; see `parse_numbers_view`.
+            template<typename T,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::is_parsable_number<T>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::is_parsable_number<T>())>
+#endif
+            parse_numbers_view<T, detail::stream_chars> parse_numbers(std::istream &sin)
+            {
+                return parse_numbers_view<T, detail::stream_chars>{detail::stream_chars{sin}};
+            }
+
+            /// Parses the numbers in a contiguous range of `char`s, such as a
+            /// `std::string` or an `mmap_range`, as `T`s; see
+            /// `parse_numbers_view`.
+            template<typename T, typename Rng,
+                typename I = range_iterator_t<Rng>,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::is_parsable_number<T>::value &&
+                    SizedRange<Rng>::value && ContiguousIterator<I>::value &&
+                    Same<range_value_t<Rng>, char>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::is_parsable_number<T>() &&
+                    SizedRange<Rng>() && ContiguousIterator<I>() &&
+                    Same<range_value_t<Rng>, char>())>
+#endif
+            parse_numbers_view<T, detail::range_chars<all_t<Rng>>> parse_numbers(Rng &&rng)
+            {
+                return parse_numbers_view<T, detail::range_chars<all_t<Rng>>>{
+                    detail::range_chars<all_t<Rng>>{all(std::forward<Rng>(rng))}};
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include <type_traits>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
@@ -28,11 +29,30 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/view/view.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename Pred, typename Sink>
+            struct remove_if_sink
+            {
+                Pred &pred;
+                Sink &sink;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return !pred(t) && sink(static_cast<T &&>(t));
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Pred>
@@ -47,6 +67,16 @@ namespace ranges
             semiregular_t<function_type<Pred>> pred_;
             optional<range_iterator_t<Rng>> begin_;
 
+            // The first call to begin() searches for the first element to keep
+            // and caches the result. Copies share the cache when the base
+            // range's iterators don't point into the base range itself, so
+            // a copied view doesn't search again.
+            optional<range_iterator_t<Rng>> copied_begin_() const
+            {
+                return detail::is_iterator_pair<Rng>::value ?
+                    begin_ : optional<range_iterator_t<Rng>>{};
+            }
+
             struct adaptor
               : adaptor_base
             {
@@ -107,7 +137,7 @@ namespace ranges
               : view_adaptor_t<remove_if_view>(std::move(that))
 #endif
               , pred_(std::move(that).pred_)
-              , begin_{}
+              , begin_(that.copied_begin_())
             {}
             remove_if_view(remove_if_view const &that)
 #ifdef RANGES_WORKAROUND_MSVC_207134
@@ -116,7 +146,7 @@ namespace ranges
               : view_adaptor_t<remove_if_view>(that)
 #endif
               , pred_(that.pred_)
-              , begin_{}
+              , begin_(that.copied_begin_())
             {}
             remove_if_view(Rng rng, Pred pred)
 #ifdef RANGES_WORKAROUND_MSVC_207134
@@ -127,18 +157,36 @@ namespace ranges
               , pred_(as_function(std::move(pred)))
               , begin_{}
             {}
+            // Elements are filtered as the base pushes them, without the
+            // cached begin.
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                detail::remove_if_sink<semiregular_t<function_type<Pred>>, Sink> s{pred_, sink};
+                return detail::for_each_until(this->base(), s);
+            }
+            // No more elements than the base has.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng>::value)
+#else
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng>())
+#endif
+            detail::size_hint size_hint()
+            {
+                return {0, detail::range_size_hint(this->base()).upper};
+            }
             remove_if_view& operator=(remove_if_view &&that)
             {
                 this->view_adaptor_t<remove_if_view>::operator=(std::move(that));
                 pred_ = std::move(that).pred_;
-                begin_.reset();
+                begin_ = that.copied_begin_();
                 return *this;
             }
             remove_if_view& operator=(remove_if_view const &that)
             {
                 this->view_adaptor_t<remove_if_view>::operator=(that);
                 pred_ = that.pred_;
-                begin_.reset();
+                begin_ = that.copied_begin_();
                 return *this;
             }
         };
@@ -0,0 +1,216 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SAMPLE_HPP
+#define RANGES_V3_VIEW_SAMPLE_HPP
+
+#include <random>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+        template<typename Rng, typename Gen>
+        struct sample_view
+          : view_facade<sample_view<Rng, Gen>, finite>
+        {
+        private:
+            friend range_access;
+            using D = range_difference_t<Rng>;
+            Rng rng_;
+            D n_;
+            Gen *gen_;
+
+            // Selection sampling, as ranges::sample does it, one element at a
+            // time: the cursor stops at each element it takes.
+            struct cursor
+            {
+            private:
+                range_iterator_t<Rng> it_;
+                D left_;
+                D wanted_;
+                Gen *gen_;
+
+                void seek()
+                {
+                    using param_t = typename std::uniform_int_distribution<D>::param_type;
+                    std::uniform_int_distribution<D> uid;
+                    if(wanted_ == 0)
+                        return;
+                    while(uid(*gen_, param_t{0, left_ - 1}) >= wanted_)
+                    {
+                        ++it_;
+                        --left_;
+                    }
+                }
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                cursor(range_iterator_t<Rng> it, D size, D n, Gen &gen)
+                  : it_(std::move(it)), left_(size), wanted_(n < size ? n : size), gen_(&gen)
+                {
+                    seek();
+                }
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    *it_
+                )
+                void next()
+                {
+                    RANGES_ASSERT(0 != wanted_);
+                    ++it_;
+                    --left_;
+                    --wanted_;
+                    seek();
+                }
+                bool done() const
+                {
+                    return 0 == wanted_;
+                }
+            };
+            D size_(std::true_type)
+            {
+                return static_cast<D>(ranges::size(rng_));
+            }
+            D size_(std::false_type)
+            {
+                return ranges::distance(rng_);
+            }
+            cursor begin_cursor()
+            {
+                return {ranges::begin(rng_), size_(SizedRange<Rng>()), n_, *gen_};
+            }
+        public:
+            sample_view() = default;
+            sample_view(Rng rng, D n, Gen &gen)
+              : rng_(std::move(rng)), n_(n), gen_(&gen)
+            {
+                RANGES_ASSERT(0 <= n_);
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(SizedRange<Rng>::value)
+#else
+            CONCEPT_REQUIRES(SizedRange<Rng>())
+#endif
+            range_size_t<Rng> size() const
+            {
+                auto const size = ranges::size(rng_);
+                return static_cast<range_size_t<Rng>>(n_) < size ?
+                    static_cast<range_size_t<Rng>>(n_) : size;
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct sample_fn
+            {
+            private:
+                friend view_access;
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                template<typename Int, typename Gen,
+                    CONCEPT_REQUIRES_(Integral<Int>::value &&
+                        UniformRandomNumberGenerator<Gen>::value)>
+#else
+                template<typename Int, typename Gen,
+                    CONCEPT_REQUIRES_(Integral<Int>() && UniformRandomNumberGenerator<Gen>())>
+#endif
+                static auto bind(sample_fn sample, Int n, Gen &gen)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sample, std::placeholders::_1, n, std::ref(gen)))
+                )
+            public:
+                template<typename Rng, typename Gen>
+                using Concept = meta::and_<
+                    InputRange<Rng>,
+                    meta::or_<SizedRange<Rng>, ForwardRange<Rng>>,
+                    UniformRandomNumberGenerator<Gen>>;
+
+                template<typename Rng, typename Gen,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rng, Gen>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rng, Gen>())>
+#endif
+                sample_view<all_t<Rng>, Gen>
+                operator()(Rng && rng, range_difference_t<Rng> n, Gen &gen) const
+                {
+                    return {all(std::forward<Rng>(rng)), n, gen};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Gen,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rng, Gen>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rng, Gen>())>
+#endif
+                void operator()(Rng &&, range_difference_t<Rng>, Gen &) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The object on which view::sample operates must be a model of the "
+                        "InputRange concept.");
+                    CONCEPT_ASSERT_MSG(meta::or_<SizedRange<Rng>, ForwardRange<Rng>>(),
+                        "view::sample needs to know the length of the range it samples: "
+                        "the range must either be sized or be a model of the ForwardRange "
+                        "concept, so that it can be counted.");
+                    CONCEPT_ASSERT_MSG(UniformRandomNumberGenerator<Gen>(),
+                        "The generator passed to view::sample must be a model of the "
+                        "UniformRandomNumberGenerator concept.");
+                }
+            #endif
+            };
+
+            /// Lazily takes `n` elements of a range, each subset of `n` as
+            /// likely as any other, in the order they appear in it; all of them
+            /// if there are no more than `n`. It draws from `gen`, which it
+            /// refers to, as it is walked, so each walk gives a fresh sample.
+            /// \relates sample_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& sample = static_const<view<sample_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
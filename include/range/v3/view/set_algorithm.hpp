@@ -0,0 +1,284 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SET_ALGORITHM_HPP
+#define RANGES_V3_VIEW_SET_ALGORITHM_HPP
+
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/detail/size_hint.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct set_difference_tag {};
+            struct set_intersection_tag {};
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements that `set_difference` or `set_intersection` would
+        /// write for two ranges sorted by `C`, computed as they are read.
+        template<typename Tag, typename Rng1, typename Rng2, typename C, typename P1,
+            typename P2>
+        struct sorted_set_view
+          : view_facade<
+                sorted_set_view<Tag, Rng1, Rng2, C, P1, P2>,
+                is_finite<Rng1>::value ||
+                    (std::is_same<Tag, detail::set_intersection_tag>::value &&
+                        is_finite<Rng2>::value) ? finite : unknown>
+        {
+        private:
+            friend range_access;
+            Rng1 rng1_;
+            Rng2 rng2_;
+            semiregular_t<function_type<C>> pred_;
+            semiregular_t<function_type<P1>> proj1_;
+            semiregular_t<function_type<P2>> proj2_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access;
+                template<typename T>
+                using constify_if = meta::apply<meta::add_const_if_c<IsConst>, T>;
+                using R1 = constify_if<Rng1>;
+                using R2 = constify_if<Rng2>;
+                range_iterator_t<R1> it1_;
+                range_sentinel_t<R1> end1_;
+                range_iterator_t<R2> it2_;
+                range_sentinel_t<R2> end2_;
+                semiregular_ref_or_val_t<function_type<C>, IsConst> pred_;
+                semiregular_ref_or_val_t<function_type<P1>, IsConst> proj1_;
+                semiregular_ref_or_val_t<function_type<P2>, IsConst> proj2_;
+
+                // Moves to the next element of the first range that is not
+                // matched by one of the second.
+                void satisfy(detail::set_difference_tag)
+                {
+                    while(it1_ != end1_ && it2_ != end2_)
+                    {
+                        if(pred_(proj1_(*it1_), proj2_(*it2_)))
+                            return;
+                        if(!pred_(proj2_(*it2_), proj1_(*it1_)))
+                            ++it1_;
+                        ++it2_;
+                    }
+                }
+                // Moves to the next element of the first range that is matched
+                // by one of the second.
+                void satisfy(detail::set_intersection_tag)
+                {
+                    while(it1_ != end1_ && it2_ != end2_)
+                    {
+                        if(pred_(proj1_(*it1_), proj2_(*it2_)))
+                            ++it1_;
+                        else if(pred_(proj2_(*it2_), proj1_(*it1_)))
+                            ++it2_;
+                        else
+                            return;
+                    }
+                }
+                void consume(detail::set_difference_tag)
+                {
+                    ++it1_;
+                }
+                void consume(detail::set_intersection_tag)
+                {
+                    ++it1_;
+                    ++it2_;
+                }
+                bool done(detail::set_difference_tag) const
+                {
+                    return it1_ == end1_;
+                }
+                bool done(detail::set_intersection_tag) const
+                {
+                    return it1_ == end1_ || it2_ == end2_;
+                }
+            public:
+                using single_pass = meta::or_c<SinglePass<range_iterator_t<R1>>::value,
+                    SinglePass<range_iterator_t<R2>>::value>;
+                cursor() = default;
+                cursor(constify_if<sorted_set_view> &rng)
+                  : it1_(ranges::begin(rng.rng1_)), end1_(ranges::end(rng.rng1_))
+                  , it2_(ranges::begin(rng.rng2_)), end2_(ranges::end(rng.rng2_))
+                  , pred_(rng.pred_), proj1_(rng.proj1_), proj2_(rng.proj2_)
+                {
+                    satisfy(Tag{});
+                }
+                range_reference_t<R1> current() const
+                {
+                    return *it1_;
+                }
+                void next()
+                {
+                    consume(Tag{});
+                    satisfy(Tag{});
+                }
+                bool done() const
+                {
+                    return done(Tag{});
+                }
+                CONCEPT_REQUIRES(!single_pass::value)
+                bool equal(cursor const &that) const
+                {
+                    return it1_ == that.it1_;
+                }
+            };
+            cursor<false> begin_cursor()
+            {
+                return {*this};
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(Range<Rng1 const>::value && Range<Rng2 const>::value)
+#else
+            CONCEPT_REQUIRES(Range<Rng1 const>() && Range<Rng2 const>())
+#endif
+            cursor<true> begin_cursor() const
+            {
+                return {*this};
+            }
+            static std::size_t upper_(detail::size_hint h1, Rng2 &, detail::set_difference_tag)
+            {
+                return h1.upper;
+            }
+            static std::size_t upper_(detail::size_hint h1, Rng2 &rng2,
+                detail::set_intersection_tag)
+            {
+                return (std::min)(h1.upper, detail::range_size_hint(rng2).upper);
+            }
+        public:
+            sorted_set_view() = default;
+            sorted_set_view(Rng1 rng1, Rng2 rng2, C pred, P1 proj1, P2 proj2)
+              : rng1_(std::move(rng1)), rng2_(std::move(rng2))
+              , pred_(as_function(std::move(pred)))
+              , proj1_(as_function(std::move(proj1)))
+              , proj2_(as_function(std::move(proj2)))
+            {}
+            // No more elements than the first range has, nor, for an
+            // intersection, than the second.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng1>::value)
+#else
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng1>())
+#endif
+            detail::size_hint size_hint()
+            {
+                return {0, sorted_set_view::upper_(detail::range_size_hint(rng1_), rng2_, Tag{})};
+            }
+        };
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_difference_view =
+            sorted_set_view<detail::set_difference_tag, Rng1, Rng2, C, P1, P2>;
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_intersection_view =
+            sorted_set_view<detail::set_intersection_tag, Rng1, Rng2, C, P1, P2>;
+
+        namespace view
+        {
+            template<typename Tag>
+            struct sorted_set_fn
+            {
+                template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+                using Concept = meta::and_<
+                    InputRange<Rng1>,
+                    InputRange<Rng2>,
+                    IndirectCallableRelation<C, Project<range_iterator_t<Rng1>, P1>,
+                        Project<range_iterator_t<Rng2>, P2>>>;
+
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, C, P1, P2>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, C, P1, P2>())>
+#endif
+                sorted_set_view<Tag, all_t<Rng1>, all_t<Rng2>, C, P1, P2>
+                operator()(Rng1 && rng1, Rng2 && rng2, C pred = C{}, P1 proj1 = P1{},
+                    P2 proj2 = P2{}) const
+                {
+                    return {all(std::forward<Rng1>(rng1)), all(std::forward<Rng2>(rng2)),
+                        std::move(pred), std::move(proj1), std::move(proj2)};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>())>
+#endif
+                void operator()(Rng1 &&, Rng2 &&, C = C{}, P1 = P1{}, P2 = P2{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng1>() && InputRange<Rng2>(),
+                        "The ranges passed to view::set_difference and view::set_intersection "
+                        "must be models of the InputRange concept.");
+                    CONCEPT_ASSERT_MSG(IndirectCallableRelation<C,
+                        Project<range_iterator_t<Rng1>, P1>,
+                        Project<range_iterator_t<Rng2>, P2>>(),
+                        "The comparison passed to view::set_difference and "
+                        "view::set_intersection must order the projected elements of both "
+                        "ranges.");
+                }
+            #endif
+            };
+
+            /// Lazily, the elements of the first sorted range that are not
+            /// matched by one of the second, as `set_difference` would write
+            /// them.
+            /// \relates sorted_set_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& set_difference =
+                    static_const<sorted_set_fn<detail::set_difference_tag>>::value;
+            }
+
+            /// Lazily, the elements of the first sorted range that are matched
+            /// by one of the second, as `set_intersection` would write them.
+            /// \relates sorted_set_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& set_intersection =
+                    static_const<sorted_set_fn<detail::set_intersection_tag>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
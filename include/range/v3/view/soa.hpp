@@ -0,0 +1,144 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SOA_HPP
+#define RANGES_V3_VIEW_SOA_HPP
+
+#include <tuple>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/common_tuple.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/zip_with.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // As indirect_zip_fn_, but with tuples for any number of ranges,
+            // two included.
+            struct indirect_tuple_fn_
+            {
+                template<typename ...Its,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>::value)>
+#else
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>())>
+#endif
+                auto operator()(copy_tag, Its...) const ->
+                    std::tuple<iterator_value_t<Its>...>;
+
+                template<typename ...Its,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>::value)>
+#else
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>())>
+#endif
+                auto operator()(Its const &...its) const
+                    noexcept(meta::and_c<noexcept(iterator_reference_t<Its>(*its))...>::value)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    common_tuple<iterator_reference_t<Its>...>{*its...}
+                )
+
+                template<typename ...Its,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>::value)>
+#else
+                    CONCEPT_REQUIRES_(meta::and_<Readable<Its>...>())>
+#endif
+                auto operator()(move_tag, Its const &...its) const
+                    noexcept(meta::and_c<
+                        noexcept(iterator_rvalue_reference_t<Its>(iter_move(its)))...>::value)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    common_tuple<iterator_rvalue_reference_t<Its>...>{iter_move(its)...}
+                )
+            };
+        } // namespace detail
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// Ranges holding one field each of a sequence of records, a structure
+        /// of arrays, viewed as a range of `common_tuple`s of the fields.
+        template<typename...Rngs>
+        struct soa_view
+          : iter_zip_with_view<detail::indirect_tuple_fn_, Rngs...>
+        {
+            soa_view() = default;
+            explicit soa_view(Rngs...rngs)
+              : iter_zip_with_view<detail::indirect_tuple_fn_, Rngs...>{
+                  detail::indirect_tuple_fn_{}, std::move(rngs)...}
+            {}
+        };
+
+        namespace view
+        {
+            struct soa_fn
+            {
+                template<typename ...Rngs>
+                using Concept = meta::and_<InputRange<Rngs>...>;
+
+                template<typename...Rngs,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(Concept<Rngs...>::value)>
+#else
+                    CONCEPT_REQUIRES_(Concept<Rngs...>())>
+#endif
+                soa_view<all_t<Rngs>...> operator()(Rngs &&... rngs) const
+                {
+                    return soa_view<all_t<Rngs>...>{all(std::forward<Rngs>(rngs))...};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename...Rngs,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(!Concept<Rngs...>::value)>
+#else
+                    CONCEPT_REQUIRES_(!Concept<Rngs...>())>
+#endif
+                void operator()(Rngs &&...) const
+                {
+                    CONCEPT_ASSERT_MSG(meta::and_<InputRange<Rngs>...>(),
+                        "All of the objects passed to view::soa must model the InputRange "
+                        "concept");
+                }
+            #endif
+            };
+
+            /// Views columns, ranges holding one field each, as a range of
+            /// records. Unlike `view::zip`, the elements are `common_tuple`s
+            /// whatever the number of columns. Columns that are all sized and
+            /// random-access are walked with a single index (see `zip_spans`).
+            /// \relates soa_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& soa = static_const<soa_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -27,6 +27,7 @@
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/algorithm/search.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/iota.hpp>
@@ -37,6 +38,44 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // A delimiter given by a searcher. Called like any other split
+            // function, it reports whether a delimiter starts at cur; but
+            // split_view's cursor calls search instead, to jump from one
+            // delimiter to the next.
+            template<typename Rng, typename Searcher>
+            struct split_searcher
+            {
+                Searcher searcher_;
+                std::pair<bool, range_difference_t<Rng>>
+                operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+                {
+                    auto const m = searcher_(cur, end);
+                    if(m.first != cur)
+                        return {false, 0};
+                    return {true, distance(m.first, m.second)};
+                }
+                std::pair<range_iterator_t<Rng>, range_iterator_t<Rng>>
+                search(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+                {
+                    return searcher_(cur, end);
+                }
+            };
+
+            template<typename Fun>
+            struct is_split_searcher
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Searcher>
+            struct is_split_searcher<split_searcher<Rng, Searcher>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Fun>
@@ -114,7 +153,84 @@ namespace ranges
             public:
                 cursor() = default;
             };
-            cursor<false> begin_cursor()
+            // With a searcher, the cursor finds where the current segment
+            // ends as soon as it reaches the segment, so each element is
+            // looked at by the searcher only, and only about once.
+            template<bool IsConst>
+            struct search_cursor
+            {
+            private:
+                friend range_access;
+                friend split_view;
+                using fun_ref_t = semiregular_ref_or_val_t<function_type<Fun>, IsConst>;
+                range_iterator_t<Rng> cur_, seg_end_, next_;
+                range_sentinel_t<Rng> last_;
+                bool zero_;
+                fun_ref_t fun_;
+
+                // Finds the delimiter that ends the segment at cur_. After a
+                // delimiter that matched no elements, a segment has at least
+                // one element, or the same empty delimiter would match again.
+                void find_segment_end()
+                {
+                    auto from = cur_;
+                    if(zero_)
+                        ++from;
+                    auto const m = unwrap_reference(fun_).search(from, last_);
+                    seg_end_ = m.first;
+                    next_ = m.second;
+                }
+                range<range_iterator_t<Rng>> current() const
+                {
+                    return {cur_, seg_end_};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(cur_ != last_);
+                    if(seg_end_ == last_)
+                    {
+                        cur_ = seg_end_;
+                        return;
+                    }
+                    zero_ = next_ == seg_end_;
+                    cur_ = next_;
+                    if(cur_ != last_)
+                        find_segment_end();
+                }
+                bool done() const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(search_cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+                search_cursor(fun_ref_t fun, range_iterator_t<Rng> first,
+                    range_sentinel_t<Rng> last)
+                  : cur_(first), seg_end_(first), next_(first), last_(last), zero_(false)
+                  , fun_(fun)
+                {
+                    if(cur_ == last_)
+                        return;
+                    auto const m = unwrap_reference(fun_).search(cur_, last_);
+                    // An initial delimiter that matches no elements is skipped.
+                    zero_ = m.first == cur_ && m.second == cur_;
+                    if(zero_)
+                        find_segment_end();
+                    else
+                    {
+                        seg_end_ = m.first;
+                        next_ = m.second;
+                    }
+                }
+            public:
+                search_cursor() = default;
+            };
+            template<bool IsConst>
+            using cursor_t = meta::if_<detail::is_split_searcher<Fun>,
+                search_cursor<IsConst>, cursor<IsConst>>;
+
+            cursor_t<false> begin_cursor()
             {
                 return {fun_, ranges::begin(rng_), ranges::end(rng_)};
             }
@@ -125,7 +241,7 @@ namespace ranges
             CONCEPT_REQUIRES(Callable<Fun const, range_iterator_t<Rng>,
                 range_sentinel_t<Rng>>() && Range<Rng const>())
 #endif
-            cursor<true> begin_cursor() const
+            cursor_t<true> begin_cursor() const
             {
                 return {fun_, ranges::begin(rng_), ranges::end(rng_)};
             }
@@ -240,6 +356,44 @@ namespace ranges
                     EqualityComparable<range_value_t<Rng>, range_value_t<Sub>>>;
 #endif
 
+                template<typename Rng, typename Searcher>
+                using SearcherConcept = meta::and_<
+                    ForwardRange<Rng>,
+                    detail::is_searcher<Searcher, range_iterator_t<Rng>, range_sentinel_t<Rng>>>;
+
+                // Splitting a random-access range of integers at a sequence
+                // of them uses a Boyer-Moore-Horspool searcher, built once
+                // when the view is.
+                template<typename Rng, typename Sub>
+                using AutoSearchConcept = meta::and_<
+                    RandomAccessRange<Rng>,
+                    SizedIteratorRange<range_iterator_t<Rng>, range_sentinel_t<Rng>>,
+                    std::is_same<range_value_t<Rng>, range_value_t<Sub>>,
+                    std::is_integral<range_value_t<Rng>>>;
+
+                template<typename Rng>
+                using auto_searcher_t = detail::split_searcher<all_t<Rng>,
+                    boyer_moore_horspool_searcher<range_value_t<Rng>>>;
+
+                template<typename Rng, typename Sub>
+                using subrange_split_view_t = meta::if_<AutoSearchConcept<Rng, Sub>,
+                    split_view<all_t<Rng>, auto_searcher_t<Rng>>,
+                    split_view<all_t<Rng>, subrange_pred<Rng, Sub>>>;
+
+                template<typename Rng, typename Sub>
+                static split_view<all_t<Rng>, auto_searcher_t<Rng>>
+                split_at_subrange(Rng && rng, Sub && sub, std::true_type)
+                {
+                    return {all(std::forward<Rng>(rng)),
+                        {boyer_moore_horspool_searcher<range_value_t<Rng>>{sub}}};
+                }
+                template<typename Rng, typename Sub>
+                static split_view<all_t<Rng>, subrange_pred<Rng, Sub>>
+                split_at_subrange(Rng && rng, Sub && sub, std::false_type)
+                {
+                    return {all(std::forward<Rng>(rng)), {std::forward<Sub>(sub)}};
+                }
+
                 template<typename Rng, typename Fun,
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
                     CONCEPT_REQUIRES_(FunctionConcept<Rng, Fun>::value)>
@@ -266,9 +420,21 @@ namespace ranges
 #else
                     CONCEPT_REQUIRES_(SubRangeConcept<Rng, Sub>())>
 #endif
-                split_view<all_t<Rng>, subrange_pred<Rng, Sub>> operator()(Rng && rng, Sub && sub) const
+                subrange_split_view_t<Rng, Sub> operator()(Rng && rng, Sub && sub) const
                 {
-                    return {all(std::forward<Rng>(rng)), {std::forward<Sub>(sub)}};
+                    return split_fn::split_at_subrange(std::forward<Rng>(rng),
+                        std::forward<Sub>(sub), AutoSearchConcept<Rng, Sub>{});
+                }
+                template<typename Rng, typename Searcher,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(SearcherConcept<Rng, Searcher>::value)>
+#else
+                    CONCEPT_REQUIRES_(SearcherConcept<Rng, Searcher>())>
+#endif
+                split_view<all_t<Rng>, detail::split_searcher<all_t<Rng>, Searcher>>
+                operator()(Rng && rng, Searcher searcher) const
+                {
+                    return {all(std::forward<Rng>(rng)), {std::move(searcher)}};
                 }
 
             #ifndef RANGES_DOXYGEN_INVOKED
@@ -288,8 +454,10 @@ namespace ranges
                         "(1) A single element of the range's value type, where the value type is a "
                         "model of the Regular concept, "
                         "(2) A ForwardRange whose value type is EqualityComparable to the input "
-                        "range's value type, or "
-                        "(3) A Function that is callable with two arguments: the range's iterator "
+                        "range's value type, "
+                        "(3) A searcher, such as the one make_boyer_moore_searcher returns, that "
+                        "can be called with the range's iterator and sentinel, or "
+                        "(4) A Function that is callable with two arguments: the range's iterator "
                         "and sentinel, and that returns a std::pair<bool, D>, where D is the "
                         "input range's difference_type.");
                 }
@@ -24,6 +24,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/view.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 namespace ranges
 {
@@ -101,6 +102,14 @@ namespace ranges
             {
                 return rng_;
             }
+            // Sized and infinite ranges are taken with take_exactly, so the
+            // base is neither: at most n of whatever it holds.
+            detail::size_hint size_hint()
+            {
+                auto const n = static_cast<std::size_t>(n_);
+                auto const base = detail::range_size_hint(rng_);
+                return {std::min(base.lower, n), std::min(base.upper, n)};
+            }
         };
 
         namespace view
@@ -26,11 +26,36 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/view.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Ends the push at the first element that fails pred. Only a stop
+            // requested by sink is reported to the caller: for it, the
+            // take_while range simply ran out.
+            template<typename Pred, typename Sink>
+            struct take_while_sink
+            {
+                Pred &pred;
+                Sink &sink;
+                bool stopped;
+                template<typename T>
+                bool operator()(T &&t)
+                {
+                    if(!pred(detail::push_ref(t)))
+                        return true;
+                    return (stopped = sink(static_cast<T &&>(t)));
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Pred>
@@ -83,6 +108,31 @@ namespace ranges
 #endif
               , pred_(as_function(std::move(pred)))
             {}
+            // Push-based iteration for view::take_while; see
+            // detail/for_each_until.hpp.
+            template<typename Sink, typename P = Pred,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::is_indirected<P>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::is_indirected<P>())>
+#endif
+            bool for_each_until(Sink &sink)
+            {
+                detail::take_while_sink<semiregular_t<function_type<Pred>>, Sink> s{pred_, sink,
+                    false};
+                detail::for_each_until(this->base(), s);
+                return s.stopped;
+            }
+            // A prefix of the base.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng>::value)
+#else
+            CONCEPT_REQUIRES(detail::HasSizeHint<Rng>())
+#endif
+            detail::size_hint size_hint()
+            {
+                return {0, detail::range_size_hint(this->base()).upper};
+            }
         };
 
         template<typename Rng, typename Pred>
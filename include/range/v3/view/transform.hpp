@@ -31,6 +31,8 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/detail/for_each_until.hpp>
+#include <range/v3/detail/size_hint.hpp>
 
 namespace ranges
 {
@@ -49,6 +51,18 @@ namespace ranges
                             unknown :
                             infinite;
             }
+
+            template<typename Fun, typename Sink>
+            struct transform_sink
+            {
+                Fun &fun;
+                Sink &sink;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return sink(fun(detail::push_ref(static_cast<T &&>(t))));
+                }
+            };
         }
         /// \endcond
 
@@ -125,6 +139,32 @@ namespace ranges
 #endif
               , fun_(as_function(std::move(fun)))
             {}
+            // For view::transform, push the base's elements through the
+            // function; see detail/for_each_until.hpp.
+            template<typename Sink, typename F = Fun,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::is_indirected<F>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::is_indirected<F>())>
+#endif
+            bool for_each_until(Sink &sink)
+            {
+                detail::transform_sink<semiregular_t<function_type<Fun>>, Sink> s{fun_, sink};
+                return detail::for_each_until(this->base(), s);
+            }
+            template<typename Sink, typename F = Fun,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                CONCEPT_REQUIRES_(detail::is_indirected<F>::value && Range<Rng const>::value &&
+                    Callable<F const, range_iterator_t<Rng>>::value)>
+#else
+                CONCEPT_REQUIRES_(detail::is_indirected<F>() && Range<Rng const>() &&
+                    Callable<F const, range_iterator_t<Rng>>())>
+#endif
+            bool for_each_until(Sink &sink) const
+            {
+                detail::transform_sink<semiregular_t<function_type<Fun>> const, Sink> s{fun_, sink};
+                return detail::for_each_until(this->base(), s);
+            }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
             template<CONCEPT_REQUIRES_(SizedRange<Rng const>::value)>
 #else
@@ -143,6 +183,15 @@ namespace ranges
             {
                 return ranges::size(this->base());
             }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(!SizedRange<Rng>::value && detail::has_size_hint<Rng>::value)
+#else
+            CONCEPT_REQUIRES(!SizedRange<Rng>() && detail::has_size_hint<Rng>())
+#endif
+            detail::size_hint size_hint()
+            {
+                return this->base().size_hint();
+            }
         };
 
         template<typename Rng, typename Fun>
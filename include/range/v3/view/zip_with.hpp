@@ -116,9 +116,151 @@ namespace ranges
                             State::value == unknown || Value::value == unknown ?
                                 unknown :
                                 infinite>;
+
+            // A position in a zip of sized random-access ranges: their
+            // beginnings and an index into all of them. Only the index moves
+            // and only the index is compared, however many ranges there are.
+            template<typename Fun, typename...Is>
+            struct zip_index_cursor
+            {
+            private:
+                template<typename, typename...>
+                friend struct zip_index_cursor;
+                Fun fun_;
+                std::tuple<Is...> begins_;
+                common_type_t<iterator_difference_t<Is>...> i_;
+
+                template<std::size_t...Ns>
+                auto current_(meta::index_sequence<Ns...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_((std::get<Ns>(begins_) + i_)...)
+                )
+                template<std::size_t...Ns>
+                auto indirect_move_(meta::index_sequence<Ns...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_(move_tag{}, (std::get<Ns>(begins_) + i_)...)
+                )
+                template<typename Sent>
+                friend auto indirect_move(basic_iterator<zip_index_cursor, Sent> const &it)
+#ifdef RANGES_WORKAROUND_MSVC_NOEXCEPT_DEPENDENT
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    get_cursor(it).indirect_move_(meta::make_index_sequence<sizeof...(Is)>{})
+                )
+#else
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    get_cursor(it).indirect_move_(meta::make_index_sequence<sizeof...(Is)>{})
+                )
+#endif
+            public:
+                using difference_type = common_type_t<iterator_difference_t<Is>...>;
+                using single_pass = std::false_type;
+                using value_type = decay_t<decltype(fun_(copy_tag{}, Is{}...))>;
+
+                zip_index_cursor() = default;
+                zip_index_cursor(Fun fun, std::tuple<Is...> begins, difference_type i)
+                  : fun_(std::move(fun)), begins_(std::move(begins)), i_(i)
+                {}
+                template<typename...Js,
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+                    CONCEPT_REQUIRES_(meta::and_<ConvertibleTo<Js, Is>...>::value)>
+#else
+                    CONCEPT_REQUIRES_(meta::and_<ConvertibleTo<Js, Is>...>())>
+#endif
+                zip_index_cursor(zip_index_cursor<Fun, Js...> that)
+                  : fun_(std::move(that.fun_)), begins_(std::move(that.begins_)), i_(that.i_)
+                {}
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    current_(meta::make_index_sequence<sizeof...(Is)>{})
+                )
+                void next()
+                {
+                    ++i_;
+                }
+                void prev()
+                {
+                    --i_;
+                }
+                void advance(difference_type n)
+                {
+                    i_ += n;
+                }
+                bool equal(zip_index_cursor const &that) const
+                {
+                    return i_ == that.i_;
+                }
+                difference_type distance_to(zip_index_cursor const &that) const
+                {
+                    return that.i_ - i_;
+                }
+            };
         } // namespace detail
         /// \endcond
 
+        /// \addtogroup group-views
+        /// @{
+
+        /// Sized random-access ranges zipped as a structure of arrays: where
+        /// each of them begins, and the length they have in common. Element
+        /// `i` is `fun` applied to each beginning advanced by `i`. This is how
+        /// `iter_zip_with_view` and the views built on it (`view::zip`,
+        /// `view::zip_with`) walk such ranges, and their `spans()` hands it
+        /// to the algorithms that consume them whole, which read it with a
+        /// single index in loops the compiler can vectorize.
+        template<typename Fun, typename...Is>
+        struct zip_spans
+          : view_facade<zip_spans<Fun, Is...>, finite>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = common_type_t<iterator_difference_t<Is>...>;
+            using size_type_ = meta::_t<std::make_unsigned<difference_type_>>;
+            Fun fun_;
+            std::tuple<Is...> begins_;
+            difference_type_ size_;
+
+            template<std::size_t...Ns>
+            auto at_(difference_type_ i, meta::index_sequence<Ns...>) const
+            RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+            (
+                fun_((std::get<Ns>(begins_) + i)...)
+            )
+            detail::zip_index_cursor<Fun, Is...> begin_cursor() const
+            {
+                return {fun_, begins_, 0};
+            }
+            detail::zip_index_cursor<Fun, Is...> end_cursor() const
+            {
+                return {fun_, begins_, size_};
+            }
+        public:
+            zip_spans() = default;
+            zip_spans(Fun fun, std::tuple<Is...> begins, difference_type_ size)
+              : fun_(std::move(fun)), begins_(std::move(begins)), size_(size)
+            {
+                RANGES_ASSERT(0 <= size);
+            }
+            size_type_ size() const
+            {
+                return static_cast<size_type_>(size_);
+            }
+            std::tuple<Is...> const &begins() const
+            {
+                return begins_;
+            }
+            auto operator[](difference_type_ i) const
+            RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+            (
+                this->at_(i, meta::make_index_sequence<sizeof...(Is)>{})
+            )
+        };
+        /// @}
+
 #ifdef RANGES_WORKAROUND_MSVC_215191
         template<typename T>
         struct single_pass_helper {
@@ -149,13 +291,18 @@ namespace ranges
             std::tuple<Rngs...> rngs_;
             using difference_type_ = common_type_t<range_difference_t<Rngs>...>;
             using size_type_ = meta::_t<std::make_unsigned<difference_type_>>;
+            using fun_ref_ = semiregular_ref_or_val_t<function_type<Fun>, true>;
+
+            // When every range is sized and random-access, the common size is
+            // worked out once and positions are indices into all of them.
+            using indexed_ = meta::and_<meta::and_<RandomAccessRange<Rngs>, SizedRange<Rngs>>...>;
+            using spans_t = zip_spans<fun_ref_, range_iterator_t<Rngs>...>;
 
             struct sentinel;
             struct cursor
             {
             private:
                 friend sentinel;
-                using fun_ref_ = semiregular_ref_or_val_t<function_type<Fun>, true>;
                 fun_ref_ fun_;
 
                 std::tuple<range_iterator_t<Rngs>...> its_;
@@ -285,7 +432,7 @@ namespace ranges
                 }
             };
 
-            using end_cursor_t =
+            using iter_end_cursor_t =
                 meta::if_<
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
                     meta::and_c<
@@ -307,34 +454,47 @@ namespace ranges
                     cursor,
                     sentinel>;
 
-            cursor begin_cursor()
+            using cursor_t = meta::if_<indexed_, detail::zip_index_cursor<fun_ref_,
+                range_iterator_t<Rngs>...>, cursor>;
+            using end_cursor_t = meta::if_<indexed_, cursor_t, iter_end_cursor_t>;
+
+            template<typename Self>
+            static cursor begin_(Self &self, std::false_type)
             {
-#ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
-                return {fun_, tuple_transform(rngs_, ranges::begin)};
-#else
-                return {fun_, tuple_transform(rngs_, begin)};
-#endif
+                return {self.fun_, tuple_transform(self.rngs_, ranges::begin)};
+            }
+            template<typename Self>
+            static cursor_t begin_(Self &self, std::true_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, ranges::begin), 0};
+            }
+            template<typename Self>
+            static iter_end_cursor_t end_(Self &self, std::false_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, ranges::end)};
+            }
+            template<typename Self>
+            static cursor_t end_(Self &self, std::true_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, ranges::begin),
+                    static_cast<difference_type_>(self.size())};
+            }
+            cursor_t begin_cursor()
+            {
+                return iter_zip_with_view::begin_(*this, indexed_{});
             }
             end_cursor_t end_cursor()
             {
-#ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
-                return {fun_, tuple_transform(rngs_, ranges::end)};
-#else
-                return {fun_, tuple_transform(rngs_, end)};
-#endif
+                return iter_zip_with_view::end_(*this, indexed_{});
             }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
             CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>::value...>::value)
 #else
             CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>()...>::value)
 #endif
-            cursor begin_cursor() const
+            cursor_t begin_cursor() const
             {
-#ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
-                return {fun_, tuple_transform(rngs_, ranges::begin)};
-#else
-                return {fun_, tuple_transform(rngs_, begin)};
-#endif
+                return iter_zip_with_view::begin_(*this, indexed_{});
             }
 #ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
             CONCEPT_REQUIRES(meta::and_c<(bool) Range<Rngs const>::value...>::value)
@@ -343,11 +503,7 @@ namespace ranges
 #endif
             end_cursor_t end_cursor() const
             {
-#ifdef RANGES_WORKAROUND_MSVC_PERMISSIVE_DEPENDENT_BASE
-                return {fun_, tuple_transform(rngs_, ranges::end)};
-#else
-                return {fun_, tuple_transform(rngs_, end)};
-#endif
+                return iter_zip_with_view::end_(*this, indexed_{});
             }
         public:
             iter_zip_with_view() = default;
@@ -373,6 +529,29 @@ namespace ranges
                         (std::numeric_limits<size_type_>::max)(),
                         detail::min_);
             }
+            /// The ranges as a `zip_spans`, when they are all sized and
+            /// random-access.
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR
+            CONCEPT_REQUIRES(indexed_::value)
+#else
+            CONCEPT_REQUIRES(indexed_())
+#endif
+            spans_t spans()
+            {
+                return {fun_, tuple_transform(rngs_, ranges::begin),
+                    static_cast<difference_type_>(size())};
+            }
+#ifdef RANGES_WORKAROUND_MSVC_SFINAE_CONSTEXPR_PACKEXPANSION
+            CONCEPT_REQUIRES(indexed_::value &&
+                meta::and_c<(bool) Range<Rngs const>::value...>::value)
+#else
+            CONCEPT_REQUIRES(indexed_() && meta::and_c<(bool) Range<Rngs const>()...>::value)
+#endif
+            spans_t spans() const
+            {
+                return {fun_, tuple_transform(rngs_, ranges::begin),
+                    static_cast<difference_type_>(size())};
+            }
         };
 #if defined(RANGES_WORKAROUND_MSVC_PERMISSIVE_HIDDEN_FRIEND) || defined(RANGES_WORKAROUND_MSVC_INDIRECT_MOVE)
         }
@@ -376,6 +376,23 @@ namespace ranges
             {
                 return this->distance_to_(that, 42);
             }
+            // If the adaptor can visit its range a segment at a time, let
+            // algorithms do so (see detail/segmented.hpp).
+            template<typename F, typename A = Adapt,
+                typename R = decltype(std::declval<A &>().for_each_segment(
+                    std::declval<BaseIter &>(), first, second, std::declval<F &>()))>
+            void for_each_segment(adaptor_cursor const &end, F &fun)
+            {
+                second.for_each_segment(first, end.first, end.second, fun);
+            }
+            template<typename BaseSent, typename SentAdapt, typename F, typename A = Adapt,
+                typename R = decltype(std::declval<A &>().for_each_segment(
+                    std::declval<BaseIter &>(), std::declval<BaseSent const &>(),
+                    std::declval<SentAdapt const &>(), std::declval<F &>()))>
+            void for_each_segment(adaptor_sentinel<BaseSent, SentAdapt> const &end, F &fun)
+            {
+                second.for_each_segment(first, end.first, end.second, fun);
+            }
         };
 #if defined(RANGES_WORKAROUND_MSVC_PERMISSIVE_HIDDEN_FRIEND) || defined(RANGES_WORKAROUND_MSVC_INDIRECT_MOVE)
         }
@@ -390,6 +407,13 @@ namespace ranges
             using single_pass = range_access::single_pass_t<Adapt>;
             using compressed_pair<BaseSent, Adapt>::compressed_pair;
         private:
+#if defined(RANGES_WORKAROUND_MSVC_PERMISSIVE_HIDDEN_FRIEND) || defined(RANGES_WORKAROUND_MSVC_INDIRECT_MOVE)
+            template<typename BaseIt, typename BaseAdapt>
+            friend struct adaptor_cursor_detail::adaptor_cursor;
+#else
+            template<typename BaseIt, typename BaseAdapt>
+            friend struct adaptor_cursor;
+#endif
             using compressed_pair<BaseSent, Adapt>::first;
             using compressed_pair<BaseSent, Adapt>::second;
             template<typename I, typename IA, typename A = Adapt,
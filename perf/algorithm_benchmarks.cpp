@@ -0,0 +1,1330 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Every algorithm in algorithm/ and numeric/, timed as a raw loop (where one
+// is short enough to write by hand), as the std:: algorithm (where there is
+// one) and as the range-v3 algorithm; and the pipelines of actions that run
+// as one.
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <range/v3/algorithm.hpp>
+#include <range/v3/action/join.hpp>
+#include <range/v3/action/remove_if.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/action/transform.hpp>
+#include <range/v3/action/unique.hpp>
+#include <range/v3/numeric.hpp>
+#include <range/v3/view/merge_k.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+#include <range/v3/utility/execution.hpp>
+#include "benchmark.hpp"
+
+namespace
+{
+    using V = std::vector<int>;
+    using bench::scratch;
+
+    long long pos(V const &v, V::const_iterator it)
+    {
+        return it - v.begin();
+    }
+
+    bool is_odd(int i)
+    {
+        return (i & 1) != 0;
+    }
+
+    // Sum of a few elements, so the result of an algorithm that rearranges
+    // its input can be checked without timing a full pass over it.
+    long long probe(V const &v)
+    {
+        return v.empty() ? 0 : (long long)v.front() + v[v.size() / 2] + v.back();
+    }
+
+    void algo(char const *name, bench::body raw, bench::body std_, bench::body rng,
+        bench::prepare prep = nullptr)
+    {
+        if(raw)
+            bench::add("algorithm", name, "raw", raw, prep);
+        if(std_)
+            bench::add("algorithm", name, "std", std_, prep);
+        bench::add("algorithm", name, "ranges", rng, prep);
+    }
+
+    // Makes the second half of the input a copy of the first, so comparing
+    // the halves touches every element.
+    void duplicate_halves(V &v)
+    {
+        std::copy(v.begin(), v.begin() + (long)(v.size() / 2), v.begin() + (long)(v.size() / 2));
+    }
+
+    void sort_halves(V &v)
+    {
+        std::sort(v.begin(), v.begin() + (long)(v.size() / 2));
+        std::sort(v.begin() + (long)(v.size() / 2), v.end());
+    }
+
+    void sort_all(V &v)
+    {
+        std::sort(v.begin(), v.end());
+    }
+
+    // Where the skewed benchmarks split their input: a short first run of a
+    // 1024th of it, as when intersecting a rare term's postings with a common
+    // one's.
+    V::iterator skew_point(V &v)
+    {
+        return v.begin() + (long)(v.size() / 1024);
+    }
+
+    void sort_skewed(V &v)
+    {
+        std::sort(v.begin(), skew_point(v));
+        std::sort(skew_point(v), v.end());
+    }
+
+    constexpr std::size_t merge_k_runs = 64;
+
+    // The input cut into merge_k_runs runs, each sorted.
+    std::vector<ranges::range<V::iterator>> runs(V &v)
+    {
+        std::vector<ranges::range<V::iterator>> rs;
+        std::size_t const n = v.size();
+        for(std::size_t i = 0; i < merge_k_runs; ++i)
+            rs.push_back(ranges::make_range(v.begin() + (long)(n * i / merge_k_runs),
+                v.begin() + (long)(n * (i + 1) / merge_k_runs)));
+        return rs;
+    }
+
+    void sort_runs(V &v)
+    {
+        for(auto rng : runs(v))
+            std::sort(rng.begin(), rng.end());
+    }
+
+    // Lookup keys for the binary searches.
+    int key(std::size_t i, std::size_t n)
+    {
+        return (int)((i * 7919u) % (n + 1));
+    }
+
+    constexpr std::size_t lookups = 1024;
+
+    int const needle[] = {-1, -2, -3, -4};
+
+    // Long enough that ranges::search may switch to a skip table.
+    int const long_needle[] = {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12};
+
+    void register_non_modifying()
+    {
+        algo("adjacent_find",
+            [](V &v) {
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    if(v[i - 1] == v[i])
+                        return (long long)i - 1;
+                return (long long)v.size();
+            },
+            [](V &v) { return pos(v, std::adjacent_find(v.begin(), v.end())); },
+            [](V &v) { return pos(v, ranges::adjacent_find(v)); });
+        algo("all_of",
+            [](V &v) {
+                for(int i : v)
+                    if(i < 0)
+                        return 0ll;
+                return 1ll;
+            },
+            [](V &v) { return (long long)std::all_of(v.begin(), v.end(), [](int i) { return i >= 0; }); },
+            [](V &v) { return (long long)ranges::all_of(v, [](int i) { return i >= 0; }); });
+        algo("any_of",
+            [](V &v) {
+                for(int i : v)
+                    if(i < 0)
+                        return 1ll;
+                return 0ll;
+            },
+            [](V &v) { return (long long)std::any_of(v.begin(), v.end(), [](int i) { return i < 0; }); },
+            [](V &v) { return (long long)ranges::any_of(v, [](int i) { return i < 0; }); });
+        algo("none_of", nullptr,
+            [](V &v) { return (long long)std::none_of(v.begin(), v.end(), [](int i) { return i < 0; }); },
+            [](V &v) { return (long long)ranges::none_of(v, [](int i) { return i < 0; }); });
+        algo("count",
+            [](V &v) {
+                long long c = 0;
+                for(int i : v)
+                    c += i == 7;
+                return c;
+            },
+            [](V &v) { return (long long)std::count(v.begin(), v.end(), 7); },
+            [](V &v) { return (long long)ranges::count(v, 7); });
+        algo("count_if",
+            [](V &v) {
+                long long c = 0;
+                for(int i : v)
+                    c += is_odd(i);
+                return c;
+            },
+            [](V &v) { return (long long)std::count_if(v.begin(), v.end(), is_odd); },
+            [](V &v) { return (long long)ranges::count_if(v, is_odd); });
+        algo("equal",
+            [](V &v) {
+                std::size_t const h = v.size() / 2;
+                for(std::size_t i = 0; i < h; ++i)
+                    if(v[i] != v[h + i])
+                        return 0ll;
+                return 1ll;
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)std::equal(v.begin(), m, m);
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)ranges::equal(v.begin(), m, m, m + (m - v.begin()));
+            },
+            duplicate_halves);
+        algo("mismatch",
+            [](V &v) {
+                std::size_t const h = v.size() / 2;
+                std::size_t i = 0;
+                for(; i < h; ++i)
+                    if(v[i] != v[h + i])
+                        break;
+                return (long long)i;
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return pos(v, std::mismatch(v.begin(), m, m).first);
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return pos(v, ranges::mismatch(v.begin(), m, m, m + (m - v.begin())).first);
+            },
+            duplicate_halves);
+        algo("lexicographical_compare", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)std::lexicographical_compare(v.begin(), m, m, m + (m - v.begin()));
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)ranges::lexicographical_compare(v.begin(), m, m,
+                    m + (m - v.begin()));
+            },
+            duplicate_halves);
+        algo("find",
+            [](V &v) {
+                std::size_t i = 0;
+                for(; i < v.size(); ++i)
+                    if(v[i] == -1)
+                        break;
+                return (long long)i;
+            },
+            [](V &v) { return pos(v, std::find(v.begin(), v.end(), -1)); },
+            [](V &v) { return pos(v, ranges::find(v, -1)); });
+        algo("find_if",
+            [](V &v) {
+                std::size_t i = 0;
+                for(; i < v.size(); ++i)
+                    if(v[i] < 0)
+                        break;
+                return (long long)i;
+            },
+            [](V &v) { return pos(v, std::find_if(v.begin(), v.end(), [](int i) { return i < 0; })); },
+            [](V &v) { return pos(v, ranges::find_if(v, [](int i) { return i < 0; })); });
+        algo("find_if_not", nullptr,
+            [](V &v) { return pos(v, std::find_if_not(v.begin(), v.end(), [](int i) { return i >= 0; })); },
+            [](V &v) { return pos(v, ranges::find_if_not(v, [](int i) { return i >= 0; })); });
+        algo("find_end", nullptr,
+            [](V &v) { return pos(v, std::find_end(v.begin(), v.end(), needle, needle + 3)); },
+            [](V &v) { return pos(v, ranges::find_end(v.begin(), v.end(), needle, needle + 3)); });
+        algo("find_first_of", nullptr,
+            [](V &v) { return pos(v, std::find_first_of(v.begin(), v.end(), needle, needle + 4)); },
+            [](V &v) { return pos(v, ranges::find_first_of(v, needle)); });
+        algo("search", nullptr,
+            [](V &v) { return pos(v, std::search(v.begin(), v.end(), needle, needle + 3)); },
+            [](V &v) { return pos(v, ranges::search(v.begin(), v.end(), needle, needle + 3)); });
+        algo("search_long", nullptr,
+            [](V &v) { return pos(v, std::search(v.begin(), v.end(), std::begin(long_needle), std::end(long_needle))); },
+            [](V &v) { return pos(v, ranges::search(v, long_needle)); });
+        algo("search_n", nullptr,
+            [](V &v) { return pos(v, std::search_n(v.begin(), v.end(), 3, -1)); },
+            [](V &v) { return pos(v, ranges::search_n(v, 3, -1)); });
+        algo("for_each",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += i;
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                std::for_each(v.begin(), v.end(), [&](int i) { s += i; });
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                ranges::for_each(v, [&](int i) { s += i; });
+                return s;
+            });
+        algo("is_sorted",
+            [](V &v) {
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    if(v[i] < v[i - 1])
+                        return 0ll;
+                return 1ll;
+            },
+            [](V &v) { return (long long)std::is_sorted(v.begin(), v.end()); },
+            [](V &v) { return (long long)ranges::is_sorted(v); });
+        algo("is_sorted_until", nullptr,
+            [](V &v) { return pos(v, std::is_sorted_until(v.begin(), v.end())); },
+            [](V &v) { return pos(v, ranges::is_sorted_until(v)); });
+        algo("is_partitioned", nullptr,
+            [](V &v) { return (long long)std::is_partitioned(v.begin(), v.end(), is_odd); },
+            [](V &v) { return (long long)ranges::is_partitioned(v, is_odd); },
+            [](V &v) { std::partition(v.begin(), v.end(), is_odd); });
+        algo("is_heap", nullptr,
+            [](V &v) { return (long long)std::is_heap(v.begin(), v.end()); },
+            [](V &v) { return (long long)ranges::is_heap(v); },
+            [](V &v) { std::make_heap(v.begin(), v.end()); });
+        algo("is_permutation", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)std::is_permutation(v.begin(), m, m);
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)ranges::is_permutation(v.begin(), m, m, m + (m - v.begin()));
+            },
+            duplicate_halves);
+        algo("max_element",
+            [](V &v) {
+                std::size_t m = 0;
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    if(v[m] < v[i])
+                        m = i;
+                return (long long)m;
+            },
+            [](V &v) { return pos(v, std::max_element(v.begin(), v.end())); },
+            [](V &v) { return pos(v, ranges::max_element(v)); });
+        algo("min_element",
+            [](V &v) {
+                std::size_t m = 0;
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    if(v[i] < v[m])
+                        m = i;
+                return (long long)m;
+            },
+            [](V &v) { return pos(v, std::min_element(v.begin(), v.end())); },
+            [](V &v) { return pos(v, ranges::min_element(v)); });
+        algo("minmax_element", nullptr,
+            [](V &v) {
+                auto p = std::minmax_element(v.begin(), v.end());
+                return pos(v, p.first) + pos(v, p.second);
+            },
+            [](V &v) {
+                auto p = ranges::minmax_element(v);
+                return pos(v, p.first) + pos(v, p.second);
+            });
+        algo("max", nullptr,
+            [](V &v) { return (long long)*std::max_element(v.begin(), v.end()); },
+            [](V &v) { return (long long)ranges::max(v); });
+        algo("min", nullptr,
+            [](V &v) { return (long long)*std::min_element(v.begin(), v.end()); },
+            [](V &v) { return (long long)ranges::min(v); });
+        algo("minmax", nullptr,
+            [](V &v) {
+                auto p = std::minmax_element(v.begin(), v.end());
+                return (long long)*p.first + *p.second;
+            },
+            [](V &v) {
+                auto p = ranges::minmax(v);
+                return (long long)p.first + p.second;
+            });
+    }
+
+    void register_binary_search()
+    {
+        algo("lower_bound",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                {
+                    int const x = key(k, v.size());
+                    std::size_t lo = 0, n = v.size();
+                    while(n > 0)
+                    {
+                        std::size_t const half = n / 2;
+                        if(v[lo + half] < x)
+                        {
+                            lo += half + 1;
+                            n -= half + 1;
+                        }
+                        else
+                            n = half;
+                    }
+                    s += (long long)lo;
+                }
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += pos(v, std::lower_bound(v.begin(), v.end(), key(k, v.size())));
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += pos(v, ranges::lower_bound(v, key(k, v.size())));
+                return s;
+            },
+            sort_all);
+        algo("upper_bound", nullptr,
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += pos(v, std::upper_bound(v.begin(), v.end(), key(k, v.size())));
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += pos(v, ranges::upper_bound(v, key(k, v.size())));
+                return s;
+            },
+            sort_all);
+        algo("equal_range", nullptr,
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                {
+                    auto r = std::equal_range(v.begin(), v.end(), key(k, v.size()));
+                    s += pos(v, r.first) + pos(v, r.second);
+                }
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                {
+                    auto r = ranges::equal_range(v, key(k, v.size()));
+                    s += pos(v, r.begin()) + pos(v, r.end());
+                }
+                return s;
+            },
+            sort_all);
+        algo("binary_search", nullptr,
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += std::binary_search(v.begin(), v.end(), key(k, v.size()));
+                return s;
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += ranges::binary_search(v, key(k, v.size()));
+                return s;
+            },
+            sort_all);
+        algo("partition_point", nullptr,
+            [](V &v) { return pos(v, std::partition_point(v.begin(), v.end(), is_odd)); },
+            [](V &v) { return pos(v, ranges::partition_point(v, is_odd)); },
+            [](V &v) { std::partition(v.begin(), v.end(), is_odd); });
+    }
+
+    void register_copying()
+    {
+        algo("copy",
+            [](V &v) {
+                V &out = scratch(v.size());
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    out[i] = v[i];
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::copy(v.begin(), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::copy(v, out.begin());
+                return probe(out);
+            });
+        algo("copy_backward", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::copy_backward(v.begin(), v.end(), out.end());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::copy_backward(v, out.end());
+                return probe(out);
+            });
+        algo("copy_if",
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::size_t j = 0;
+                for(int i : v)
+                    if(is_odd(i))
+                        out[j++] = i;
+                return (long long)j;
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(std::copy_if(v.begin(), v.end(), out.begin(), is_odd) - out.begin());
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(ranges::copy_if(v, out.begin(), is_odd).second - out.begin());
+            });
+        algo("copy_n", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::copy_n(v.begin(), v.size(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::copy_n(v.begin(), (long)v.size(), out.begin());
+                return probe(out);
+            });
+        algo("move", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::move(v.begin(), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::move(v, out.begin());
+                return probe(out);
+            });
+        algo("move_backward", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::move_backward(v.begin(), v.end(), out.end());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::move_backward(v, out.end());
+                return probe(out);
+            });
+        algo("reverse_copy", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::reverse_copy(v.begin(), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::reverse_copy(v, out.begin());
+                return probe(out);
+            });
+        algo("rotate_copy", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::rotate_copy(v.begin(), v.begin() + (long)(v.size() / 3), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::rotate_copy(v, v.begin() + (long)(v.size() / 3), out.begin());
+                return probe(out);
+            });
+        algo("replace_copy_if", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::replace_copy_if(v.begin(), v.end(), out.begin(), is_odd, 0);
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::replace_copy_if(v, out.begin(), is_odd, 0);
+                return probe(out);
+            });
+        algo("remove_copy_if", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(std::remove_copy_if(v.begin(), v.end(), out.begin(), is_odd) - out.begin());
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(ranges::remove_copy_if(v, out.begin(), is_odd).second - out.begin());
+            });
+        algo("unique_copy", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(std::unique_copy(v.begin(), v.end(), out.begin()) - out.begin());
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(ranges::unique_copy(v, out.begin()).second - out.begin());
+            });
+        algo("partition_copy", nullptr,
+            [](V &v) {
+                V &a = scratch(v.size()), &b = scratch(v.size(), 1);
+                auto r = std::partition_copy(v.begin(), v.end(), a.begin(), b.begin(), is_odd);
+                return (long long)(r.first - a.begin());
+            },
+            [](V &v) {
+                V &a = scratch(v.size()), &b = scratch(v.size(), 1);
+                auto r = ranges::partition_copy(v, a.begin(), b.begin(), is_odd);
+                return (long long)(std::get<1>(r) - a.begin());
+            });
+        algo("partial_sort_copy", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size() / 8 + 1);
+                std::partial_sort_copy(v.begin(), v.end(), out.begin(), out.end());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size() / 8 + 1);
+                ranges::partial_sort_copy(v, out);
+                return probe(out);
+            });
+        algo("transform",
+            [](V &v) {
+                V &out = scratch(v.size());
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    out[i] = v[i] * 3 + 1;
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::transform(v.begin(), v.end(), out.begin(), [](int i) { return i * 3 + 1; });
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::transform(v, out.begin(), [](int i) { return i * 3 + 1; });
+                return probe(out);
+            });
+        algo("swap_ranges", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                std::swap_ranges(v.begin(), m, m);
+                return probe(v);
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                ranges::swap_ranges(v.begin(), m, m, m + (m - v.begin()));
+                return probe(v);
+            });
+    }
+
+    void register_mutating()
+    {
+        algo("fill",
+            [](V &v) {
+                for(auto &i : v)
+                    i = 7;
+                return probe(v);
+            },
+            [](V &v) {
+                std::fill(v.begin(), v.end(), 7);
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::fill(v, 7);
+                return probe(v);
+            });
+        algo("fill_n", nullptr,
+            [](V &v) {
+                std::fill_n(v.begin(), v.size(), 7);
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::fill_n(v.begin(), (long)v.size(), 7);
+                return probe(v);
+            });
+        algo("generate",
+            [](V &v) {
+                int n = 0;
+                for(auto &i : v)
+                    i = n++;
+                return probe(v);
+            },
+            [](V &v) {
+                int n = 0;
+                std::generate(v.begin(), v.end(), [&] { return n++; });
+                return probe(v);
+            },
+            [](V &v) {
+                int n = 0;
+                ranges::generate(v, [&] { return n++; });
+                return probe(v);
+            });
+        algo("generate_n", nullptr,
+            [](V &v) {
+                int n = 0;
+                std::generate_n(v.begin(), v.size(), [&] { return n++; });
+                return probe(v);
+            },
+            [](V &v) {
+                int n = 0;
+                ranges::generate_n(v.begin(), (long)v.size(), [&] { return n++; });
+                return probe(v);
+            });
+        algo("replace_if",
+            [](V &v) {
+                for(auto &i : v)
+                    if(is_odd(i))
+                        i = 0;
+                return probe(v);
+            },
+            [](V &v) {
+                std::replace_if(v.begin(), v.end(), is_odd, 0);
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::replace_if(v, is_odd, 0);
+                return probe(v);
+            });
+        algo("remove",
+            [](V &v) {
+                std::size_t j = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(v[i] != 7)
+                        v[j++] = v[i];
+                return (long long)j;
+            },
+            [](V &v) { return pos(v, std::remove(v.begin(), v.end(), 7)); },
+            [](V &v) { return pos(v, ranges::remove(v, 7)); });
+        algo("remove_if",
+            [](V &v) {
+                std::size_t j = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(!is_odd(v[i]))
+                        v[j++] = v[i];
+                return (long long)j;
+            },
+            [](V &v) { return pos(v, std::remove_if(v.begin(), v.end(), is_odd)); },
+            [](V &v) { return pos(v, ranges::remove_if(v, is_odd)); });
+        algo("reverse",
+            [](V &v) {
+                for(std::size_t i = 0, j = v.size(); i + 1 < j; ++i, --j)
+                    std::swap(v[i], v[j - 1]);
+                return probe(v);
+            },
+            [](V &v) {
+                std::reverse(v.begin(), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::reverse(v);
+                return probe(v);
+            });
+        algo("rotate", nullptr,
+            [](V &v) {
+                std::rotate(v.begin(), v.begin() + (long)(v.size() / 3), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::rotate(v, v.begin() + (long)(v.size() / 3));
+                return probe(v);
+            });
+        algo("unique",
+            [](V &v) {
+                if(v.empty())
+                    return 0ll;
+                std::size_t j = 0;
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    if(v[i] != v[j])
+                        v[++j] = v[i];
+                return (long long)j + 1;
+            },
+            [](V &v) { return pos(v, std::unique(v.begin(), v.end())); },
+            [](V &v) { return pos(v, ranges::unique(v)); });
+        algo("partition",
+            [](V &v) {
+                std::size_t i = 0, j = v.size();
+                while(true)
+                {
+                    while(i < j && is_odd(v[i]))
+                        ++i;
+                    while(i < j && !is_odd(v[j - 1]))
+                        --j;
+                    if(i >= j)
+                        break;
+                    std::swap(v[i++], v[--j]);
+                }
+                return (long long)i;
+            },
+            [](V &v) { return pos(v, std::partition(v.begin(), v.end(), is_odd)); },
+            [](V &v) { return pos(v, ranges::partition(v, is_odd)); });
+        algo("stable_partition", nullptr,
+            [](V &v) { return pos(v, std::stable_partition(v.begin(), v.end(), is_odd)); },
+            [](V &v) { return pos(v, ranges::stable_partition(v, is_odd)); });
+        algo("shuffle", nullptr,
+            [](V &v) {
+                std::mt19937 gen;
+                std::shuffle(v.begin(), v.end(), gen);
+                return 0ll;
+            },
+            [](V &v) {
+                std::mt19937 gen;
+                ranges::shuffle(v, gen);
+                return 0ll;
+            });
+        algo("shuffle(par)", nullptr,
+            [](V &v) {
+                std::mt19937 gen;
+                std::shuffle(v.begin(), v.end(), gen);
+                return 0ll;
+            },
+            [](V &v) {
+                std::mt19937 gen;
+                ranges::shuffle(ranges::execution::par, v, gen);
+                return 0ll;
+            });
+        // One in a hundred. The raw loop is reservoir sampling with a random
+        // number per element (Algorithm R).
+        algo("sample",
+            [](V &v) {
+                static V out;
+                std::mt19937 gen;
+                std::size_t const n = v.size() / 100;
+                out.assign(v.begin(), v.begin() + (long)n);
+                for(std::size_t i = n; i < v.size(); ++i)
+                {
+                    std::size_t const j = std::uniform_int_distribution<std::size_t>{0, i}(gen);
+                    if(j < n)
+                        out[j] = v[i];
+                }
+                return probe(out);
+            },
+            nullptr,
+            [](V &v) {
+                static V out;
+                std::mt19937 gen;
+                out.resize(v.size() / 100);
+                ranges::sample(v, out.begin(), (long)out.size(), gen);
+                return probe(out);
+            });
+        algo("next_permutation", nullptr,
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += std::next_permutation(v.begin(), v.end());
+                return s + probe(v);
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += ranges::next_permutation(v);
+                return s + probe(v);
+            });
+        algo("prev_permutation", nullptr,
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += std::prev_permutation(v.begin(), v.end());
+                return s + probe(v);
+            },
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t k = 0; k < lookups; ++k)
+                    s += ranges::prev_permutation(v);
+                return s + probe(v);
+            });
+    }
+
+    void register_sorting()
+    {
+        algo("sort", nullptr,
+            [](V &v) {
+                std::sort(v.begin(), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::sort(v);
+                return probe(v);
+            });
+        algo("stable_sort", nullptr,
+            [](V &v) {
+                std::stable_sort(v.begin(), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::stable_sort(v);
+                return probe(v);
+            });
+        algo("radix_sort", nullptr,
+            [](V &v) {
+                std::sort(v.begin(), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::radix_sort(v);
+                return probe(v);
+            });
+        algo("partial_sort", nullptr,
+            [](V &v) {
+                std::partial_sort(v.begin(), v.begin() + (long)(v.size() / 8), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::partial_sort(v, v.begin() + (long)(v.size() / 8));
+                return probe(v);
+            });
+        algo("nth_element", nullptr,
+            [](V &v) {
+                std::nth_element(v.begin(), v.begin() + (long)(v.size() / 2), v.end());
+                return (long long)v[v.size() / 2];
+            },
+            [](V &v) {
+                ranges::nth_element(v, v.begin() + (long)(v.size() / 2));
+                return (long long)v[v.size() / 2];
+            });
+        algo("make_heap", nullptr,
+            [](V &v) {
+                std::make_heap(v.begin(), v.end());
+                return (long long)v.front();
+            },
+            [](V &v) {
+                ranges::make_heap(v);
+                return (long long)v.front();
+            });
+        algo("sort_heap", nullptr,
+            [](V &v) {
+                std::sort_heap(v.begin(), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::sort_heap(v);
+                return probe(v);
+            },
+            [](V &v) { std::make_heap(v.begin(), v.end()); });
+        algo("push_heap", nullptr,
+            [](V &v) {
+                for(auto i = v.begin() + 1; i <= v.end(); ++i)
+                    std::push_heap(v.begin(), i);
+                return (long long)v.front();
+            },
+            [](V &v) {
+                for(auto i = v.begin() + 1; i <= v.end(); ++i)
+                    ranges::push_heap(v.begin(), i);
+                return (long long)v.front();
+            });
+        algo("pop_heap", nullptr,
+            [](V &v) {
+                for(auto i = v.end(); i != v.begin(); --i)
+                    std::pop_heap(v.begin(), i);
+                return probe(v);
+            },
+            [](V &v) {
+                for(auto i = v.end(); i != v.begin(); --i)
+                    ranges::pop_heap(v.begin(), i);
+                return probe(v);
+            },
+            [](V &v) { std::make_heap(v.begin(), v.end()); });
+    }
+
+    void register_merging()
+    {
+        algo("merge", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                std::merge(v.begin(), m, m, v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                ranges::merge(v.begin(), m, m, v.end(), out.begin());
+                return probe(out);
+            },
+            sort_halves);
+        // Many sorted runs: sorting them all over again, against merging them.
+        algo("merge_k", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::copy(v.begin(), v.end(), out.begin());
+                std::sort(out.begin(), out.end());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::merge_k(runs(v), out.begin());
+                return probe(out);
+            },
+            sort_runs);
+        bench::add("algorithm", "merge_k", "view",
+            [](V &v) {
+                auto rs = runs(v);
+                return ranges::accumulate(ranges::view::merge_k(rs), 0ll);
+            },
+            sort_runs);
+        algo("inplace_merge", nullptr,
+            [](V &v) {
+                std::inplace_merge(v.begin(), v.begin() + (long)(v.size() / 2), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::inplace_merge(v, v.begin() + (long)(v.size() / 2));
+                return probe(v);
+            },
+            sort_halves);
+        algo("includes", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)std::includes(v.begin(), m, m, v.end());
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)ranges::includes(v.begin(), m, m, v.end());
+            },
+            sort_halves);
+        algo("set_union", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(std::set_union(v.begin(), m, m, v.end(), out.begin()) - out.begin());
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(std::get<2>(ranges::set_union(v.begin(), m, m, v.end(),
+                    out.begin())) - out.begin());
+            },
+            sort_halves);
+        algo("set_intersection", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(std::set_intersection(v.begin(), m, m, v.end(), out.begin()) -
+                    out.begin());
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(ranges::set_intersection(v.begin(), m, m, v.end(),
+                    out.begin()) - out.begin());
+            },
+            sort_halves);
+        algo("set_symmetric_difference", nullptr,
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(std::set_symmetric_difference(v.begin(), m, m, v.end(),
+                    out.begin()) - out.begin());
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(std::get<2>(ranges::set_symmetric_difference(v.begin(), m, m,
+                    v.end(), out.begin())) - out.begin());
+            },
+            sort_halves);
+        algo("set_intersection(skewed)", nullptr,
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(std::set_intersection(v.begin(), skew_point(v), skew_point(v),
+                    v.end(), out.begin()) - out.begin());
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                return (long long)(ranges::set_intersection(v.begin(), skew_point(v),
+                    skew_point(v), v.end(), out.begin()) - out.begin());
+            },
+            sort_skewed);
+        algo("includes(skewed)", nullptr,
+            [](V &v) {
+                return (long long)std::includes(skew_point(v), v.end(), v.begin(), skew_point(v));
+            },
+            [](V &v) {
+                return (long long)ranges::includes(skew_point(v), v.end(), v.begin(),
+                    skew_point(v));
+            },
+            [](V &v) {
+                // The short run drawn from the long one, so that all of it is
+                // found.
+                std::sort(v.begin(), v.end());
+                std::size_t const m = v.size() / 1024;
+                for(std::size_t i = 0; i < m; ++i)
+                    v[i] = v[m + i * ((v.size() - m) / m)];
+            });
+        bench::add("algorithm", "set_intersection", "view",
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return (long long)ranges::distance(ranges::view::set_intersection(
+                    ranges::make_range(v.begin(), m), ranges::make_range(m, v.end())));
+            },
+            sort_halves);
+        // Inputs that aren't sorted: sorting copies of both, against hashing
+        // one of them.
+        algo("set_intersection(unsorted)", nullptr,
+            [](V &v) {
+                V &in = scratch(v.size(), 1);
+                in.assign(v.begin(), v.end());
+                auto m = in.begin() + (long)(in.size() / 2);
+                std::sort(in.begin(), m);
+                std::sort(m, in.end());
+                V &out = scratch(v.size());
+                return (long long)(std::set_intersection(in.begin(), m, m, in.end(),
+                    out.begin()) - out.begin());
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                V &out = scratch(v.size());
+                return (long long)(ranges::unordered_set_intersection(v.begin(), m, m, v.end(),
+                    out.begin()) - out.begin());
+            });
+    }
+
+    std::vector<double> &scratch_doubles(std::size_t n)
+    {
+        static std::vector<double> out;
+        out.resize(n);
+        return out;
+    }
+
+    void register_numeric()
+    {
+        algo("accumulate",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += i;
+                return s;
+            },
+            [](V &v) { return std::accumulate(v.begin(), v.end(), 0ll); },
+            [](V &v) { return ranges::accumulate(v, 0ll); });
+        // reduce may regroup the sum, which a left fold can't: for doubles,
+        // the raw loop and accumulate are a chain of dependent additions.
+        algo("reduce",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += i;
+                return s;
+            },
+            nullptr,
+            [](V &v) { return ranges::reduce(v, 0ll); });
+        bench::add("algorithm", "reduce", "par",
+            [](V &v) { return ranges::reduce(ranges::execution::par, v, 0ll); });
+        algo("reduce(double)",
+            [](V &v) {
+                double s = 0;
+                for(int i : v)
+                    s += i;
+                return (long long)s;
+            },
+            [](V &v) { return (long long)std::accumulate(v.begin(), v.end(), 0.0); },
+            [](V &v) { return (long long)ranges::reduce(v, 0.0); });
+        bench::add("algorithm", "reduce(double)", "par",
+            [](V &v) { return (long long)ranges::reduce(ranges::execution::par, v, 0.0); });
+        algo("inner_product",
+            [](V &v) {
+                std::size_t const h = v.size() / 2;
+                long long s = 0;
+                for(std::size_t i = 0; i < h; ++i)
+                    s += (long long)v[i] * v[h + i];
+                return s;
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return std::inner_product(v.begin(), m, m, 0ll, std::plus<long long>{},
+                    std::multiplies<long long>{});
+            },
+            [](V &v) {
+                auto m = v.begin() + (long)(v.size() / 2);
+                return ranges::inner_product(v.begin(), m, m, m + (m - v.begin()), 0ll,
+                    std::plus<long long>{}, std::multiplies<long long>{});
+            });
+        algo("partial_sum",
+            [](V &v) {
+                V &out = scratch(v.size());
+                int s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    out[i] = s += v[i];
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::partial_sum(v.begin(), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::partial_sum(v, out.begin());
+                return probe(out);
+            });
+        bench::add("algorithm", "partial_sum", "inclusive_scan",
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::inclusive_scan(v, out.begin());
+                return probe(out);
+            });
+        bench::add("algorithm", "partial_sum", "par",
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::inclusive_scan(ranges::execution::par, v, out.begin());
+                return probe(out);
+            });
+        bench::add("algorithm", "partial_sum", "in-place",
+            [](V &v) {
+                V &out = scratch(v.size());
+                out.assign(v.begin(), v.end());
+                ranges::inclusive_scan(out);
+                return probe(out);
+            });
+        // For doubles, each addition of partial_sum waits for the one before.
+        algo("partial_sum(double)",
+            [](V &v) {
+                std::vector<double> &out = scratch_doubles(v.size());
+                double s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    out[i] = s += v[i];
+                return (long long)out.back();
+            },
+            nullptr,
+            [](V &v) {
+                std::vector<double> &out = scratch_doubles(v.size());
+                ranges::inclusive_scan(v, out.begin(), ranges::plus{},
+                    [](int i) { return (double)i; });
+                return (long long)out.back();
+            });
+        bench::add("algorithm", "partial_sum(double)", "par",
+            [](V &v) {
+                std::vector<double> &out = scratch_doubles(v.size());
+                ranges::inclusive_scan(ranges::execution::par, v, out.begin(), ranges::plus{},
+                    [](int i) { return (double)i; });
+                return (long long)out.back();
+            });
+        algo("adjacent_difference",
+            [](V &v) {
+                V &out = scratch(v.size());
+                if(!v.empty())
+                    out[0] = v[0];
+                for(std::size_t i = 1; i < v.size(); ++i)
+                    out[i] = v[i] - v[i - 1];
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                std::adjacent_difference(v.begin(), v.end(), out.begin());
+                return probe(out);
+            },
+            [](V &v) {
+                V &out = scratch(v.size());
+                ranges::adjacent_difference(v, out.begin());
+                return probe(out);
+            });
+        algo("iota",
+            [](V &v) {
+                int n = 0;
+                for(auto &i : v)
+                    i = n++;
+                return probe(v);
+            },
+            [](V &v) {
+                std::iota(v.begin(), v.end(), 0);
+                return probe(v);
+            },
+            [](V &v) {
+                ranges::iota(v, 0);
+                return probe(v);
+            });
+    }
+
+    // The input cut into vectors of four, for the join benchmarks, made once
+    // per input size.
+    std::vector<V> const &quads(V const &v)
+    {
+        static std::vector<V> q;
+        static std::size_t n = ~std::size_t{0};
+        if(n != v.size())
+        {
+            n = v.size();
+            q.clear();
+            for(std::size_t i = 0; i < v.size(); i += 4)
+                q.emplace_back(v.begin() + (long)i, v.begin() + (long)std::min(i + 4, v.size()));
+        }
+        return q;
+    }
+
+    void register_actions()
+    {
+        algo("join",
+            [](V &v) {
+                V out;
+                for(auto const &q : quads(v))
+                    out.insert(out.end(), q.begin(), q.end());
+                return probe(out);
+            }, nullptr,
+            [](V &v) {
+                return probe(ranges::action::join(quads(v)));
+            });
+        algo("sort|unique", nullptr,
+            [](V &v) {
+                std::sort(v.begin(), v.end());
+                v.erase(std::unique(v.begin(), v.end()), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                v |= ranges::action::sort | ranges::action::unique;
+                return probe(v);
+            });
+        algo("sort(par)|unique", nullptr,
+            [](V &v) {
+                std::sort(v.begin(), v.end());
+                v.erase(std::unique(v.begin(), v.end()), v.end());
+                return probe(v);
+            },
+            [](V &v) {
+                v |= ranges::action::sort(ranges::execution::par) | ranges::action::unique;
+                return probe(v);
+            });
+        algo("remove_if|transform",
+            [](V &v) {
+                std::size_t j = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(!is_odd(v[i]))
+                        v[j++] = v[i] / 2;
+                v.resize(j);
+                return probe(v);
+            },
+            [](V &v) {
+                v.erase(std::remove_if(v.begin(), v.end(), is_odd), v.end());
+                std::transform(v.begin(), v.end(), v.begin(), [](int i) { return i / 2; });
+                return probe(v);
+            },
+            [](V &v) {
+                v |= ranges::action::remove_if(is_odd) |
+                    ranges::action::transform([](int i) { return i / 2; });
+                return probe(v);
+            });
+    }
+}
+
+void register_algorithm_benchmarks()
+{
+    register_non_modifying();
+    register_binary_search();
+    register_copying();
+    register_mutating();
+    register_sorting();
+    register_merging();
+    register_numeric();
+    register_actions();
+}
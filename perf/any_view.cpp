@@ -0,0 +1,135 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares iterating a pipeline directly with iterating the same pipeline
+// through any_view, summing an erased range with a hand-written loop and with
+// accumulate (which reads it a block at a time), and sorting through an erased
+// random-access view, which copies iterators constantly.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <range/v3/all.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 == 1;
+    }
+};
+
+struct square
+{
+    long long operator()(int i) const
+    {
+        return (long long)i * i;
+    }
+};
+
+template<typename Rng>
+long long sum(Rng &&rng)
+{
+    long long total = 0;
+    RANGES_FOR(long long i, rng)
+        total += i;
+    return total;
+}
+
+int main()
+{
+    using namespace ranges;
+    constexpr std::size_t size = 10000000;
+    constexpr int repetitions = 10;
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist{0, 1000};
+    std::vector<int> data(size);
+    for(auto &i : data)
+        i = dist(gen);
+
+    auto pipeline = data | view::remove_if(is_odd{}) | view::transform(square{});
+    long long check = 0;
+
+    timer t;
+    for(int i = 0; i < repetitions; ++i)
+        check += sum(pipeline);
+    std::cout << "direct view:       " << t << '\n';
+
+    any_input_view<long long> erased = pipeline;
+    t.reset();
+    for(int i = 0; i < repetitions; ++i)
+        check -= sum(erased);
+    std::cout << "any_input_view:    " << t << '\n';
+
+    t.reset();
+    for(int i = 0; i < repetitions; ++i)
+        check += accumulate(erased, 0ll);
+    std::cout << "any_input_view accumulate: " << t << '\n';
+    check -= repetitions * accumulate(pipeline, 0ll);
+
+    t.reset();
+    for(int i = 0; i < repetitions; ++i)
+        check += sum(data | view::transform(square{}));
+    std::cout << "direct view:       " << t << '\n';
+
+    any_random_access_view<long long> erased_ra = data | view::transform(square{});
+    t.reset();
+    for(int i = 0; i < repetitions; ++i)
+        check -= sum(erased_ra);
+    std::cout << "any_random_access_view: " << t << '\n';
+
+    t.reset();
+    for(int i = 0; i < repetitions; ++i)
+        check += accumulate(erased_ra, 0ll);
+    std::cout << "any_random_access_view accumulate: " << t << '\n';
+    check -= repetitions * accumulate(erased_ra, 0ll);
+
+    std::vector<int> v = data;
+    t.reset();
+    sort(v);
+    std::cout << "sort direct:       " << t << '\n';
+
+    std::vector<int> w = data;
+    any_random_access_view<int &> erased_w = w;
+    t.reset();
+    sort(erased_w);
+    std::cout << "sort any_view:     " << t << '\n';
+
+    if(check != 0 || v != w)
+        std::cout << "MISMATCH\n";
+}
@@ -0,0 +1,348 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// A small benchmark harness in the spirit of Google Benchmark, without the
+// dependency. A benchmark is a named body run on a vector of ints of a given
+// size and distribution; every (group, name) has one or more variants, such as
+// "raw" (a hand-written loop), "std" (the standard algorithm) and "ranges", and
+// the report shows each variant's time relative to the first one registered,
+// which is the abstraction penalty when that is the raw loop.
+//
+// Each sample runs the body over a batch of fresh copies of the input, enough
+// of them that the sample is long enough to time, so that algorithms that
+// modify their input see the same data every time. Copying, and the optional
+// prepare step (e.g. sorting the input for binary_search), aren't timed.
+
+#ifndef RANGES_PERF_BENCHMARK_HPP
+#define RANGES_PERF_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    enum class distribution
+    {
+        random,     // uniform over [0, size)
+        sorted,     // the random values, ascending
+        reversed,   // the random values, descending
+        few_unique  // uniform over [0, 16)
+    };
+
+    inline char const *to_string(distribution d)
+    {
+        switch(d)
+        {
+        case distribution::random: return "random";
+        case distribution::sorted: return "sorted";
+        case distribution::reversed: return "reversed";
+        case distribution::few_unique: return "few_unique";
+        }
+        return "?";
+    }
+
+    inline std::vector<distribution> all_distributions()
+    {
+        return {distribution::random, distribution::sorted, distribution::reversed,
+            distribution::few_unique};
+    }
+
+    inline std::vector<int> make_input(distribution d, std::size_t n)
+    {
+        std::mt19937 gen{static_cast<std::mt19937::result_type>(n)};
+        int const hi = d == distribution::few_unique ? 15 : static_cast<int>(n);
+        std::uniform_int_distribution<int> dist{0, hi};
+        std::vector<int> v(n);
+        for(auto &i : v)
+            i = dist(gen);
+        if(d == distribution::sorted)
+            std::sort(v.begin(), v.end());
+        else if(d == distribution::reversed)
+            std::sort(v.begin(), v.end(), std::greater<int>{});
+        return v;
+    }
+
+    // A vector of n ints for bodies that need an output range. It lives as
+    // long as the program, so producing it allocates only when n grows.
+    inline std::vector<int> &scratch(std::size_t n, std::size_t which = 0)
+    {
+        static std::vector<std::vector<int>> bufs(4);
+        bufs[which].resize(n);
+        return bufs[which];
+    }
+
+    // The body returns a value computed from its work, which is reported as a
+    // checksum (so variants can be compared) and keeps the work from being
+    // optimized away.
+    using body = std::function<long long(std::vector<int> &)>;
+    using prepare = std::function<void(std::vector<int> &)>;
+
+    struct benchmark
+    {
+        std::string group, name, variant;
+        bench::body body;
+        bench::prepare prepare;
+    };
+
+    inline std::vector<benchmark> &registry()
+    {
+        static std::vector<benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    inline void add(std::string group, std::string name, std::string variant, body b,
+        prepare p = nullptr)
+    {
+        registry().push_back(benchmark{std::move(group), std::move(name), std::move(variant),
+            std::move(b), std::move(p)});
+    }
+
+    enum class format
+    {
+        text,
+        csv,
+        json
+    };
+
+    struct options
+    {
+        std::vector<std::size_t> sizes{1u << 10, 1u << 14, 1u << 18};
+        std::vector<distribution> distributions = all_distributions();
+        std::string filter;
+        int warmup = 1;
+        int repetitions = 5;
+        // The least number of elements one sample processes.
+        std::size_t min_batch_elements = 1u << 16;
+        bench::format format = format::text;
+    };
+
+    struct result
+    {
+        benchmark const *bm;
+        distribution dist;
+        std::size_t size;
+        double min_ns, median_ns, mean_ns, relative;
+        long long checksum;
+    };
+
+    inline std::vector<std::string> split(std::string const &s, char sep)
+    {
+        std::vector<std::string> parts;
+        std::string part;
+        std::istringstream in{s};
+        while(std::getline(in, part, sep))
+            if(!part.empty())
+                parts.push_back(part);
+        return parts;
+    }
+
+    // Recognizes --size=N[,N...], --dist=NAME[,NAME...], --filter=SUBSTRING
+    // (matched against "group/name/variant"), --warmup=N, --reps=N and
+    // --format=text|csv|json. Returns false after printing usage on
+    // anything else.
+    inline bool parse_options(int argc, char **argv, options &opts)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            std::string const arg = argv[i];
+            auto const eq = arg.find('=');
+            std::string const key = arg.substr(0, eq);
+            std::string const val = eq == std::string::npos ? "" : arg.substr(eq + 1);
+            if(key == "--size")
+            {
+                opts.sizes.clear();
+                for(auto const &s : split(val, ','))
+                    opts.sizes.push_back(static_cast<std::size_t>(std::strtoull(s.c_str(), nullptr, 0)));
+            }
+            else if(key == "--dist")
+            {
+                opts.distributions.clear();
+                for(auto const &s : split(val, ','))
+                    for(auto d : all_distributions())
+                        if(s == to_string(d))
+                            opts.distributions.push_back(d);
+            }
+            else if(key == "--filter")
+                opts.filter = val;
+            else if(key == "--warmup")
+                opts.warmup = std::atoi(val.c_str());
+            else if(key == "--reps")
+                opts.repetitions = std::max(1, std::atoi(val.c_str()));
+            else if(key == "--format" && (val == "text" || val == "csv" || val == "json"))
+                opts.format = val == "text" ? format::text : val == "csv" ? format::csv : format::json;
+            else
+            {
+                std::cerr << "usage: " << argv[0] << " [--size=N,...] [--dist=random,sorted,"
+                    "reversed,few_unique] [--filter=SUBSTRING] [--warmup=N] [--reps=N] "
+                    "[--format=text|csv|json]\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Times one sample of bm, run once on each of `copies`, in nanoseconds
+    // per call.
+    inline double run_sample(benchmark const &bm, std::vector<int> const &input,
+        std::vector<std::vector<int>> &copies, long long &checksum)
+    {
+        for(auto &c : copies)
+        {
+            c.assign(input.begin(), input.end());
+            if(bm.prepare)
+                bm.prepare(c);
+        }
+        auto const start = std::chrono::steady_clock::now();
+        long long sum = 0;
+        for(auto &c : copies)
+            sum += bm.body(c);
+        auto const stop = std::chrono::steady_clock::now();
+        checksum = sum / static_cast<long long>(copies.size());
+        return static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) /
+            static_cast<double>(copies.size());
+    }
+
+    inline result run(benchmark const &bm, distribution d, std::size_t n,
+        std::vector<int> const &input, options const &opts)
+    {
+        std::size_t const batch = std::max<std::size_t>(1, opts.min_batch_elements / std::max<std::size_t>(n, 1));
+        std::vector<std::vector<int>> copies(batch);
+        long long checksum = 0;
+        for(int i = 0; i < opts.warmup; ++i)
+            run_sample(bm, input, copies, checksum);
+        std::vector<double> samples;
+        for(int i = 0; i < opts.repetitions; ++i)
+            samples.push_back(run_sample(bm, input, copies, checksum));
+        std::sort(samples.begin(), samples.end());
+        double const mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+            static_cast<double>(samples.size());
+        return result{&bm, d, n, samples.front(), samples[samples.size() / 2], mean, 1.0, checksum};
+    }
+
+    inline void print_header(options const &opts)
+    {
+        switch(opts.format)
+        {
+        case format::text:
+            std::cout << std::left << std::setw(48) << "benchmark" << std::setw(12) << "dist"
+                << std::right << std::setw(10) << "size" << std::setw(14) << "median ns"
+                << std::setw(12) << "ns/elem" << std::setw(14) << "min ns"
+                << std::setw(10) << "relative" << std::setw(22) << "checksum" << '\n';
+            break;
+        case format::csv:
+            std::cout << "group,name,variant,distribution,size,median_ns,ns_per_element,min_ns,"
+                "mean_ns,relative,checksum\n";
+            break;
+        case format::json:
+            std::cout << "{\n  \"benchmarks\": [";
+            break;
+        }
+    }
+
+    inline void print_result(result const &r, bool first, options const &opts)
+    {
+        double const per_elem = r.median_ns / static_cast<double>(std::max<std::size_t>(r.size, 1));
+        benchmark const &bm = *r.bm;
+        switch(opts.format)
+        {
+        case format::text:
+            std::cout << std::left << std::setw(48)
+                << (bm.group + "/" + bm.name + "/" + bm.variant) << std::setw(12)
+                << to_string(r.dist) << std::right << std::setw(10) << r.size << std::fixed
+                << std::setprecision(0) << std::setw(14) << r.median_ns << std::setprecision(3)
+                << std::setw(12) << per_elem << std::setprecision(0) << std::setw(14) << r.min_ns
+                << std::setprecision(2) << std::setw(10) << r.relative << std::setw(22)
+                << r.checksum << '\n';
+            break;
+        case format::csv:
+            std::cout << bm.group << ',' << bm.name << ',' << bm.variant << ','
+                << to_string(r.dist) << ',' << r.size << ',' << r.median_ns << ','
+                << per_elem << ',' << r.min_ns << ',' << r.mean_ns << ',' << r.relative << ','
+                << r.checksum << '\n';
+            break;
+        case format::json:
+            std::cout << (first ? "\n" : ",\n") << "    {\"group\": \"" << bm.group
+                << "\", \"name\": \"" << bm.name << "\", \"variant\": \"" << bm.variant
+                << "\", \"distribution\": \"" << to_string(r.dist) << "\", \"size\": " << r.size
+                << ", \"median_ns\": " << r.median_ns << ", \"ns_per_element\": " << per_elem
+                << ", \"min_ns\": " << r.min_ns << ", \"mean_ns\": " << r.mean_ns
+                << ", \"relative\": " << r.relative << ", \"checksum\": " << r.checksum << '}';
+            break;
+        }
+        std::cout.flush();
+    }
+
+    inline void print_footer(options const &opts)
+    {
+        if(opts.format == format::json)
+            std::cout << "\n  ]\n}\n";
+    }
+
+    // Runs every registered benchmark that matches the filter, for every
+    // distribution and size, variants of the same (group, name) back to back.
+    inline int run_all(options const &opts)
+    {
+        std::vector<benchmark> const &all = registry();
+        print_header(opts);
+        bool first = true;
+        for(std::size_t i = 0; i < all.size();)
+        {
+            std::size_t j = i;
+            while(j < all.size() && all[j].group == all[i].group && all[j].name == all[i].name)
+                ++j;
+            std::vector<benchmark const *> selected;
+            for(std::size_t k = i; k < j; ++k)
+                if((all[k].group + "/" + all[k].name + "/" + all[k].variant).find(opts.filter) !=
+                    std::string::npos)
+                    selected.push_back(&all[k]);
+            for(auto d : opts.distributions)
+            {
+                for(auto n : opts.sizes)
+                {
+                    if(selected.empty())
+                        break;
+                    std::vector<int> const input = make_input(d, n);
+                    double baseline = -1;
+                    for(auto bm : selected)
+                    {
+                        result r = bench::run(*bm, d, n, input, opts);
+                        if(baseline < 0)
+                            baseline = r.median_ns;
+                        r.relative = baseline > 0 ? r.median_ns / baseline : 1.0;
+                        print_result(r, first, opts);
+                        first = false;
+                    }
+                }
+            }
+            i = j;
+        }
+        print_footer(opts);
+        return 0;
+    }
+}
+
+// Defined in algorithm_benchmarks.cpp and view_benchmarks.cpp.
+void register_algorithm_benchmarks();
+void register_view_benchmarks();
+
+#endif
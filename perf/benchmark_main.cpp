@@ -0,0 +1,30 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// range_benchmarks: times every algorithm and view against the equivalent raw
+// loop and std:: algorithm. Run with --help for the options; for example
+//
+//     range_benchmarks --filter=view/ --size=100000 --dist=random --format=csv
+//
+// Comparing the CSV or JSON output of two builds shows regressions.
+
+#include "benchmark.hpp"
+
+int main(int argc, char **argv)
+{
+    bench::options opts;
+    if(!bench::parse_options(argc, argv, opts))
+        return 1;
+    register_algorithm_benchmarks();
+    register_view_benchmarks();
+    return bench::run_all(opts);
+}
@@ -60,6 +60,44 @@ namespace
     static std::string name() { return "random_uniform_integer_sequence"; }
   };
 
+  /// Random integers drawn from only a few distinct values
+  struct random_few_unique_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist{0, 15};
+    auto operator()(std::size_t) {
+      return ranges::view::generate([&]{ return dist(gen); });
+    }
+    static std::string name() { return "random_few_unique_integer_sequence"; }
+  };
+
+  /// Ascending integers with one in every hundred replaced by a random value
+  struct mostly_ascending_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist;
+    auto operator()(std::size_t) {
+      return ranges::view::ints(0) | ranges::view::transform([&](int i) {
+        return i % 100 == 0 ? dist(gen) : i;
+      });
+    }
+    static std::string name() { return "mostly_ascending_integer_sequence"; }
+  };
+
+  /// Random integers in sorted runs of a sixteenth of the input each, as
+  /// when concatenating the sorted outputs of several shards
+  struct sorted_runs_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist;
+    std::vector<int> runs;
+    auto operator()(std::size_t n) {
+      runs.resize(n);
+      std::generate(runs.begin(), runs.end(), [&]{ return dist(gen); });
+      for (std::size_t k = 0; k < 16; ++k)
+        std::sort(runs.begin() + n * k / 16, runs.begin() + n * (k + 1) / 16);
+      return ranges::view::all(runs);
+    }
+    static std::string name() { return "sorted_runs_integer_sequence"; }
+  };
+
   struct ascending_integer_sequence {
     auto operator()(std::size_t) { return ranges::view::ints(1); }
     static std::string name() { return "ascending_integer_sequence"; }
@@ -230,6 +268,41 @@ namespace
                 << setw(20) << to_millis(ss.mean_t) << '\n';
     }
   }
+
+  template <typename Seq>
+  void benchmark_stable_sort(Seq &&seq, std::size_t max_size) {
+    auto natural_comp = make_computation_on_sequence(
+        seq, [](auto &&v) { ranges::stable_sort(ranges::natural_merge, v); }, max_size);
+
+    auto ranges_comp =
+        make_computation_on_sequence(seq, ranges::stable_sort, max_size);
+
+    auto std_comp = make_computation_on_sequence(
+        seq, [](auto &&v) { std::stable_sort(std::begin(v), std::end(v)); }, max_size);
+
+    auto natural_benchmark =
+        benchmark(natural_comp, geometric_sequence_n(2, max_size));
+
+    auto ranges_benchmark =
+        benchmark(ranges_comp, geometric_sequence_n(2, max_size));
+
+    auto std_benchmark =
+        benchmark(std_comp, geometric_sequence_n(2, max_size));
+    using std::setw;
+    std::cout << '#'
+              << "pattern: " << seq.name() << '\n';
+    std::cout << '#' << setw(19) << 'N' << setw(20) << "natural_merge" << setw(20)
+              << "ranges::stable_sort" << setw(20) << "std::stable_sort"
+              << '\n';
+    RANGES_FOR(auto p, ranges::view::zip(natural_benchmark.results,
+                                         ranges_benchmark.results,
+                                         std_benchmark.results)) {
+      std::cout << setw(20) << std::get<0>(p).size
+                << setw(20) << to_millis(std::get<0>(p).mean_t)
+                << setw(20) << to_millis(std::get<1>(p).mean_t)
+                << setw(20) << to_millis(std::get<2>(p).mean_t) << '\n';
+    }
+  }
 } // unnamed namespace
 
 int main() {
@@ -240,11 +313,23 @@ int main() {
   print(descending_integer_sequence(), 20);
   print(even_odd_integer_sequence(), 20);
   print(organ_pipe_integer_sequence(), 20);
+  print(random_few_unique_integer_sequence(), 20);
+  print(mostly_ascending_integer_sequence(), 20);
+  print(sorted_runs_integer_sequence(), 20);
 
   benchmark_sort(random_uniform_integer_sequence(), max_size);
+  benchmark_sort(random_few_unique_integer_sequence(), max_size);
+  benchmark_sort(mostly_ascending_integer_sequence(), max_size);
   benchmark_sort(ascending_integer_sequence(), max_size);
   benchmark_sort(descending_integer_sequence(), max_size);
   benchmark_sort(organ_pipe_integer_sequence(), max_size);
+  benchmark_sort(sorted_runs_integer_sequence(), max_size);
+
+  benchmark_stable_sort(random_uniform_integer_sequence(), max_size);
+  benchmark_stable_sort(sorted_runs_integer_sequence(), max_size);
+  benchmark_stable_sort(mostly_ascending_integer_sequence(), max_size);
+  benchmark_stable_sort(ascending_integer_sequence(), max_size);
+  benchmark_stable_sort(descending_integer_sequence(), max_size);
 }
 
 #else
@@ -0,0 +1,600 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Every view in view/, and a few typical adaptor chains, timed by summing the
+// view's elements with a range-based for loop, against a raw loop that
+// computes the same sum. The relative column is the abstraction penalty.
+// view::c_str and view::tokenize work on characters rather than ints and are
+// covered by their own tests; view::single and view::empty have no per-element
+// cost to measure.
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view.hpp>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "benchmark.hpp"
+
+namespace
+{
+    using V = std::vector<int>;
+
+    bool is_odd(int i)
+    {
+        return (i & 1) != 0;
+    }
+
+    template<typename Rng>
+    long long sum(Rng &&rng)
+    {
+        long long s = 0;
+        RANGES_FOR(auto &&i, rng)
+            s += i;
+        return s;
+    }
+
+    // For views of views: the sum of the elements of every inner range.
+    template<typename Rng>
+    long long sum_of_sums(Rng &&rng)
+    {
+        long long s = 0;
+        RANGES_FOR(auto &&r, rng)
+            s += sum(r);
+        return s;
+    }
+
+    struct sum_fn
+    {
+        template<typename Rng>
+        long long operator()(Rng &&rng) const
+        {
+            return sum(rng);
+        }
+    };
+
+    struct widen
+    {
+        long long operator()(int i) const
+        {
+            return i;
+        }
+    };
+
+    void view(char const *name, bench::body raw, bench::body rng)
+    {
+        bench::add("view", name, "raw", raw);
+        bench::add("view", name, "ranges", rng);
+    }
+
+    // Three arrays of floats and one to write to, for the zip benchmarks, made
+    // once per input size.
+    struct float_arrays
+    {
+        std::vector<float> x, y, z, out;
+    };
+
+    float_arrays &floats(V const &v)
+    {
+        static float_arrays a;
+        if(a.x.size() != v.size())
+        {
+            a.x.assign(v.begin(), v.end());
+            a.y.assign(v.rbegin(), v.rend());
+            a.z.assign(v.size(), 0.5f);
+            a.out.assign(v.size(), 0.f);
+        }
+        return a;
+    }
+
+    struct fma_fn
+    {
+        float operator()(float a, float b, float c) const
+        {
+            return a * b + c;
+        }
+    };
+
+    // The same records as an array of structures and as a structure of
+    // arrays, for reading one field of each.
+    struct particle
+    {
+        int id;
+        double x, y, z, mass;
+    };
+
+    struct particles
+    {
+        std::vector<particle> aos;
+        ranges::soa_vector<int, double, double, double, double> soa;
+    };
+
+    particles &particles_of(V const &v)
+    {
+        static particles p;
+        if(p.aos.size() != v.size())
+        {
+            p.aos.clear();
+            p.soa.clear();
+            for(int i : v)
+            {
+                p.aos.push_back(particle{i, 1.0 * i, 2.0, 3.0, 4.0});
+                p.soa.emplace_back(i, 1.0 * i, 2.0, 3.0, 4.0);
+            }
+        }
+        return p;
+    }
+
+    long long raw_sum(V const &v, std::size_t begin, std::size_t end, std::size_t stride = 1)
+    {
+        long long s = 0;
+        for(std::size_t i = begin; i < end; i += stride)
+            s += v[i];
+        return s;
+    }
+
+    void register_simple_views()
+    {
+        using namespace ranges;
+        view("all",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::all(v)); });
+        view("bounded",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::bounded(view::delimit(v, -1))); });
+        view("const",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::const_(v)); });
+        view("counted",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::counted(v.begin(), (long)v.size())); });
+        view("delimit",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = 0; i < v.size() && v[i] != -1; ++i)
+                    s += v[i];
+                return s;
+            },
+            [](V &v) { return sum(view::delimit(v, -1)); });
+        view("drop",
+            [](V &v) { return raw_sum(v, v.size() / 2, v.size()); },
+            [](V &v) { return sum(view::drop(v, (long)(v.size() / 2))); });
+        view("drop_while",
+            [](V &v) {
+                std::size_t i = 0;
+                while(i < v.size() && v[i] < 8)
+                    ++i;
+                return raw_sum(v, i, v.size());
+            },
+            [](V &v) { return sum(view::drop_while(v, [](int i) { return i < 8; })); });
+        view("generate_n",
+            [](V &v) {
+                long long s = 0;
+                int n = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += n++;
+                return s;
+            },
+            [](V &v) {
+                int n = 0;
+                return sum(view::generate_n([&n] { return n++; }, v.size()));
+            });
+        view("indirect",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::iota(v.data(), v.data() + v.size()) | view::indirect); });
+        view("iota",
+            [](V &v) {
+                long long s = 0;
+                for(int i = 0; i < (int)v.size(); ++i)
+                    s += i;
+                return s;
+            },
+            [](V &v) { return sum(view::iota(0, (int)v.size())); });
+        view("move",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::move(v)); });
+        view("repeat_n",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    s += 7;
+                return s;
+            },
+            [](V &v) { return sum(view::repeat_n(7, (long)v.size())); });
+        view("reverse",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = v.size(); i-- > 0;)
+                    s += v[i];
+                return s;
+            },
+            [](V &v) { return sum(view::reverse(v)); });
+        view("slice",
+            [](V &v) { return raw_sum(v, v.size() / 4, 3 * v.size() / 4); },
+            [](V &v) {
+                return sum(view::slice(v, (long)(v.size() / 4), (long)(3 * v.size() / 4)));
+            });
+        view("stride",
+            [](V &v) { return raw_sum(v, 0, v.size(), 3); },
+            [](V &v) { return sum(view::stride(v, 3)); });
+        view("tail",
+            [](V &v) { return raw_sum(v, 1, v.size()); },
+            [](V &v) { return sum(view::tail(v)); });
+        view("take",
+            [](V &v) { return raw_sum(v, 0, v.size() / 2); },
+            [](V &v) { return sum(view::take(v, (long)(v.size() / 2))); });
+        view("take_exactly",
+            [](V &v) { return raw_sum(v, 0, v.size() / 2); },
+            [](V &v) { return sum(view::take_exactly(v, (long)(v.size() / 2))); });
+        view("take_while",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = 0; i < v.size() && v[i] >= 0; ++i)
+                    s += v[i];
+                return s;
+            },
+            [](V &v) { return sum(view::take_while(v, [](int i) { return i >= 0; })); });
+        view("unbounded",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) {
+                auto rng = view::unbounded(v.data());
+                return sum(view::take_exactly(rng, (long)v.size()));
+            });
+    }
+
+    void register_element_views()
+    {
+        using namespace ranges;
+        view("sample",
+            [](V &v) {
+                std::mt19937 gen;
+                std::size_t const n = v.size() / 100;
+                long long s = 0;
+                for(std::size_t i = 0, k = 0; k < n; ++i)
+                {
+                    if(std::uniform_int_distribution<std::size_t>{0, v.size() - i - 1}(gen) <
+                        n - k)
+                    {
+                        s += v[i];
+                        ++k;
+                    }
+                }
+                return s;
+            },
+            [](V &v) {
+                std::mt19937 gen;
+                return sum(view::sample(v, (long)(v.size() / 100), gen));
+            });
+        view("transform",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += i * 3 + 1;
+                return s;
+            },
+            [](V &v) { return sum(view::transform(v, [](int i) { return i * 3 + 1; })); });
+        bench::add("view", "transform", "any_view",
+            [](V &v) {
+                any_input_view<int> rng = view::transform(v, [](int i) { return i * 3 + 1; });
+                return sum(rng);
+            });
+        view("remove_if",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    if(!is_odd(i))
+                        s += i;
+                return s;
+            },
+            [](V &v) { return sum(view::remove_if(v, is_odd)); });
+        view("filter",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    if(is_odd(i))
+                        s += i;
+                return s;
+            },
+            [](V &v) { return sum(view::filter(v, is_odd)); });
+        view("replace",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += i == 7 ? 8 : i;
+                return s;
+            },
+            [](V &v) { return sum(view::replace(v, 7, 8)); });
+        view("replace_if",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    s += is_odd(i) ? 0 : i;
+                return s;
+            },
+            [](V &v) { return sum(view::replace_if(v, is_odd, 0)); });
+        view("unique",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(i == 0 || v[i] != v[i - 1])
+                        s += v[i];
+                return s;
+            },
+            [](V &v) { return sum(view::unique(v)); });
+        view("adjacent_remove_if",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    if(i + 1 == v.size() || v[i] != v[i + 1])
+                        s += v[i];
+                return s;
+            },
+            [](V &v) { return sum(view::adjacent_remove_if(v, std::equal_to<int>{})); });
+        view("partial_sum",
+            [](V &v) {
+                long long s = 0, p = 0;
+                for(int i : v)
+                    s += p += i;
+                return s;
+            },
+            [](V &v) {
+                return sum(view::transform(v, widen{}) | view::partial_sum(std::plus<long long>{}));
+            });
+        view("intersperse",
+            [](V &v) { return raw_sum(v, 0, v.size()) + 7 * ((long long)v.size() - 1); },
+            [](V &v) { return sum(view::intersperse(v, 7)); });
+        view("concat",
+            [](V &v) { return 2 * raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::concat(v, v)); });
+        // Algorithms walk a concat one underlying range at a time.
+        bench::add("view", "concat", "accumulate",
+            [](V &v) { return ranges::accumulate(view::concat(v, v), 0LL); });
+        view("for_each",
+            [](V &v) { return 2 * raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::for_each(v, [](int i) { return view::repeat_n(i, 2); })); });
+        bench::add("view", "for_each", "accumulate",
+            [](V &v) {
+                return ranges::accumulate(view::for_each(v, [](int i) { return view::repeat_n(i, 2); }),
+                    0LL);
+            });
+        // Zips of sized random-access ranges keep one index into all of them;
+        // copy, transform, for_each and accumulate read them as zip_spans.
+        bench::add("view", "zip_with", "raw",
+            [](V &v) {
+                float_arrays &a = floats(v);
+                for(std::size_t i = 0; i < a.out.size(); ++i)
+                    a.out[i] = a.x[i] * a.y[i] + a.z[i];
+                return (long long)a.out[a.out.size() / 2];
+            });
+        bench::add("view", "zip_with", "copy",
+            [](V &v) {
+                float_arrays &a = floats(v);
+                ranges::copy(view::zip_with(fma_fn{}, a.x, a.y, a.z), a.out.begin());
+                return (long long)a.out[a.out.size() / 2];
+            });
+        bench::add("view", "zip_with", "std::copy",
+            [](V &v) {
+                float_arrays &a = floats(v);
+                auto rng = view::zip_with(fma_fn{}, a.x, a.y, a.z);
+                std::copy(ranges::begin(rng), ranges::end(rng), a.out.begin());
+                return (long long)a.out[a.out.size() / 2];
+            });
+        // Summing one field: a projection of an array of structures reads
+        // whole records, a soa_vector column only the field.
+        bench::add("view", "soa_vector", "aos transform",
+            [](V &v) {
+                return ranges::accumulate(
+                    view::transform(particles_of(v).aos, &particle::id), 0LL);
+            });
+        bench::add("view", "soa_vector", "column",
+            [](V &v) { return ranges::accumulate(particles_of(v).soa.column<0>(), 0LL); });
+        view("zip",
+            [](V &v) { return 2 * raw_sum(v, 0, v.size()); },
+            [](V &v) {
+                long long s = 0;
+                RANGES_FOR(auto &&p, view::zip(v, v))
+                    s += p.first + p.second;
+                return s;
+            });
+    }
+
+    void register_nested_views()
+    {
+        using namespace ranges;
+        view("chunk",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum_of_sums(view::chunk(v, 16)); });
+        view("join",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) { return sum(view::chunk(v, 16) | view::join); });
+        bench::add("view", "join", "accumulate",
+            [](V &v) { return ranges::accumulate(view::chunk(v, 16) | view::join, 0LL); });
+        view("join|find",
+            [](V &v) { return (long long)(std::find(v.begin(), v.end(), -1) - v.begin()); },
+            [](V &v) {
+                auto rng = view::chunk(v, 16) | view::join;
+                auto const n = ranges::distance(ranges::find(rng, -1), ranges::end(rng));
+                return (long long)v.size() - n;
+            });
+        view("group_by",
+            [](V &v) {
+                long long groups = 0;
+                for(std::size_t i = 0; i < v.size(); ++i)
+                    groups += i == 0 || v[i] != v[i - 1];
+                return groups;
+            },
+            [](V &v) {
+                long long groups = 0;
+                RANGES_FOR(auto &&g, view::group_by(v, std::equal_to<int>{}))
+                {
+                    (void)g;
+                    ++groups;
+                }
+                return groups;
+            });
+        view("split",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    if(i != 0)
+                        s += i;
+                return s;
+            },
+            [](V &v) { return sum_of_sums(view::split(v, 0)); });
+    }
+
+    void register_chains()
+    {
+        using namespace ranges;
+        view("filter|transform",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    if(is_odd(i))
+                        s += i * 3 + 1;
+                return s;
+            },
+            [](V &v) {
+                return sum(v | view::filter(is_odd) | view::transform([](int i) { return i * 3 + 1; }));
+            });
+        bench::add("view", "filter|transform", "accumulate",
+            [](V &v) {
+                return ranges::accumulate(v | view::filter(is_odd) |
+                    view::transform([](int i) { return i * 3 + 1; }), 0LL);
+            });
+        view("transform|filter",
+            [](V &v) {
+                long long s = 0;
+                for(int i : v)
+                    if(is_odd(i * 3 + 1))
+                        s += i * 3 + 1;
+                return s;
+            },
+            [](V &v) {
+                return sum(v | view::transform([](int i) { return i * 3 + 1; }) | view::filter(is_odd));
+            });
+        // Pushed from the vector through the filter and the function.
+        bench::add("view", "transform|filter", "accumulate",
+            [](V &v) {
+                return ranges::accumulate(v | view::transform([](int i) { return i * 3 + 1; }) |
+                    view::filter(is_odd), 0LL);
+            });
+        bench::add("view", "transform|filter", "cache1",
+            [](V &v) {
+                return sum(v | view::transform([](int i) { return i * 3 + 1; }) | view::cache1 |
+                    view::filter(is_odd));
+            });
+        view("filter|transform|take",
+            [](V &v) {
+                long long s = 0;
+                std::size_t n = 0;
+                for(std::size_t i = 0; i < v.size() && n < v.size() / 4; ++i)
+                    if(is_odd(v[i]))
+                    {
+                        s += v[i] * 3 + 1;
+                        ++n;
+                    }
+                return s;
+            },
+            [](V &v) {
+                return sum(v | view::filter(is_odd) | view::transform([](int i) { return i * 3 + 1; }) |
+                    view::take(v.size() / 4));
+            });
+        view("reverse|stride",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = v.size(); i > 0; i = i > 3 ? i - 3 : 0)
+                    s += v[i - 1];
+                return s;
+            },
+            [](V &v) { return sum(v | view::reverse | view::stride(3)); });
+        view("drop|take|transform",
+            [](V &v) {
+                long long s = 0;
+                for(std::size_t i = v.size() / 4; i < v.size() / 2; ++i)
+                    s += v[i] * 3 + 1;
+                return s;
+            },
+            [](V &v) {
+                return sum(v | view::drop(v.size() / 4) | view::take(v.size() / 4) |
+                    view::transform([](int i) { return i * 3 + 1; }));
+            });
+        view("chunk|transform(sum)",
+            [](V &v) { return raw_sum(v, 0, v.size()); },
+            [](V &v) {
+                return sum(v | view::chunk(16) | view::transform(sum_fn{}));
+            });
+    }
+
+    // Materializing views into vectors. The raw loops are what one writes by
+    // hand without knowing the final size.
+    long long checksum(std::vector<int> const &v)
+    {
+        return raw_sum(v, 0, v.size()) + (long long)v.size();
+    }
+
+    void register_conversions()
+    {
+        using namespace ranges;
+        view("to_vector(filter)",
+            [](V &v) {
+                std::vector<int> r;
+                for(int i : v)
+                    if(is_odd(i))
+                        r.push_back(i);
+                return checksum(r);
+            },
+            [](V &v) { return checksum(v | view::filter(is_odd) | to_vector); });
+        view("to_vector(concat)",
+            [](V &v) {
+                std::vector<int> r;
+                r.insert(r.end(), v.begin(), v.end());
+                r.insert(r.end(), v.begin(), v.end());
+                return checksum(r);
+            },
+            [](V &v) { return checksum(view::concat(v, v) | to_vector); });
+        view("to_vector(join)",
+            [](V &v) {
+                std::vector<int> r;
+                for(std::size_t i = 0; i < v.size(); i += 16)
+                    r.insert(r.end(), v.begin() + i, v.begin() + std::min(i + 16, v.size()));
+                return checksum(r);
+            },
+            [](V &v) { return checksum(view::chunk(v, 16) | view::join | to_vector); });
+        view("assign_to(filter)",
+            [](V &v) {
+                static std::vector<int> r;
+                r.clear();
+                for(int i : v)
+                    if(is_odd(i))
+                        r.push_back(i);
+                return checksum(r);
+            },
+            [](V &v) {
+                static std::vector<int> r;
+                return checksum(v | view::filter(is_odd) | assign_to(r));
+            });
+    }
+}
+
+void register_view_benchmarks()
+{
+    register_simple_views();
+    register_element_views();
+    register_nested_views();
+    register_chains();
+    register_conversions();
+}
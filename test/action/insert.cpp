@@ -17,22 +17,6 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
-template<typename T>
-struct vector_like : std::vector<T> {
-    using std::vector<T>::vector;
-
-    using typename std::vector<T>::size_type;
-
-    size_type last_reservation{};
-    size_type reservation_count{};
-
-    void reserve(size_type n) {
-      std::vector<T>::reserve(n);
-      last_reservation = n;
-      ++reservation_count;
-    }
-};
-
 int main()
 {
     using namespace ranges;
@@ -78,5 +62,12 @@ int main()
     CHECK(vl.reservation_count == std::size_t{2});
     CHECK(vl.last_reservation == 3 * N);
 
+    // Many short ranges inserted in turn grow the container geometrically.
+    vector_like<int> vl2;
+    for(std::size_t k = 0; k != N; ++k)
+        insert(vl2, vl2.end(), view::iota(0, 3));
+    CHECK(vl2.size() == 3 * N);
+    CHECK(vl2.reservation_count <= std::size_t{16});
+
     return ::test_result();
 }
@@ -0,0 +1,54 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/action/join.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::vector<int>> vv = {{1,2}, {}, {3}, {4,5,6}};
+    std::vector<int> v = action::join(vv);
+    ::check_equal(v, {1,2,3,4,5,6});
+
+    std::vector<std::string> vs = {"this", "is", "his", "face"};
+    std::string s = std::move(vs) | action::join;
+    CHECK(s == "thisishisface");
+
+    // The total is reserved once; appending each inner range then fits in
+    // the room already made.
+    std::vector<vector_like<int>> vvl(100, vector_like<int>{1,2,3});
+    vector_like<int> vl = action::join(vvl);
+    CHECK(vl.size() == std::size_t{300});
+    CHECK(vl.reservation_count == std::size_t{1});
+    CHECK(vl.last_reservation == std::size_t{300});
+
+    // Inner ranges of unknown size are appended as they come.
+    auto rng = view::ints(1,5) | view::transform([](int i){
+        return view::ints(0,i) | view::for_each([](int j){return yield_if(j%2==0,j);});
+    });
+    std::vector<int> v2 = action::join(rng);
+    ::check_equal(v2, {0,0,0,2,0,2});
+
+    std::list<std::vector<int>> lv = {{1}, {2,3}};
+    std::vector<int> v3 = action::join(lv);
+    ::check_equal(v3, {1,2,3});
+
+    return ::test_result();
+}
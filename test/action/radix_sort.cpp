@@ -0,0 +1,55 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/action/shuffle.hpp>
+#include <range/v3/action/radix_sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    std::vector<int> v = view::ints(0,5000);
+    v |= action::shuffle(gen);
+    CHECK(!is_sorted(v));
+
+    auto v2 = v | copy | action::radix_sort;
+    CHECK(is_sorted(v2));
+    CHECK(!is_sorted(v));
+
+    v |= action::radix_sort;
+    CHECK(v == v2);
+
+    auto & v3 = action::radix_sort(v);
+    CHECK(&v3 == &v);
+
+    std::vector<std::pair<int, int>> ps;
+    for(int i = 0; i < 2000; ++i)
+        ps.emplace_back(i, i);
+    ps |= action::shuffle(gen);
+    ps = std::move(ps) | action::radix_sort(&std::pair<int, int>::second);
+    CHECK(is_sorted(ps));
+
+    v | view::stride(2) | action::radix_sort([](int i) { return -i; });
+    check_equal(view::take(v, 6), {4998,1,4996,3,4994,5});
+
+    return ::test_result();
+}
@@ -13,6 +13,7 @@
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/action/sort.hpp>
 #include <range/v3/action/remove_if.hpp>
+#include <range/v3/action/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -28,5 +29,18 @@ int main()
     auto && v3 = v | move | action::remove_if(std::bind(std::less<int>{}, std::placeholders::_1, 10));
     check_equal(v3, {11,13,15,17,19});
 
+    // action::remove_if | action::transform run as one pass: each element is
+    // tested once, and each one that is kept is transformed straight away.
+    std::vector<int> w = view::ints(1,21);
+    std::vector<int> calls;
+    w |= action::remove_if([&](int i){calls.push_back(i); return i % 3 != 0;}) |
+        action::transform([&](int i){calls.push_back(-i); return i * 10;});
+    check_equal(w, {30,60,90,120,150,180});
+    check_equal(calls, {1,2,3,-3,4,5,6,-6,7,8,9,-9,10,11,12,-12,13,14,15,-15,16,17,18,-18,
+        19,20});
+    w |= action::remove_if([](int i){return i > 100;}) |
+        action::transform([](int i){return -i;}) | action::sort;
+    check_equal(w, {-90,-60,-30});
+
     return ::test_result();
 }
@@ -21,6 +21,7 @@
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/action/shuffle.hpp>
 #include <range/v3/action/sort.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -65,5 +66,17 @@ int main()
     v | view::stride(2) | action::sort;
     check_equal(view::take(v, 10), {1,98,3,96,5,94,7,92,9,90});
 
+    // Sorting with an execution policy
+    std::vector<int> big = view::ints(0,100000);
+    big |= action::shuffle(gen);
+    big = std::move(big) | action::sort(execution::par);
+    CHECK(is_sorted(big));
+    big |= action::shuffle(gen);
+    big |= action::sort(execution::par, std::greater<int>());
+    CHECK(is_sorted(big, std::greater<int>()));
+    auto & big2 = action::sort(big, execution::seq);
+    CHECK(&big2 == &big);
+    CHECK(is_sorted(big));
+
     return ::test_result();
 }
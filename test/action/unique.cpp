@@ -14,12 +14,14 @@
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/take.hpp>
+#include <range/v3/view/reverse.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/is_sorted.hpp>
 #include <range/v3/action/shuffle.hpp>
 #include <range/v3/action/sort.hpp>
 #include <range/v3/action/unique.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -40,5 +42,31 @@ int main()
     v |= action::sort | action::unique;
     CHECK(equal(v, view::ints(1,100)));
 
+    std::vector<int> w =
+        view::for_each(view::ints(1,100), [](int i){
+            return yield_from(view::repeat_n(i,i));
+        });
+    w |= action::shuffle(gen);
+    w = std::move(w) | (action::sort(execution::par, std::greater<int>()) |
+        action::unique(std::equal_to<int>()));
+    CHECK(equal(w, view::ints(1,100) | view::reverse));
+    w |= action::sort | action::unique;
+    CHECK(equal(w, view::ints(1,100)));
+
+    // Large enough for the duplicates to be removed chunk by chunk on the
+    // thread pool, with runs that cross the chunks' bounds.
+    std::vector<int> x;
+    for(int i = 0; i < (1 << 16); ++i)
+        x.push_back(i % 1000);
+    x |= action::shuffle(gen);
+    x |= action::sort(execution::par) | action::unique;
+    CHECK(equal(x, view::ints(0,1000)));
+    // Runs longer than a chunk.
+    x.clear();
+    for(int i = 0; i < (1 << 16); ++i)
+        x.push_back(i / 20000);
+    x = std::move(x) | (action::sort(execution::par) | action::unique);
+    CHECK(equal(x, view::ints(0,4)));
+
     return ::test_result();
 }
@@ -9,10 +9,30 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <cstdint>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
 #include "../simple_test.hpp"
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v;
+        for(int i = 0; i < n; ++i)
+            v.push_back(T(i));
+        CHECK(ranges::adjacent_find(v) == v.end());
+        for(int i = n - 2; i >= 0; --i)
+        {
+            v[static_cast<std::size_t>(i)] = v[static_cast<std::size_t>(i) + 1];
+            CHECK((ranges::adjacent_find(v) - v.begin()) == i);
+            CHECK((ranges::adjacent_find(v.data(), v.data() + n) - v.data()) == i);
+        }
+    }
+}
+
 int main()
 {
     int v1[] = { 0, 2, 2, 4, 6 };
@@ -26,5 +46,10 @@ int main()
     static_assert(std::is_same<std::pair<int,int>*,
                                decltype(ranges::adjacent_find(v2, ranges::equal_to{},
                                     &std::pair<int, int>::second))>::value, "");
+    test_contiguous<std::uint8_t>();
+    test_contiguous<std::int16_t>();
+    test_contiguous<std::int32_t>();
+    test_contiguous<std::uint64_t>();
+
     return test_result();
 }
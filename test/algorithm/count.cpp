@@ -9,6 +9,8 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <cstdint>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include "../simple_test.hpp"
@@ -19,6 +21,27 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v;
+        int expected = 0;
+        for(int i = 0; i < n; ++i)
+        {
+            v.push_back(T(i % 3));
+            expected += i % 3 == 1;
+        }
+        CHECK(ranges::count(v, T(1)) == expected);
+        CHECK(ranges::count(v.data(), v.data() + n, 1) == expected);
+        CHECK(ranges::count(v, T(5)) == 0);
+    }
+    std::vector<T> v(40, T(0));
+    CHECK(ranges::count(v, 0x10000000000LL) == 0);
+    CHECK(ranges::count(v, 0LL) == 40);
+}
+
 int main()
 {
     using namespace ranges;
@@ -57,5 +80,10 @@ int main()
     CHECK(count(make_range(input_iterator<const S*>(sa),
                       sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    test_contiguous<std::uint8_t>();
+    test_contiguous<std::int16_t>();
+    test_contiguous<std::int32_t>();
+    test_contiguous<std::int64_t>();
+
     return ::test_result();
 }
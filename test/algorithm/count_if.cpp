@@ -9,8 +9,10 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -74,5 +76,16 @@ int main()
     CHECK(count_if(make_range(input_iterator<T*>(ta),
                          sentinel<T*>(ta + size(ta))), &T::b) == 4);
 
+    // Parallel
+    {
+        std::vector<S> v(100001);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i].i = (int)(i % 4);
+        CHECK(count_if(execution::par, v, equals(2), &S::i) == 25000);
+        CHECK(count_if(execution::par_unseq, v.begin(), v.end(), equals(0), &S::i) == 25001);
+        CHECK(count_if(execution::seq, v, equals(7), &S::i) == 0);
+        CHECK(count_if(execution::par, ia, equals(2)) == 3);
+    }
+
     return ::test_result();
 }
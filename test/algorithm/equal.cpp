@@ -18,6 +18,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cstdint>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -269,6 +271,27 @@ void test_rng_pred()
                   std::equal_to<int>()));
 }
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 70; ++n)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n), T(9)), b = a;
+        CHECK(ranges::equal(a, b));
+        CHECK(ranges::equal(a.begin(), a.end(), b.begin()));
+        for(int i = 0; i < n; ++i)
+        {
+            b[static_cast<std::size_t>(i)] = T(1);
+            CHECK(!ranges::equal(a, b));
+            CHECK(!ranges::equal(a.begin(), a.end(), b.begin(), b.end()));
+            b[static_cast<std::size_t>(i)] = T(9);
+        }
+        b.push_back(T(9));
+        CHECK(!ranges::equal(a, b));
+        CHECK(ranges::equal(a.begin(), a.end(), b.begin()));
+    }
+}
+
 int main()
 {
     ::test();
@@ -281,5 +304,10 @@ int main()
     static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, {1, 2, 3, 4}))>::value, "");
     static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, ranges::view::unbounded(p)))>::value, "");
 
+    test_contiguous<std::uint8_t>();
+    test_contiguous<std::int16_t>();
+    test_contiguous<std::uint32_t>();
+    test_contiguous<std::int64_t>();
+
     return ::test_result();
 }
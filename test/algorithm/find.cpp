@@ -19,6 +19,8 @@
 //===----------------------------------------------------------------------===//
 
 #include <utility>
+#include <cstdint>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find.hpp>
 #include "../simple_test.hpp"
@@ -29,6 +31,29 @@ struct S
     int i_;
 };
 
+// Contiguous ranges of integers are searched a block at a time; the match
+// must be found wherever it falls in or after a block.
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v(static_cast<std::size_t>(n), T(7));
+        CHECK(ranges::find(v, T(3)) == v.end());
+        for(int i = n - 1; i >= 0; --i)
+        {
+            v[static_cast<std::size_t>(i)] = T(3);
+            CHECK((ranges::find(v, T(3)) - v.begin()) == i);
+            CHECK((ranges::find(v.data(), v.data() + n, 3) - v.data()) == i);
+        }
+    }
+    // A value the element type can't represent matches nothing, even if it
+    // has the same low-order bits as an element.
+    std::vector<T> v(40, T(0));
+    CHECK(ranges::find(v, 0x10000000000LL) == v.end());
+    CHECK(ranges::find(v, 0LL) == v.begin());
+}
+
 int main()
 {
     using namespace ranges;
@@ -65,5 +90,16 @@ int main()
     ps = find(sa, 10, &S::i_);
     CHECK(ps == end(sa));
 
+    test_contiguous<std::uint8_t>();
+    test_contiguous<char>();
+    test_contiguous<std::int16_t>();
+    test_contiguous<std::int32_t>();
+    test_contiguous<std::int64_t>();
+    {
+        std::vector<signed char> v(50, -1);
+        CHECK(find(v, 255) == v.end());
+        CHECK(find(v, -1) == v.begin());
+    }
+
     return ::test_result();
 }
@@ -19,8 +19,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <utility>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -69,5 +71,19 @@ int main()
     ps = find_if(sa, [](int i){return i == 10;}, &S::i_);
     CHECK(ps == end(sa));
 
+    // Parallel
+    {
+        std::vector<S> v(100000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i].i_ = (int)(i % 50000);
+        auto it = find_if(execution::par, v, [](int i){return i == 40000;}, &S::i_);
+        CHECK((it - v.begin()) == 40000);
+        it = find_if(execution::par, v.begin(), v.end(), [](int i){return i < 0;}, &S::i_);
+        CHECK(it == v.end());
+        it = find_if(execution::seq, v, [](int i){return i == 3;}, &S::i_);
+        CHECK((it - v.begin()) == 3);
+        CHECK(find_if(execution::par, sa, [](int i){return i == 3;}, &S::i_)->i_ == 3);
+    }
+
     return ::test_result();
 }
@@ -9,9 +9,11 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <atomic>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 
 struct S
@@ -46,5 +48,19 @@ int main()
     CHECK(ranges::for_each(ranges::make_range(v1.begin(), v1.end()), fun).get_unsafe() == v1.end());
     CHECK(sum == 12);
 
+    // Parallel
+    {
+        std::vector<int> v(100000, 1);
+        CHECK(ranges::for_each(ranges::execution::par, v, [](int &i){ i *= 2; }) == v.end());
+        std::atomic<long> total{0};
+        CHECK(ranges::for_each(ranges::execution::par, v.begin(), v.end(),
+            [&](int i){ total += i; }) == v.end());
+        CHECK(total == 200000);
+
+        sum = 0;
+        CHECK(ranges::for_each(ranges::execution::seq, v2, &S::p) == v2.end());
+        CHECK(sum == 12);
+    }
+
     return ::test_result();
 }
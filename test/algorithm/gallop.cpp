@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/aux_/gallop.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace { std::mt19937 gen; }
+
+using P = std::pair<int, int>;
+
+// A sorted run of n elements with keys in [0, keys], tagged with `tag`.
+std::vector<P> random_run(int n, int keys, int tag)
+{
+    std::vector<P> v;
+    for(int i = 0; i < n; ++i)
+        v.emplace_back(std::uniform_int_distribution<int>{0, keys}(gen), tag);
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+bool key_less(P const &a, P const &b)
+{
+    return a.first < b.first;
+}
+
+// includes, set_intersection and set_difference gallop over runs of
+// random-access inputs that they skip; compare them with the standard ones,
+// which don't, on inputs of very different lengths, where galloping pays, and
+// of equal ones, where they don't gallop.
+void test_against_std(int n1, int n2, int keys)
+{
+    auto const a = random_run(n1, keys, 1);
+    auto const b = random_run(n2, keys, 2);
+    std::vector<P> out(a.size() + b.size()), expected(a.size() + b.size());
+    auto const less = std::less<int>{};
+    auto const key = &P::first;
+
+    {
+        CHECK(ranges::includes(a, b, less, key, key) ==
+            std::includes(a.begin(), a.end(), b.begin(), b.end(), key_less));
+        CHECK(ranges::includes(b, a, less, key, key) ==
+            std::includes(b.begin(), b.end(), a.begin(), a.end(), key_less));
+        // Every element of a sorted range is matched in the range plus more.
+        std::vector<P> ab(a.size() + b.size());
+        std::merge(a.begin(), a.end(), b.begin(), b.end(), ab.begin(), key_less);
+        CHECK(ranges::includes(ab, a, less, key, key));
+        CHECK(ranges::includes(ab, b, less, key, key));
+    }
+    {
+        auto res = ranges::set_intersection(a, b, out.begin(), less, key, key);
+        auto e = std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+            expected.begin(), key_less);
+        CHECK((res - out.begin()) == (e - expected.begin()));
+        CHECK(std::equal(out.begin(), res, expected.begin()));
+    }
+    {
+        auto res = ranges::set_difference(a, b, out.begin(), less, key, key);
+        auto e = std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+            expected.begin(), key_less);
+        CHECK(res.in1() == a.end());
+        CHECK((res.out() - out.begin()) == (e - expected.begin()));
+        CHECK(std::equal(out.begin(), res.out(), expected.begin()));
+    }
+}
+
+int main()
+{
+    // The exponential searches agree with the binary ones from every start.
+    {
+        int const a[] = {0, 1, 1, 2, 3, 3, 3, 5, 8, 8, 9, 13, 13, 13, 13, 21};
+        int const n = 16;
+        for(int d = 0; d <= n; ++d)
+        {
+            for(int v = -1; v <= 22; ++v)
+            {
+                CHECK(ranges::aux::gallop_lower_bound_n(a, d, v) ==
+                    std::lower_bound(a, a + d, v));
+                CHECK(ranges::aux::gallop_upper_bound_n(a, d, v) ==
+                    std::upper_bound(a, a + d, v));
+            }
+        }
+    }
+
+    for(int keys : {5, 100000})
+    {
+        test_against_std(0, 1000, keys);
+        test_against_std(1000, 0, keys);
+        test_against_std(3, 10000, keys);
+        test_against_std(10000, 3, keys);
+        test_against_std(40, 20000, keys);
+        test_against_std(20000, 40, keys);
+        test_against_std(5000, 5000, keys);
+    }
+
+    return ::test_result();
+}
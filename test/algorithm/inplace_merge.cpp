@@ -21,6 +21,7 @@
 #include <cassert>
 #include <algorithm>
 #include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
 #include "../simple_test.hpp"
@@ -133,5 +134,24 @@ int main()
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    // Caller-owned buffers, reused across calls and of every size
+    {
+        CHECK(ranges::inplace_merge_fn::buffer_size(3, 5) == 3);
+        ranges::scratch_buffer<int> buf;
+        for(std::ptrdiff_t cap : {0, 10, 500})
+        {
+            buf.reserve(cap);
+            for(int k = 0; k < 2; ++k)
+            {
+                std::vector<int> v(1000);
+                for(int i = 0; i < 1000; ++i)
+                    v[i] = i < 400 ? 2 * i : 2 * (i - 400) + 1;
+                CHECK(ranges::inplace_merge(v, v.begin() + 400, buf) == v.end());
+                for(int i = 0; i < 1000; ++i)
+                    CHECK(v[i] == (i < 800 ? i : 2 * i - 799));
+            }
+        }
+    }
+
     return ::test_result();
 }
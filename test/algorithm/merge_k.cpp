@@ -0,0 +1,85 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+namespace { std::mt19937 gen; }
+
+// k sorted runs of random lengths, each element tagged with the run it is in.
+std::vector<std::vector<std::pair<int, int>>> random_runs(int k, int max_len, int keys)
+{
+    std::vector<std::vector<std::pair<int, int>>> runs(static_cast<std::size_t>(k));
+    for(int r = 0; r < k; ++r)
+    {
+        int const len = std::uniform_int_distribution<int>{0, max_len}(gen);
+        for(int i = 0; i < len; ++i)
+            runs[static_cast<std::size_t>(r)].emplace_back(
+                std::uniform_int_distribution<int>{0, keys}(gen), r);
+        std::sort(runs[static_cast<std::size_t>(r)].begin(),
+            runs[static_cast<std::size_t>(r)].end());
+    }
+    return runs;
+}
+
+int main()
+{
+    using P = std::pair<int, int>;
+
+    // Against a stable sort of all the elements by key: equal keys come out
+    // in the order of their runs.
+    for(int k : {0, 1, 2, 3, 8, 33})
+    {
+        for(int keys : {3, 1000})
+        {
+            auto runs = random_runs(k, 200, keys);
+            std::vector<P> expected;
+            for(auto const &run : runs)
+                expected.insert(expected.end(), run.begin(), run.end());
+            std::stable_sort(expected.begin(), expected.end(),
+                [](P const &a, P const &b) { return a.first < b.first; });
+
+            std::vector<P> out(expected.size());
+            auto res = ranges::merge_k(runs, out.begin(), std::less<int>{}, &P::first);
+            CHECK(res == out.end());
+            CHECK(out == expected);
+        }
+    }
+
+    // Empty runs, and runs of a single element.
+    {
+        std::vector<std::vector<int>> runs{{}, {4}, {}, {1, 5}, {}, {4}};
+        int out[4] = {0};
+        CHECK(ranges::merge_k(runs, out) == out + 4);
+        check_equal(out, {1, 4, 4, 5});
+    }
+
+    // Descending runs with a descending order, through a const range and an
+    // output iterator archetype.
+    {
+        std::vector<std::vector<int>> const runs{{9, 5, 1}, {8, 7, 2}, {6, 3}};
+        int out[8] = {0};
+        auto res = ranges::merge_k(runs, output_iterator<int *>(out), std::greater<int>{});
+        CHECK(base(res) == out + 8);
+        check_equal(out, {9, 8, 7, 6, 5, 3, 2, 1});
+    }
+
+    return ::test_result();
+}
@@ -20,6 +20,8 @@
 
 #include <memory>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
 #include "../simple_test.hpp"
@@ -97,6 +99,30 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n < 80; ++n)
+    {
+        std::vector<T> a(static_cast<std::size_t>(n), T(-2)), b = a;
+        CHECK(ranges::mismatch(a, b).in1() == a.end());
+        for(int i = n - 1; i >= 0; --i)
+        {
+            b[static_cast<std::size_t>(i)] = T(5);
+            auto r = ranges::mismatch(a, b);
+            CHECK((r.in1() - a.begin()) == i);
+            CHECK((r.in2() - b.begin()) == i);
+            CHECK((ranges::mismatch(a.begin(), a.end(), b.begin()).in1() - a.begin()) == i);
+        }
+        // Only the common prefix of ranges of different lengths is compared.
+        std::vector<T> c = a;
+        c.resize(c.size() / 2);
+        auto r = ranges::mismatch(a, c);
+        CHECK(r.in1() == a.begin() + static_cast<std::ptrdiff_t>(c.size()));
+        CHECK(r.in2() == c.end());
+    }
+}
+
 int main()
 {
     test_iter<input_iterator<const int*>>();
@@ -133,5 +159,10 @@ int main()
     CHECK(ps2.first->i == -4);
     CHECK(ps2.second->i == 5);
 
+    test_contiguous<std::uint8_t>();
+    test_contiguous<std::int16_t>();
+    test_contiguous<std::int32_t>();
+    test_contiguous<std::int64_t>();
+
     return test_result();
 }
@@ -0,0 +1,162 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace { std::mt19937 gen; }
+
+struct S
+{
+    std::string name;
+    float weight;
+    std::uint16_t group;
+};
+
+struct by_group_then_weight
+{
+    std::tuple<std::uint16_t const &, float const &> operator()(S const &s) const
+    {
+        return std::tuple<std::uint16_t const &, float const &>{s.group, s.weight};
+    }
+};
+
+template<typename T, typename Dist>
+void test_keys(std::size_t n, Dist dist)
+{
+    std::vector<T> v(n);
+    for(auto &t : v)
+        t = static_cast<T>(dist(gen));
+    auto w = v;
+    ranges::sort(w);
+    CHECK(ranges::radix_sort(v) == v.end());
+    CHECK(v == w);
+}
+
+int main()
+{
+    using namespace ranges;
+
+    CONCEPT_ASSERT(RadixSortable<int *>());
+    CONCEPT_ASSERT(RadixSortable<double *>());
+    CONCEPT_ASSERT(RadixSortable<S *, float S::*>());
+    CONCEPT_ASSERT(RadixSortable<S *, by_group_then_weight>());
+    CONCEPT_ASSERT(!RadixSortable<std::string *>());
+    CONCEPT_ASSERT(!RadixSortable<S *>());
+    CONCEPT_ASSERT(!RadixSortable<long double *>());
+
+    // Empty and short ranges
+    {
+        std::vector<int> v;
+        CHECK(radix_sort(v) == v.end());
+        v = {3, -1, 2};
+        radix_sort(v);
+        ::check_equal(v, {-1, 2, 3});
+    }
+
+    for(std::size_t n : {1000u, 1024u, 5000u, 100000u})
+    {
+        test_keys<std::uint8_t>(n, std::uniform_int_distribution<int>{0, 255});
+        test_keys<std::uint32_t>(n, std::uniform_int_distribution<std::uint32_t>{});
+        test_keys<std::int64_t>(n, std::uniform_int_distribution<std::int64_t>{});
+        test_keys<short>(n, std::uniform_int_distribution<int>{-30000, 30000});
+        test_keys<int>(n, std::uniform_int_distribution<int>{-5, 5});
+        test_keys<float>(n, std::normal_distribution<float>{0.f, 1000.f});
+        test_keys<double>(n, std::uniform_real_distribution<double>{-1e300, 1e300});
+    }
+
+    // Already sorted and reversed input, and keys that share their high bytes
+    {
+        std::vector<std::uint64_t> v(4000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = 0xabcd000000000000ull + i;
+        radix_sort(v);
+        CHECK(is_sorted(v));
+        radix_sort(v | view::reverse);
+        CHECK(is_sorted(v | view::reverse));
+    }
+
+    // Projections onto a member, and onto a tuple of references to members;
+    // the values aren't trivially copyable
+    {
+        std::vector<S> v(3000);
+        std::uniform_int_distribution<int> g{0, 9};
+        std::uniform_real_distribution<float> f{-10.f, 10.f};
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = S{std::to_string(i), f(gen), static_cast<std::uint16_t>(g(gen))};
+        radix_sort(v, &S::weight);
+        CHECK(is_sorted(v, ordered_less{}, &S::weight));
+        CHECK(v.front().name.size() != 0u);
+
+        radix_sort(v, by_group_then_weight{});
+        CHECK(is_sorted(v, ordered_less{}, by_group_then_weight{}));
+        int names = 0;
+        for(auto const &s : v)
+            names += !s.name.empty();
+        CHECK(names == 3000);
+    }
+
+    // Pairs of keys
+    {
+        std::vector<std::pair<int, unsigned>> v(2000);
+        std::uniform_int_distribution<int> g{-3, 3};
+        for(auto &p : v)
+            p = {g(gen), static_cast<unsigned>(gen())};
+        auto w = v;
+        ranges::sort(w);
+        radix_sort(v);
+        CHECK(v == w);
+    }
+
+    // Signed zeros and infinities
+    {
+        std::vector<double> v(2000, 0.0);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = i % 4 == 0 ? -0.0 : i % 4 == 1 ? 1.0 / 0.0 : i % 4 == 2 ? -1.0 / 0.0 : -2.5;
+        radix_sort(v);
+        CHECK(is_sorted(v));
+        CHECK(v.front() == -1.0 / 0.0);
+        CHECK(v.back() == 1.0 / 0.0);
+    }
+
+    // Short and long ranges put signed zeros and NaNs in the same total order
+    for(std::size_t n : {12u, 2400u})
+    {
+        double const nan = std::numeric_limits<double>::quiet_NaN();
+        double const keys[] = {0.0, nan, -1.0, -nan, -0.0, 1.0};
+        std::vector<double> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = keys[i % 6];
+        radix_sort(v);
+        auto rank = [](double d)
+        {
+            return std::isnan(d) ? (std::signbit(d) ? 0 : 5) :
+                d == 0.0 ? (std::signbit(d) ? 2 : 3) : d < 0.0 ? 1 : 4;
+        };
+        for(std::size_t i = 0; i < n; ++i)
+            CHECK(rank(v[i]) == int(i / (n / 6)));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,117 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <list>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/algorithm/sample.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/view/iota.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    // Selection sampling keeps the input's order.
+    {
+        std::vector<int> v = view::ints(0, 1000);
+        std::vector<int> out(100);
+        auto res = sample(v, out.begin(), 100, gen);
+        CHECK(res.in() == v.end());
+        CHECK(res.out() == out.end());
+        CHECK(is_sorted(out));
+        CHECK(unique(out) == out.end());
+        CHECK(all_of(out, [](int i){return 0 <= i && i < 1000;}));
+
+        // Forward iterators are counted first.
+        int ia[10] = {0,1,2,3,4,5,6,7,8,9};
+        int ib[4] = {};
+        auto res2 = sample(forward_iterator<int*>(ia), sentinel<int*>(ia + 10), ib, 4, gen);
+        CHECK(res2.in().base() == ia + 10);
+        CHECK(res2.out() == ib + 4);
+        CHECK(is_sorted(ib));
+
+        // Fewer elements than asked for: all of them.
+        std::vector<int> all(20, -1);
+        auto res3 = sample(ia, all.begin(), 20, gen);
+        CHECK(res3.out() == all.begin() + 10);
+        ::check_equal(make_range(all.begin(), res3.out()), {0,1,2,3,4,5,6,7,8,9});
+
+        // To an output iterator.
+        std::list<int> l(v.begin(), v.end());
+        std::vector<int> out2;
+        sample(l, ranges::back_inserter(out2), 10, gen);
+        CHECK(out2.size() == 10u);
+        CHECK(is_sorted(out2));
+    }
+
+    // Reservoir sampling for input ranges of unknown length.
+    {
+        std::stringstream sin;
+        for(int i = 0; i != 1000; ++i)
+            sin << i << ' ';
+        std::vector<int> out(50);
+        auto res = sample(istream<int>(sin), out.begin(), 50, gen);
+        CHECK(res.out() == out.end());
+        sort(out);
+        CHECK(unique(out) == out.end());
+        CHECK(all_of(out, [](int i){return 0 <= i && i < 1000;}));
+
+        std::stringstream sin2("1 2 3");
+        auto res2 = sample(istream<int>(sin2), out.begin(), 50, gen);
+        CHECK(res2.out() == out.begin() + 3);
+        ::check_equal(make_range(out.begin(), res2.out()), {1,2,3});
+
+        // A sample of none still walks the input.
+        std::stringstream sin3("1 2 3");
+        auto rng3 = istream<int>(sin3);
+        auto res3 = sample(rng3, out.begin(), 0, gen);
+        CHECK(res3.in() == end(rng3));
+        CHECK(res3.out() == out.begin());
+    }
+
+    // Every element is as likely to be picked, both ways.
+    {
+        int counts[2][10] = {};
+        for(int t = 0; t != 2000; ++t)
+        {
+            int ia[10] = {0,1,2,3,4,5,6,7,8,9};
+            int ib[3];
+            sample(ia, ib, 3, gen);
+            for(int i : ib)
+                ++counts[0][i];
+            std::stringstream sin("0 1 2 3 4 5 6 7 8 9");
+            sample(istream<int>(sin), ib, 3, gen);
+            for(int i : ib)
+                ++counts[1][i];
+        }
+        for(auto &c : counts)
+            for(int n : c)
+            {
+                // 600 expected, with a standard deviation of about 20.
+                CHECK(n > 500);
+                CHECK(n < 700);
+            }
+    }
+
+    return ::test_result();
+}
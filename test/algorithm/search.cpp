@@ -22,6 +22,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/search.hpp>
 #include <range/v3/view/counted.hpp>
@@ -147,6 +151,41 @@ test()
     test_range<Iter1, Iter2>();
 }
 
+// Checks the skip-table paths and the explicit searchers against std::search
+// on short-alphabet inputs, where partial matches are frequent.
+template<typename V>
+void test_searchers(std::size_t text_size, std::size_t max_pattern)
+{
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(text_size));
+    for(int iter = 0; iter < 200; ++iter)
+    {
+        int const alpha = 1 + iter % 4;
+        std::vector<V> text(text_size), pat(1 + gen() % max_pattern);
+        for(auto &v : text) v = static_cast<V>('a' + gen() % alpha);
+        for(auto &v : pat) v = static_cast<V>('a' + gen() % alpha);
+        if(iter % 2 && pat.size() <= text.size())
+        {
+            auto const at = gen() % (text.size() - pat.size() + 1);
+            std::copy(pat.begin(), pat.end(), text.begin() + static_cast<std::ptrdiff_t>(at));
+        }
+        auto const expected = std::search(text.begin(), text.end(), pat.begin(), pat.end());
+        auto const n = expected == text.end() ? 0 : pat.size();
+
+        CHECK(ranges::search(text, pat) == expected);
+        auto const bmh = ranges::make_boyer_moore_horspool_searcher(pat);
+        auto const bm = ranges::make_boyer_moore_searcher(pat);
+        auto const tw = ranges::make_two_way_searcher(pat);
+        auto const df = ranges::make_default_searcher(pat);
+        CHECK(ranges::search(text, bmh) == expected);
+        CHECK(ranges::search(text, bm) == expected);
+        CHECK(ranges::search(text, tw) == expected);
+        CHECK(ranges::search(text, df) == expected);
+        auto const r = bm(text.begin(), text.end());
+        CHECK(r.first == expected);
+        CHECK(static_cast<std::size_t>(r.second - r.first) == n);
+    }
+}
+
 struct S
 {
     int i;
@@ -206,5 +245,23 @@ int main()
         CHECK(ranges::search(ranges::view::all(ib), ie).get_unsafe() == ib+4);
     }
 
+    // Test the skip-table and searcher paths
+    test_searchers<char>(100, 6);
+    test_searchers<char>(1000, 40);
+    test_searchers<int>(5000, 12);
+    {
+        std::string const text = "here is a simple example";
+        auto it = ranges::search(text, ranges::make_two_way_searcher(std::string("example")));
+        CHECK((it - text.begin()) == 17);
+        auto bm = ranges::make_boyer_moore_searcher(std::string("ample"));
+        CHECK(bm.size() == 5);
+        auto r = bm(text.begin(), text.end());
+        CHECK((r.first - text.begin()) == 19);
+        CHECK((r.second - text.begin()) == 24);
+        auto empty = ranges::make_boyer_moore_horspool_searcher(std::string());
+        r = empty(text.begin(), text.end());
+        CHECK((r.first == text.begin() && r.second == text.begin()));
+    }
+
     return ::test_result();
 }
@@ -23,10 +23,14 @@
 //===----------------------------------------------------------------------===//
 
 #include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/numeric/iota.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -68,5 +72,93 @@ int main()
         CHECK(!ranges::equal(ia, orig));
     }
 
+    // With seq, or a range of one block, a policy changes nothing.
+    {
+        int ia[100], ib[100], ic[100];
+        ranges::iota(ia, 0);
+        ranges::iota(ib, 0);
+        ranges::iota(ic, 0);
+        std::minstd_rand ga, gb, gc;
+        ranges::shuffle(ia, ga);
+        ranges::shuffle(ranges::execution::seq, ib, gb);
+        ranges::shuffle(ranges::execution::par, ic, gc);
+        CHECK(ranges::equal(ia, ib));
+        CHECK(ranges::equal(ia, ic));
+        CHECK(ga == gb);
+        CHECK(ga == gc);
+    }
+
+    // With a parallel policy, large ranges are shuffled by MergeShuffle.
+    {
+        std::vector<int> v(1 << 20), orig(1 << 20);
+        ranges::iota(v, 0);
+        ranges::iota(orig, 0);
+        std::minstd_rand g;
+        CHECK(ranges::shuffle(ranges::execution::par, v, g) == v.end());
+        CHECK(!ranges::equal(v, orig));
+        ranges::sort(v);
+        CHECK(ranges::equal(v, orig));
+
+        int ia[100];
+        ranges::iota(ia, 0);
+        CHECK(ranges::shuffle(ranges::execution::par, ia, ia + 100, g) == ia + 100);
+        CHECK(!ranges::equal(ia, ranges::make_range(orig.begin(), orig.begin() + 100)));
+    }
+
+    // MergeShuffle with blocks of one element, so that every step is a
+    // merge: each of the 120 orders of 5 elements is about as likely.
+    {
+        std::minstd_rand g;
+        std::vector<int> counts(5 * 5 * 5 * 5 * 5);
+        int const trials = 60000;
+        for(int t = 0; t != trials; ++t)
+        {
+            int a[5] = {0, 1, 2, 3, 4};
+            ranges::detail::merge_shuffle(a, a + 5, g, 1);
+            int code = 0;
+            for(int i : a)
+                code = code * 5 + i;
+            ++counts[static_cast<std::size_t>(code)];
+        }
+        double const expected = trials / 120.0;
+        double chi2 = 0;
+        int orders = 0;
+        for(int c : counts)
+        {
+            if(c == 0)
+                continue;
+            ++orders;
+            chi2 += (c - expected) * (c - expected) / expected;
+        }
+        CHECK(orders == 120);
+        CHECK(chi2 < 200); // 119 degrees of freedom
+    }
+
+    // Runs long enough for the merge to take its coin flips a word at a
+    // time: the first and last elements are about as likely to end up
+    // anywhere.
+    {
+        std::minstd_rand g;
+        std::vector<int> first(256), last(256), v(256);
+        int const trials = 25600;
+        for(int t = 0; t != trials; ++t)
+        {
+            ranges::iota(v, 0);
+            ranges::detail::merge_shuffle(v.begin(), v.end(), g, 64);
+            ++first[static_cast<std::size_t>(ranges::find(v, 0) - v.begin())];
+            ++last[static_cast<std::size_t>(ranges::find(v, 255) - v.begin())];
+        }
+        double chi2_first = 0, chi2_last = 0;
+        for(int i = 0; i != 256; ++i)
+        {
+            chi2_first += (first[static_cast<std::size_t>(i)] - 100.0) *
+                (first[static_cast<std::size_t>(i)] - 100.0) / 100.0;
+            chi2_last += (last[static_cast<std::size_t>(i)] - 100.0) *
+                (last[static_cast<std::size_t>(i)] - 100.0) / 100.0;
+        }
+        CHECK(chi2_first < 400); // 255 degrees of freedom
+        CHECK(chi2_last < 400);
+    }
+
     return ::test_result();
 }
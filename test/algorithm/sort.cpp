@@ -26,6 +26,9 @@
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/repeat_n.hpp>
@@ -33,6 +36,7 @@
 #include <range/v3/view/zip.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/to_container.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -322,5 +326,100 @@ int main()
         sort(rng);
     }
 
+    // Check the patterns the sort recognizes: sorted runs, many equal keys,
+    // and inputs that make quicksort partition badly
+    {
+        std::vector<int> v(100000);
+        std::uniform_int_distribution<int> dist(0, 1000000);
+        for(int &i : v)
+            i = dist(gen);
+        std::vector<int> w = v;
+        std::sort(w.begin(), w.end());
+        ranges::sort(v);
+        CHECK(v == w);
+        for(std::size_t i = 0; i < v.size(); i += 997)
+            v[i] = dist(gen);
+        ranges::sort(v);
+        CHECK(ranges::is_sorted(v));
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = (int)(i < v.size() / 2 ? i : v.size() - i);
+        ranges::sort(v);
+        CHECK(ranges::is_sorted(v));
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = (int)(i % 2 == 0 ? i : v.size() - i);
+        ranges::sort(v, std::greater<int>{});
+        CHECK(ranges::is_sorted(v, std::greater<int>{}));
+        std::uniform_int_distribution<int> few(0, 3);
+        std::ptrdiff_t counts[4] = {};
+        for(int &i : v)
+            ++counts[i = few(gen)];
+        ranges::sort(v);
+        // Each value's run has as many elements as the input had.
+        auto it = v.begin();
+        for(int k = 0; k != 4; ++k)
+        {
+            CHECK(ranges::count(it, it + counts[k], k) == counts[k]);
+            it += counts[k];
+        }
+        CHECK(it == v.end());
+
+        std::vector<double> d(50000);
+        for(std::size_t i = 0; i < d.size(); ++i)
+            d[i] = (double)((i * 7919u) % 50000u) / 7.0;
+        ranges::sort(d);
+        CHECK(ranges::is_sorted(d));
+
+        std::vector<S> ss(50000, S{});
+        for(int i = 0; (std::size_t)i < ss.size(); ++i)
+            ss[i] = S{(i * 7919) % 1000, i};
+        ranges::sort(ss, ranges::ordered_less{}, &S::i);
+        CHECK(ranges::is_sorted(ss, ranges::ordered_less{}, &S::i));
+    }
+
+    // Check parallel sort, including the many-duplicates and adversarial cases
+    {
+        std::vector<int> v(1 << 18);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = (int)((i * 2654435761u) % 100003u);
+        auto w = v;
+        std::sort(w.begin(), w.end());
+        CHECK(ranges::sort(ranges::execution::par, v) == v.end());
+        CHECK(v == w);
+
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = (int)(i % 7);
+        ranges::sort(ranges::execution::par_unseq, v.begin(), v.end(), std::greater<int>{});
+        CHECK(ranges::is_sorted(v, std::greater<int>{}));
+
+        ranges::fill(v, 42);
+        ranges::sort(ranges::execution::par, v);
+        CHECK(ranges::count(v, 42) == (std::ptrdiff_t)v.size());
+
+        ranges::sort(ranges::execution::seq, v);
+        CHECK(ranges::is_sorted(v));
+    }
+    {
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = v.size() - i - 1;
+            v[i].j = i;
+        }
+        ranges::sort(ranges::execution::par, v, std::less<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i].i == i);
+            CHECK((std::size_t)v[i].j == v.size() - i - 1);
+        }
+    }
+    {
+        std::vector<std::unique_ptr<int> > v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i].reset(new int(v.size() - i - 1));
+        ranges::sort(ranges::execution::par, v, indirect_less());
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(*v[i] == i);
+    }
+
     return ::test_result();
 }
@@ -432,5 +432,40 @@ int main()
         CHECK(ap[9].p == P{4, 2});
     }
 
+    // Test caller-owned buffers, reused across calls and of every size
+    {
+        CHECK(ranges::stable_partition_fn::buffer_size(10) == 10);
+        ranges::scratch_buffer<S> buf;
+        for(std::ptrdiff_t cap : {0, 2, 10})
+        {
+            buf.reserve(cap);
+            for(int k = 0; k < 2; ++k)
+            {
+                S ap[] = { {{0, 1}}, {{0, 2}}, {{1, 1}}, {{1, 2}}, {{2, 1}}, {{2, 2}}, {{3, 1}}, {{3, 2}}, {{4, 1}}, {{4, 2}} };
+                S* r = ranges::stable_partition(ap, buf, odd_first(), &S::p);
+                CHECK(r == ap + 4);
+                CHECK(ap[0].p == P{1, 1});
+                CHECK(ap[1].p == P{1, 2});
+                CHECK(ap[2].p == P{3, 1});
+                CHECK(ap[3].p == P{3, 2});
+                CHECK(ap[4].p == P{0, 1});
+                CHECK(ap[5].p == P{0, 2});
+                CHECK(ap[6].p == P{2, 1});
+                CHECK(ap[7].p == P{2, 2});
+                CHECK(ap[8].p == P{4, 1});
+                CHECK(ap[9].p == P{4, 2});
+            }
+        }
+
+        ranges::scratch_buffer<move_only> mbuf{5};
+        move_only array[] = { 1, 2, 3, 4, 5 };
+        auto fi = forward_iterator<move_only*>(array);
+        CHECK(base(ranges::stable_partition(fi, forward_iterator<move_only*>(array + 5), mbuf,
+            is_odd{}, &move_only::i)) == array + 3);
+        CHECK(array[2].i == 5);
+        CHECK(array[3].i == 2);
+        CHECK(move_only::count == 5);
+    }
+
     return ::test_result();
 }
@@ -23,8 +23,11 @@
 #include <random>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/sort_n_with_buffer.hpp>
+#include <range/v3/algorithm/merge_n_with_buffer.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -231,5 +234,110 @@ int main()
         }
     }
 
+    // Check caller-owned buffers, reused across calls and of every size
+    {
+        ranges::scratch_buffer<S> buf;
+        for(std::ptrdiff_t cap : {std::ptrdiff_t(0), std::ptrdiff_t(7),
+            ranges::stable_sort_fn::buffer_size(1000)})
+        {
+            buf.reserve(cap);
+            for(int k = 0; k < 2; ++k)
+            {
+                std::vector<S> v(1000, S{});
+                for(int i = 0; (std::size_t)i < v.size(); ++i)
+                {
+                    v[i].i = (v.size() - i - 1) / 3;
+                    v[i].j = i;
+                }
+                CHECK(ranges::stable_sort(v, buf, std::less<int>{}, &S::i) == v.end());
+                for(int i = 1; (std::size_t)i < v.size(); ++i)
+                {
+                    CHECK(v[i - 1].i <= v[i].i);
+                    if(v[i - 1].i == v[i].i)
+                        CHECK(v[i - 1].j < v[i].j);
+                }
+            }
+        }
+        CHECK(buf.capacity() == 500);
+    }
+
+    // Check the natural merge sort against std::stable_sort, on random
+    // input, on sorted shards of every kind of overlap, and on descending
+    // runs, with equal keys to show that it is stable
+    {
+        auto check_natural = [](std::vector<S> v)
+        {
+            for(int i = 0; (std::size_t)i < v.size(); ++i)
+                v[i].j = i;
+            std::vector<S> expected = v;
+            std::stable_sort(expected.begin(), expected.end(),
+                [](S const &a, S const &b) { return a.i < b.i; });
+            CHECK(ranges::stable_sort(ranges::natural_merge, v, std::less<int>{}, &S::i) ==
+                v.end());
+            CHECK(std::equal(v.begin(), v.end(), expected.begin(),
+                [](S const &a, S const &b) { return a.i == b.i && a.j == b.j; }));
+        };
+        std::uniform_int_distribution<int> keys{0, 99};
+        for(int n : {0, 1, 2, 31, 32, 33, 100, 257, 1000, 5000})
+        {
+            std::vector<S> v(n, S{});
+            for(auto &s : v)
+                s.i = keys(gen);
+            check_natural(v);
+            // Sorted shards, some disjoint, some overlapping, of uneven
+            // lengths.
+            for(int shards : {2, 3, 10, 100})
+            {
+                for(int k = 0, b = 0; k < shards; ++k)
+                {
+                    int const e = n * (k + 1) / shards;
+                    std::sort(v.begin() + b, v.begin() + e,
+                        [](S const &x, S const &y) { return x.i < y.i; });
+                    b = e;
+                }
+                check_natural(v);
+            }
+            // Descending runs with equal elements, short runs, and ascending
+            // ones.
+            for(int i = 0; i < n; ++i)
+                v[i].i = i % 300 < 100 ? (100 - i % 300) / 3 : i % 300 < 200 ? i % 7 : i % 300;
+            check_natural(v);
+        }
+    }
+    {
+        std::vector<int> v(1000);
+        for(int i = 0; i < 1000; ++i)
+            v[i] = i % 250;
+        CHECK(ranges::stable_sort(ranges::natural_merge, v.begin(), v.end(),
+            std::greater<int>{}) == v.end());
+        CHECK(std::is_sorted(v.begin(), v.end(), std::greater<int>{}));
+        CHECK(v.front() == 249);
+        CHECK(v.back() == 0);
+    }
+
+    // Check the buffer kernels
+    {
+        std::vector<S> v(1000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (v.size() - i - 1) / 3;
+            v[i].j = i;
+        }
+        std::vector<S> buf(v.size() / 2);
+        CHECK(ranges::sort_n_with_buffer(v.begin(), 1000, buf.begin(), std::less<int>{}, &S::i) ==
+            v.end());
+        for(int i = 1; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i - 1].i <= v[i].i);
+            if(v[i - 1].i == v[i].i)
+                CHECK(v[i - 1].j < v[i].j);
+        }
+
+        int a[] = {1, 3, 5, 7, 2, 4, 6}, b[4];
+        CHECK(ranges::merge_n_with_buffer(a, 4, a + 4, 3, b, std::greater<int>{},
+            std::negate<int>{}) == a + 7);
+        ::check_equal(a, {1, 2, 3, 4, 5, 6, 7});
+    }
+
     return ::test_result();
 }
@@ -19,9 +19,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/view/unbounded.hpp>
+#include <range/v3/utility/execution.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -423,6 +425,28 @@ int main()
         decltype(ranges::transform(s, i, p, binary, &S::i))>::value, "");
     static_assert(std::is_same<ranges::tagged_tuple<ranges::tag::in1(S const*), ranges::tag::in2(S const *), ranges::tag::out(int*)>,
         decltype(ranges::transform(s, s, p, binary, &S::i, &S::i))>::value, "");
+    static_assert(std::is_same<ranges::tagged_pair<ranges::tag::in(S const*), ranges::tag::out(int*)>,
+        decltype(ranges::transform(ranges::execution::par, s, p, unary, &S::i))>::value, "");
+
+    // Parallel
+    {
+        std::vector<S> in(100000);
+        for(std::size_t k = 0; k < in.size(); ++k)
+            in[k].i = (int)k;
+        std::vector<int> out(in.size() + 1, -1);
+        auto res = ranges::transform(ranges::execution::par, in, out.begin(), unary, &S::i);
+        CHECK(res.in() == in.end());
+        CHECK(res.out() == out.end() - 1);
+        bool ok = true;
+        for(std::size_t k = 0; k < in.size(); ++k)
+            ok = ok && out[k] == (int)k + 1;
+        CHECK(ok);
+        CHECK(out.back() == -1);
+
+        auto res2 = ranges::transform(ranges::execution::seq, i, i + 4, out.begin(), unary);
+        CHECK(res2.in() == i + 4);
+        CHECK(out[3] == 5);
+    }
 
     return ::test_result();
 }
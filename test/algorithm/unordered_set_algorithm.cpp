@@ -0,0 +1,164 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/unordered_set_algorithm.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+namespace { std::mt19937 gen; }
+
+struct S
+{
+    int i;
+};
+
+struct T
+{
+    long j;
+};
+
+// Keys with many repeats, so that the multiplicities are tested.
+std::vector<int> random_keys(std::size_t n, int range)
+{
+    std::uniform_int_distribution<int> dist(0, range);
+    std::vector<int> v(n);
+    for(auto &i : v)
+        i = dist(gen);
+    return v;
+}
+
+std::vector<int> sorted(std::vector<int> v)
+{
+    ranges::sort(v);
+    return v;
+}
+
+// Each unordered_ algorithm writes, in some order, what the sorted one
+// writes for the same inputs sorted.
+void test_against_sorted(std::size_t n1, std::size_t n2, int range)
+{
+    std::vector<int> const a = random_keys(n1, range), b = random_keys(n2, range);
+    std::vector<int> const sa = sorted(a), sb = sorted(b);
+    std::vector<int> expected(n1 + n2), out(n1 + n2);
+
+    expected.resize(ranges::set_union(sa, sb, expected.begin()).out() - expected.begin());
+    out.resize(ranges::unordered_set_union(a, b, out.begin()).out() - out.begin());
+    CHECK(sorted(out) == expected);
+
+    expected.resize(n1 + n2);
+    out.resize(n1 + n2);
+    expected.resize(ranges::set_intersection(sa, sb, expected.begin()) - expected.begin());
+    out.resize(ranges::unordered_set_intersection(a, b, out.begin()) - out.begin());
+    CHECK(sorted(out) == expected);
+
+    expected.resize(n1 + n2);
+    out.resize(n1 + n2);
+    expected.resize(ranges::set_difference(sa, sb, expected.begin()).out() - expected.begin());
+    out.resize(ranges::unordered_set_difference(a, b, out.begin()).out() - out.begin());
+    CHECK(sorted(out) == expected);
+
+    expected.resize(n1 + n2);
+    out.resize(n1 + n2);
+    expected.resize(ranges::set_symmetric_difference(sa, sb, expected.begin()).out() -
+        expected.begin());
+    out.resize(ranges::unordered_set_symmetric_difference(a, b, out.begin()).out() -
+        out.begin());
+    CHECK(sorted(out) == expected);
+
+    CHECK(ranges::unordered_includes(a, b) == ranges::includes(sa, sb));
+    CHECK(ranges::unordered_includes(a, a));
+}
+
+int main()
+{
+    for(int range : {1, 10, 1000, 100000})
+    {
+        test_against_sorted(0, 0, range);
+        test_against_sorted(0, 50, range);
+        test_against_sorted(50, 0, range);
+        test_against_sorted(300, 200, range);
+        test_against_sorted(5000, 7000, range);
+    }
+
+    { // order of the output and the returned positions
+        int a[] = {5, 1, 4, 1, 3};
+        int b[] = {1, 9, 3, 9};
+        int out[9] = {0};
+        auto u = ranges::unordered_set_union(a, b, out);
+        CHECK(u.in1() == ranges::end(a));
+        CHECK(u.in2() == ranges::end(b));
+        ::check_equal(ranges::make_range(out, u.out()), {5, 1, 4, 1, 3, 9, 9});
+        auto d = ranges::unordered_set_difference(a, b, out);
+        CHECK(d.in1() == ranges::end(a));
+        ::check_equal(ranges::make_range(out, d.out()), {5, 4, 1});
+        auto i = ranges::unordered_set_intersection(a, b, out);
+        ::check_equal(ranges::make_range(out, i), {1, 3});
+        auto s = ranges::unordered_set_symmetric_difference(a, b, out);
+        ::check_equal(ranges::make_range(out, s.out()), {5, 4, 1, 9, 9});
+    }
+
+    { // single-pass inputs
+        int a[] = {5, 1, 4, 1, 3};
+        int b[] = {1, 9, 3, 9};
+        int out[5] = {0};
+        auto d = ranges::unordered_set_difference(input_iterator<int const *>(a),
+            sentinel<int const *>(a + 5), input_iterator<int const *>(b),
+            sentinel<int const *>(b + 4), out);
+        CHECK(base(d.in1()) == a + 5);
+        ::check_equal(ranges::make_range(out, d.out()), {5, 4, 1});
+        CHECK(ranges::unordered_includes(input_iterator<int const *>(a),
+            sentinel<int const *>(a + 5), input_iterator<int const *>(b),
+            sentinel<int const *>(b + 1)));
+    }
+
+    { // projections onto different key types, a hash and an equivalence
+        S a[] = {{1}, {2}, {3}, {4}};
+        T b[] = {{4}, {2}, {6}};
+        S out[4];
+        auto i = ranges::unordered_set_intersection(a, b, out, ranges::detail::std_hash{},
+            ranges::equal_to{}, &S::i, &T::j);
+        CHECK(i == out + 2);
+        CHECK(out[0].i == 2);
+        CHECK(out[1].i == 4);
+        // Only the first range is copied out, so a T need not convert to an S.
+        auto diff = ranges::unordered_set_difference(a, b, out, ranges::detail::std_hash{},
+            ranges::equal_to{}, &S::i, &T::j);
+        CHECK(diff.out() == out + 2);
+        CHECK(out[0].i == 1);
+        CHECK(out[1].i == 3);
+
+        std::vector<std::string> words = {"Apple", "pear", "PLUM", "fig"};
+        std::vector<std::string> banned = {"plum", "APPLE"};
+        auto lower = [](std::string s)
+        {
+            for(auto &c : s)
+                c = (char)std::tolower((unsigned char)c);
+            return s;
+        };
+        std::vector<std::string> kept(4);
+        auto d = ranges::unordered_set_difference(words, banned, kept.begin(),
+            ranges::detail::std_hash{}, ranges::equal_to{}, lower, lower);
+        kept.erase(d.out(), kept.end());
+        ::check_equal(kept, {"pear", "fig"});
+    }
+
+    return ::test_result();
+}
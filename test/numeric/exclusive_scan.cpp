@@ -0,0 +1,105 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/exclusive_scan.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/utility/execution.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+template<class InIter, class OutIter, class InSent = InIter>
+void test()
+{
+    int ir[] = {10, 11, 13, 16, 20};
+    int ia[] = {1, 2, 3, 4, 5};
+    int const s = 5;
+    for(int n = 0; n <= s; ++n)
+    {
+        int ib[s] = {0};
+        auto r = ranges::exclusive_scan(InIter(ia), InSent(ia + n), OutIter(ib), 10);
+        CHECK(base(r.first) == ia + n);
+        CHECK(base(r.second) == ib + n);
+        for(int i = 0; i < n; ++i)
+            CHECK(ib[i] == ir[i]);
+        CHECK((n == s || ib[n] == 0));
+    }
+}
+
+// Offsets of variable-length records, as from a table of their lengths.
+void test_offsets()
+{
+    std::vector<long long> lengths = ranges::view::iota(0, 100000);
+    for(auto &l : lengths)
+        l = l * 7919 % 101;
+    for(std::size_t n : {0u, 1u, 7u, 8u, 9u, 4095u, 4097u, 100000u})
+    {
+        auto const rng = ranges::make_range(lengths.begin(), lengths.begin() + (long)n);
+        std::vector<long long> expected(n);
+        long long total = 100;
+        for(std::size_t i = 0; i != n; ++i)
+        {
+            expected[i] = total;
+            total += lengths[i];
+        }
+        std::vector<long long> out(n);
+        ranges::exclusive_scan(rng, out.begin(), 100ll);
+        CHECK(out == expected);
+        out.assign(n, 0);
+        ranges::exclusive_scan(ranges::execution::par, rng, out.begin(), 100ll);
+        CHECK(out == expected);
+        out.assign(rng.begin(), rng.end());
+        CHECK(ranges::exclusive_scan(ranges::execution::par_unseq, out, 100ll) == out.end());
+        CHECK(out == expected);
+        out.assign(rng.begin(), rng.end());
+        CHECK(ranges::exclusive_scan(out, 100ll) == out.end());
+        CHECK(out == expected);
+    }
+}
+
+int main()
+{
+    test<input_iterator<const int *>, int *>();
+    test<forward_iterator<const int *>, forward_iterator<int *>>();
+    test<bidirectional_iterator<const int *>, int *>();
+    test<random_access_iterator<const int *>, random_access_iterator<int *>>();
+    test<random_access_iterator<const int *>, output_iterator<int *>>();
+    test<const int *, int *>();
+    test<const int *, int *, sentinel<const int *>>();
+
+    test_offsets();
+
+    { // projections, and an operation that isn't commutative
+        S ia[] = {{1}, {2}, {3}};
+        std::string ib[3];
+        ranges::exclusive_scan(ia, ranges::begin(ib), std::string("x"),
+            [](std::string const &s, int i) { return s + std::to_string(i); }, &S::i);
+        CHECK(ib[0] == "x");
+        CHECK(ib[1] == "x1");
+        CHECK(ib[2] == "x12");
+    }
+
+    { // not random-access
+        std::list<int> l = {1, 2, 3, 4};
+        CHECK(ranges::exclusive_scan(l, 0) == l.end());
+        CHECK((l == std::list<int>{0, 1, 3, 6}));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,125 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/utility/execution.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+// x -> a * x + b, modulo 2^32. Composition is associative but not
+// commutative, so any regrouping shows up but a reordering would too.
+struct affine
+{
+    unsigned a, b;
+};
+
+struct then
+{
+    affine operator()(affine f, affine g) const
+    {
+        return {f.a * g.a, f.b * g.a + g.b};
+    }
+};
+
+bool operator==(affine f, affine g)
+{
+    return f.a == g.a && f.b == g.b;
+}
+
+template<class InIter, class OutIter, class InSent = InIter>
+void test()
+{
+    int ir[] = {1, 3, 6, 10, 15};
+    int ia[] = {1, 2, 3, 4, 5};
+    int const s = 5;
+    for(int n = 0; n <= s; ++n)
+    {
+        int ib[s] = {0};
+        auto r = ranges::inclusive_scan(InIter(ia), InSent(ia + n), OutIter(ib));
+        CHECK(base(r.first) == ia + n);
+        CHECK(base(r.second) == ib + n);
+        for(int i = 0; i < n; ++i)
+            CHECK(ib[i] == ir[i]);
+        CHECK((n == s || ib[n] == 0));
+    }
+}
+
+// Every size around the unrolled groups and the parallel chunks, in place
+// and not, must agree with partial_sum.
+void test_sizes()
+{
+    std::vector<affine> v = ranges::view::iota(0u, 70000u) |
+        ranges::view::transform([](unsigned i) { return affine{i * 2654435761u | 1u, i}; });
+    for(std::size_t n : {0u, 1u, 2u, 7u, 8u, 9u, 16u, 17u, 4095u, 4097u, 10000u, 69999u})
+    {
+        auto const rng = ranges::make_range(v.begin(), v.begin() + (long)n);
+        std::vector<affine> expected(n), out(n);
+        ranges::partial_sum(rng, expected.begin(), then{});
+        ranges::inclusive_scan(rng, out.begin(), then{});
+        CHECK(out == expected);
+        out.assign(n, affine{0, 0});
+        ranges::inclusive_scan(ranges::execution::par, rng, out.begin(), then{});
+        CHECK(out == expected);
+        out.assign(rng.begin(), rng.end());
+        CHECK(ranges::inclusive_scan(ranges::execution::par, out, then{}) == out.end());
+        CHECK(out == expected);
+        out.assign(rng.begin(), rng.end());
+        CHECK(ranges::inclusive_scan(out, then{}) == out.end());
+        CHECK(out == expected);
+    }
+}
+
+int main()
+{
+    test<input_iterator<const int *>, int *>();
+    test<forward_iterator<const int *>, forward_iterator<int *>>();
+    test<bidirectional_iterator<const int *>, int *>();
+    test<random_access_iterator<const int *>, random_access_iterator<int *>>();
+    test<random_access_iterator<const int *>, output_iterator<int *>>();
+    test<const int *, int *>();
+    test<const int *, int *, sentinel<const int *>>();
+
+    test_sizes();
+
+    { // projections and operators
+        S ia[] = {{1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}};
+        long ib[10] = {0};
+        long ir[] = {1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800};
+        auto r = ranges::inclusive_scan(ia, ranges::begin(ib), ranges::multiplies{}, &S::i);
+        CHECK(r.first == ranges::end(ia));
+        CHECK(r.second == ranges::end(ib));
+        for(int i = 0; i < 10; ++i)
+            CHECK(ib[i] == ir[i]);
+        ranges::inclusive_scan(ranges::execution::par, ia, ranges::begin(ib),
+            ranges::multiplies{}, &S::i);
+        for(int i = 0; i < 10; ++i)
+            CHECK(ib[i] == ir[i]);
+    }
+
+    { // not random-access
+        std::list<int> l = {1, 2, 3, 4};
+        CHECK(ranges::inclusive_scan(l) == l.end());
+        CHECK((l == std::list<int>{1, 3, 6, 10}));
+    }
+
+    return ::test_result();
+}
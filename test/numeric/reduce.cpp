@@ -0,0 +1,106 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/utility/execution.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+template<class Iter, class Sent = Iter>
+void test()
+{
+    int ia[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    for(int n = 0; n <= 12; ++n)
+    {
+        CHECK(ranges::reduce(Iter(ia), Sent(ia + n), 0) == n * (n + 1) / 2);
+        CHECK(ranges::reduce(ranges::make_range(Iter(ia), Sent(ia + n)), 10) ==
+            10 + n * (n + 1) / 2);
+    }
+}
+
+// Integer sums are exact whatever the grouping, so they must agree with a
+// left fold for every size around the block and unroll boundaries.
+void test_sizes()
+{
+    std::vector<long long> v = ranges::view::iota(1, 70000);
+    for(std::size_t n : {0u, 1u, 7u, 8u, 9u, 15u, 16u, 17u, 2047u, 2048u, 2049u, 4096u, 10000u,
+        69999u})
+    {
+        auto const rng = ranges::make_range(v.begin(), v.begin() + (long)n);
+        long long const expected = ranges::accumulate(rng, 5ll);
+        CHECK(ranges::reduce(rng, 5ll) == expected);
+        CHECK(ranges::reduce(ranges::execution::seq, rng, 5ll) == expected);
+        CHECK(ranges::reduce(ranges::execution::par, rng, 5ll) == expected);
+        CHECK(ranges::reduce(ranges::execution::par_unseq, rng.begin(), rng.end(), 5ll) ==
+            expected);
+    }
+}
+
+// Floating-point results depend on the grouping alone: the parallel and
+// sequential reductions agree exactly, and repeat.
+void test_reproducible()
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<double> v(300000);
+    for(auto &d : v)
+        d = dist(gen) * (gen() % 2 ? 1e-9 : 1.0);
+    double const seq = ranges::reduce(v, 0.0);
+    for(int i = 0; i != 5; ++i)
+    {
+        CHECK(ranges::reduce(ranges::execution::par, v, 0.0) == seq);
+        CHECK(ranges::reduce(ranges::execution::seq, v, 0.0) == seq);
+    }
+    float const f = ranges::reduce(v, 0.0f, ranges::plus{}, [](double d) { return (float)d; });
+    CHECK(ranges::reduce(ranges::execution::par, v, 0.0f, ranges::plus{},
+        [](double d) { return (float)d; }) == f);
+}
+
+int main()
+{
+    test<input_iterator<const int*> >();
+    test<forward_iterator<const int*> >();
+    test<bidirectional_iterator<const int*> >();
+    test<random_access_iterator<const int*> >();
+    test<const int*>();
+    test<input_iterator<const int*>, sentinel<const int*> >();
+    test<random_access_iterator<const int*>, sentinel<const int*> >();
+
+    test_sizes();
+    test_reproducible();
+
+    CHECK(ranges::reduce({1, 2, 3, 4, 5, 6}, 10) == 31);
+    CHECK(ranges::reduce({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
+
+    // Any associative, commutative operation will do.
+    std::vector<int> v = ranges::view::iota(0, 5000) |
+        ranges::view::transform([](int i) { return (i * 7919) % 5003; });
+    auto const max = [](int a, int b) { return a < b ? b : a; };
+    CHECK(ranges::reduce(v, -1, max) == ranges::accumulate(v, -1, max));
+    CHECK(ranges::reduce(ranges::execution::par, v, -1, max) == ranges::accumulate(v, -1, max));
+
+    std::list<int> l = {1, 2, 3};
+    CHECK(ranges::reduce(l, 0) == 6);
+
+    return ::test_result();
+}
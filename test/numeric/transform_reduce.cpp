@@ -0,0 +1,94 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/transform_reduce.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/utility/execution.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+int square(int i)
+{
+    return i * i;
+}
+
+template<class Iter1, class Iter2 = Iter1>
+void test()
+{
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int b[] = {6, 5, 4, 3, 2, 1, 0, -1, -2, -3};
+    for(int n = 0; n <= 10; ++n)
+    {
+        int const expected = ranges::inner_product(a, a + n, b, 10);
+        CHECK(ranges::transform_reduce(Iter1(a), Iter1(a + n), Iter2(b), 10) == expected);
+        CHECK(ranges::transform_reduce(ranges::make_range(Iter1(a), Iter1(a + n)),
+            ranges::make_range(Iter2(b), Iter2(b + 10)), 10) == expected);
+        CHECK(ranges::transform_reduce(Iter1(a), Iter1(a + n), 1, ranges::plus{}, square) ==
+            1 + n * (n + 1) * (2 * n + 1) / 6);
+    }
+}
+
+void test_large()
+{
+    std::vector<long long> x = ranges::view::iota(0, 50000);
+    std::vector<long long> y = ranges::view::iota(7, 60007);
+    long long const expected = ranges::inner_product(x, y, 3ll);
+    CHECK(ranges::transform_reduce(x, y, 3ll) == expected);
+    CHECK(ranges::transform_reduce(x.begin(), x.end(), y.begin(), 3ll) == expected);
+    CHECK(ranges::transform_reduce(ranges::execution::seq, x, y, 3ll) == expected);
+    CHECK(ranges::transform_reduce(ranges::execution::par, x, y, 3ll) == expected);
+    CHECK(ranges::transform_reduce(ranges::execution::par, x.begin(), x.end(), y.begin(), 3ll) ==
+        expected);
+    // The shorter of the two ranges bounds the sum.
+    CHECK(ranges::transform_reduce(ranges::execution::par, y, x, 3ll) == expected);
+
+    auto const neg = [](long long i) { return -i; };
+    CHECK(ranges::transform_reduce(x, 0ll, ranges::plus{}, neg) == -(49999ll * 50000 / 2));
+    CHECK(ranges::transform_reduce(ranges::execution::par, x, 0ll, ranges::plus{}, neg) ==
+        -(49999ll * 50000 / 2));
+
+    // Floating point: the parallel sum is the sequential one, exactly.
+    std::vector<double> d(100000);
+    for(std::size_t i = 0; i != d.size(); ++i)
+        d[i] = 1.0 / (double)(i + 1);
+    double const seq = ranges::transform_reduce(d, d, 0.0);
+    CHECK(ranges::transform_reduce(ranges::execution::par, d, d, 0.0) == seq);
+}
+
+int main()
+{
+    test<input_iterator<const int*> >();
+    test<forward_iterator<const int*> >();
+    test<random_access_iterator<const int*> >();
+    test<const int*>();
+    test<random_access_iterator<const int*>, input_iterator<const int*> >();
+
+    test_large();
+
+    S s[] = {S{1}, S{2}, S{3}};
+    int t[] = {4, 5, 6};
+    CHECK(ranges::transform_reduce(s, t, 0, ranges::plus{}, ranges::multiplies{}, &S::i) == 32);
+
+    std::list<int> l = {1, 2, 3};
+    CHECK(ranges::transform_reduce(l, l, 0) == 14);
+    CHECK(ranges::transform_reduce(l, 0, ranges::plus{}, square) == 14);
+
+    return ::test_result();
+}
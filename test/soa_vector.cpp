@@ -0,0 +1,152 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <tuple>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/soa.hpp>
+#include <range/v3/view/zip.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+using record = std::tuple<int, std::string, double>;
+
+struct by_key
+{
+    template<typename T, typename U>
+    bool operator()(T const &t, U const &u) const
+    {
+        return std::get<0>(t) < std::get<0>(u);
+    }
+};
+
+struct same_key
+{
+    template<typename T, typename U>
+    bool operator()(T const &t, U const &u) const
+    {
+        return std::get<0>(t) == std::get<0>(u);
+    }
+};
+
+struct odd_key
+{
+    template<typename T>
+    bool operator()(T const &t) const
+    {
+        return std::get<0>(t) % 2 != 0;
+    }
+};
+
+template<typename Soa>
+std::vector<record> records(Soa const &soa)
+{
+    std::vector<record> v;
+    for(auto &&r : soa)
+        v.push_back(r);
+    return v;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        soa_vector<int, std::string, double> soa{
+            record{3, "c", 0.3}, record{1, "a", 0.1}, record{2, "b", 0.2}};
+        ::models<concepts::RandomAccessRange>(soa);
+        ::models<concepts::SizedRange>(soa);
+        ::models<concepts::BoundedRange>(soa);
+        ::models_not<concepts::View>(soa);
+        CHECK(soa.size() == 3u);
+        CHECK(std::get<1>(soa[0]) == "c");
+        CHECK(std::get<0>(soa.back()) == 2);
+
+        soa.push_back(record{0, "z", 0.0});
+        soa.emplace_back(5, "e", 0.5);
+        CHECK(soa.size() == 5u);
+        std::get<2>(soa[3]) = 9.0;
+        check_equal(soa.column<2>(), {0.3, 0.1, 0.2, 9.0, 0.5});
+
+        // Each column is contiguous and can be read on its own.
+        auto keys = soa.column<0>();
+        CHECK((keys.begin() + 5) == keys.end());
+        CHECK(accumulate(keys, 0) == 11);
+
+        sort(soa);
+        check_equal(soa.column<0>(), {0, 1, 2, 3, 5});
+        check_equal(soa.column<1>(), {"z", "a", "b", "c", "e"});
+        check_equal(soa.column<2>(), {9.0, 0.1, 0.2, 0.3, 0.5});
+
+        soa.pop_back();
+        soa.erase(soa.begin());
+        CHECK(records(soa) == (std::vector<record>{
+            record{1, "a", 0.1}, record{2, "b", 0.2}, record{3, "c", 0.3}}));
+
+        soa_vector<int, std::string, double> const &csoa = soa;
+        std::vector<record> out(3);
+        auto res = copy(csoa, out.begin());
+        CHECK(res.in() == csoa.end());
+        CHECK(out == records(soa));
+    }
+
+    // Rearranging algorithms move whole records.
+    {
+        soa_vector<int, std::string> soa;
+        for(int i : {4, 1, 4, 3, 3, 3, 2, 5, 5})
+            soa.emplace_back(i, std::string(i, 'x') + std::to_string(soa.size()));
+        auto end = unique(soa, same_key{});
+        soa.erase(end, soa.end());
+        check_equal(soa.column<0>(), {4, 1, 4, 3, 2, 5});
+        check_equal(soa.column<1>(), {"xxxx0", "x1", "xxxx2", "xxx3", "xx6", "xxxxx7"});
+
+        stable_partition(soa, odd_key{});
+        check_equal(soa.column<0>(), {1, 3, 5, 4, 4, 2});
+        check_equal(soa.column<1>(), {"x1", "xxx3", "xxxxx7", "xxxx0", "xxxx2", "xx6"});
+
+        sort(soa, by_key{});
+        check_equal(soa.column<0>(), {1, 2, 3, 4, 4, 5});
+
+        soa.clear();
+        CHECK(soa.empty());
+        CHECK(soa.column<0>().begin() == soa.column<0>().end());
+    }
+
+    // view::soa views separate columns as records; view::zip takes a
+    // soa_vector like any other range.
+    {
+        std::vector<int> keys{3, 1, 2};
+        std::vector<char> vals{'c', 'a', 'b'};
+        auto rng = view::soa(keys, vals);
+        ::models<concepts::RandomAccessView>(rng);
+        ::models<concepts::BoundedView>(rng);
+        CHECK(std::get<1>(rng[2]) == 'b');
+        sort(rng);
+        check_equal(keys, {1, 2, 3});
+        check_equal(vals, {'a', 'b', 'c'});
+
+        soa_vector<int> soa{std::tuple<int>{10}, std::tuple<int>{20}, std::tuple<int>{30}};
+        int n = 0;
+        RANGES_FOR(auto &&p, view::zip(soa, view::iota(1)))
+            n += std::get<0>(p.first) * p.second;
+        CHECK(n == 140);
+    }
+
+    return ::test_result();
+}
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <vector>
 #include <range/v3/distance.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range.hpp>
@@ -158,4 +159,21 @@ test_range_algo_2<Algo, RvalueOK1, RvalueOK2> make_testable_2(Algo algo)
     return test_range_algo_2<Algo, RvalueOK1, RvalueOK2>{algo};
 }
 
+// A std::vector that records the calls to reserve.
+template<typename T>
+struct vector_like : std::vector<T> {
+    using std::vector<T>::vector;
+
+    using typename std::vector<T>::size_type;
+
+    size_type last_reservation{};
+    size_type reservation_count{};
+
+    void reserve(size_type n) {
+      std::vector<T>::reserve(n);
+      last_reservation = n;
+      ++reservation_count;
+    }
+};
+
 #endif
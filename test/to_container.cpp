@@ -11,30 +11,95 @@
 
 #include <list>
 #include <vector>
+#include <forward_list>
 #include <range/v3/core.hpp>
 #include <range/v3/to_container.hpp>
+#include <range/v3/view/any_view.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
 #include <range/v3/action/sort.hpp>
 #include "./simple_test.hpp"
 #include "./test_utils.hpp"
 
-template<typename T>
-struct vector_like : std::vector<T> {
-    using std::vector<T>::vector;
+bool is_even(int i)
+{
+    return i % 2 == 0;
+}
+
+// Ranges that aren't sized reserve what their size hints promise and grow no
+// further than they allow.
+void test_size_hints()
+{
+    using namespace ranges;
 
-    using typename std::vector<T>::size_type;
+    std::vector<int> v = view::iota(0, 1000);
+    auto evens = v | view::filter(is_even) | to_<vector_like<int>>();
+    CHECK(evens.size() == 500u);
+    CHECK(evens.capacity() <= 1000u);
+    CHECK(evens[499] == 998);
 
-    size_type last_reservation{};
-    size_type reservation_count{};
+    auto firsts = v | view::filter(is_even) | view::take(10) | to_<vector_like<int>>();
+    ::check_equal(firsts, {0,2,4,6,8,10,12,14,16,18});
+    CHECK(firsts.capacity() <= 10u);
 
-    void reserve(size_type n) {
-      std::vector<T>::reserve(n);
-      last_reservation = n;
-      ++reservation_count;
-    }
-};
+    auto small = v | view::take_while([](int i){return i < 20;}) | view::filter(is_even)
+        | to_<vector_like<int>>();
+    CHECK(small.size() == 10u);
+
+    std::vector<std::vector<int>> vv{{1,2,3}, {}, {4}, {5,6,7,8}};
+    auto flat = vv | view::join | to_<vector_like<int>>();
+    ::check_equal(flat, {1,2,3,4,5,6,7,8});
+    CHECK(flat.reservation_count == std::size_t{1});
+    CHECK(flat.last_reservation == std::size_t{8});
+
+    std::vector<std::vector<int>> vvv(100, std::vector<int>(100, 7));
+    auto big = vvv | view::join | view::transform([](int i){return i + 1;}) | to_vector;
+    CHECK(big.size() == 10000u);
+    CHECK(big.capacity() == 10000u);
+    CHECK(big.back() == 8);
+
+    auto both = view::concat(v | view::filter(is_even), vv[3]) | to_vector;
+    CHECK(both.size() == 504u);
+    CHECK(both.back() == 8);
+
+    // The type-erased view is read a block at a time.
+    any_input_view<int> squares = view::iota(0, 300) | view::transform([](int i){return i*i;});
+    auto sq = squares | to_vector;
+    CHECK(sq.size() == 300u);
+    CHECK(sq[299] == 299*299);
+
+    // A container that can't be appended to is constructed from the range.
+    auto fl = v | view::filter(is_even) | view::take(3) | to_<std::forward_list<int>>();
+    ::check_equal(fl, {0,2,4});
+}
+
+void test_assign_to()
+{
+    using namespace ranges;
+
+    std::vector<int> buf = {9,9,9};
+    buf.reserve(100);
+    auto const data = buf.data();
+    std::vector<int> &r = view::iota(0, 50) | view::filter(is_even) | assign_to(buf);
+    CHECK(&r == &buf);
+    CHECK(buf.size() == 25u);
+    CHECK(buf.data() == data);
+    CHECK(buf[24] == 48);
+
+    std::vector<std::vector<int>> vv{{1,2}, {3}};
+    vv | view::join | assign_to(buf);
+    ::check_equal(buf, {1,2,3});
+    CHECK(buf.data() == data);
+
+    std::list<int> lst;
+    view::iota(0, 4) | assign_to(lst);
+    ::check_equal(lst, {0,1,2,3});
+}
 
 int main()
 {
@@ -61,5 +126,8 @@ int main()
     CHECK(vl.reservation_count == std::size_t{1});
     CHECK(vl.last_reservation == N);
 
+    test_size_hints();
+    test_assign_to();
+
     return ::test_result();
 }
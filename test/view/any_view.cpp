@@ -9,15 +9,64 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+// A range whose cursor is too big for any_view's inline buffer
+struct big_cursor_range
+  : ranges::view_facade<big_cursor_range>
+{
+private:
+    friend struct ranges::range_access;
+    struct cursor
+    {
+        long pad[2 * RANGES_ANY_VIEW_BUFFER_SIZE / sizeof(long)];
+        int i;
+        int current() const
+        {
+            return i;
+        }
+        bool equal(cursor const &that) const
+        {
+            return i == that.i;
+        }
+        void next()
+        {
+            ++i;
+        }
+        void prev()
+        {
+            --i;
+        }
+        void advance(std::ptrdiff_t n)
+        {
+            i += static_cast<int>(n);
+        }
+        std::ptrdiff_t distance_to(cursor const &that) const
+        {
+            return that.i - i;
+        }
+    };
+    cursor begin_cursor() const
+    {
+        return {{}, 0};
+    }
+    cursor end_cursor() const
+    {
+        return {{}, 5};
+    }
+};
+
 int main()
 {
     using namespace ranges;
@@ -41,6 +90,67 @@ int main()
     ::check_equal(aux::copy(ints3), {0,1,2,3,4,5,6,7,8,9});
     ::check_equal(ints3 | view::reverse, {9,8,7,6,5,4,3,2,1,0});
 
+    // Copies of iterators are independent
+    {
+        auto it = ints3.begin();
+        auto it2 = it;
+        ++it2;
+        CHECK(*it == 0);
+        CHECK(*it2 == 1);
+        it = it2;
+        CHECK(*it == 1);
+        CHECK(ranges::distance(it, ints3.end()) == 9);
+    }
+
+    // Cursors that don't fit the inline buffer
+    {
+        any_random_access_view<int> big = big_cursor_range{};
+        ::check_equal(big, {0,1,2,3,4});
+        ::check_equal(big | view::reverse, {4,3,2,1,0});
+        auto it = big.begin();
+        auto it2 = it;
+        it += 3;
+        CHECK(*it == 3);
+        CHECK(*it2 == 0);
+        CHECK((it - it2) == 3);
+        it2 = std::move(it);
+        CHECK(*it2 == 3);
+        any_view<int> big2 = big;
+        ::check_equal(big2, {0,1,2,3,4});
+    }
+
+    // The reference type of the any_view may differ from that of the range
+    {
+        any_view<long> longs = view::ints | view::take(5);
+        ::check_equal(longs, {0l,1l,2l,3l,4l});
+    }
+
+    // for_each, copy and accumulate read erased ranges a block at a time
+    {
+        CONCEPT_ASSERT(detail::is_bulk_readable<range_iterator_t<any_view<int>>,
+            range_sentinel_t<any_view<int>>>());
+        CONCEPT_ASSERT(!detail::is_bulk_readable<range_iterator_t<any_view<int &>>,
+            range_sentinel_t<any_view<int &>>>());
+        any_input_view<int> ints = view::iota(0, 1000);
+        CHECK(accumulate(ints, 0) == 499500);
+        long sum = 0;
+        auto it = for_each(ints, [&](int i) { sum += i; });
+        CHECK(it == ints.end());
+        CHECK(sum == 499500);
+        std::vector<int> out(1000);
+        auto res = ranges::copy(ints, out.begin());
+        CHECK(res.in() == ints.end());
+        CHECK(res.out() == out.end());
+        ::check_equal(out, view::iota(0, 1000));
+
+        any_view<long> few = view::ints | view::take(5);
+        CHECK(accumulate(few, 0l) == 10l);
+        any_view<int> none;
+        CHECK(accumulate(none, 0) == 0);
+        any_random_access_view<int> big = big_cursor_range{};
+        CHECK(accumulate(big, 0) == 10);
+    }
+
     any_view<int&> e;
     CHECK(e.begin() == e.begin());
     CHECK(e.begin() == e.end());
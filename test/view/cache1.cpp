@@ -0,0 +1,90 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/cache1.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct square
+{
+    int *calls;
+    int operator()(int i) const
+    {
+        ++*calls;
+        return i * i;
+    }
+};
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 == 1;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    // Without cache1, filter calls the transform once to test each element
+    // and again to read each element it keeps.
+    {
+        int calls = 0;
+        auto rng = view::iota(0, 10) | view::transform(square{&calls}) | view::filter(is_odd{});
+        ::check_equal(rng, {1, 9, 25, 49, 81});
+        CHECK(calls == 15);
+    }
+
+    {
+        int calls = 0;
+        auto rng = view::iota(0, 10) | view::transform(square{&calls}) | view::cache1 |
+            view::filter(is_odd{});
+        ::models<concepts::InputView>(rng);
+        ::models_not<concepts::ForwardView>(rng);
+        ::check_equal(rng, {1, 9, 25, 49, 81});
+        CHECK(calls == 10);
+    }
+
+    {
+        int calls = 0;
+        auto rng = view::iota(0, 4) | view::transform(square{&calls}) | view::cache1;
+        ::models<concepts::SizedView>(rng);
+        CHECK(size(rng) == 4u);
+        auto it = begin(rng);
+        has_type<int const &>(*it);
+        CHECK(*it == 0);
+        CHECK(*it == 0);
+        CHECK(calls == 1);
+        ++it;
+        CHECK(*it == 1);
+        CHECK(calls == 2);
+    }
+
+    // The cached value can be moved out of.
+    {
+        std::vector<std::string> strs{"a", "bb", "ccc"};
+        auto rng = strs | view::cache1;
+        auto it = begin(rng);
+        std::string s = iter_move(it);
+        CHECK(s == "a");
+        CHECK(strs[0] == "a");
+    }
+
+    return test_result();
+}
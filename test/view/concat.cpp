@@ -10,15 +10,60 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <array>
+#include <list>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/delimit.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+// Algorithms visit each concatenated range in turn.
+void test_segmented()
+{
+    using namespace ranges;
+    std::vector<int> a{0, 1, 2};
+    std::list<int> b{};
+    std::list<int> c{3, 4};
+    std::array<int, 2> d{{5, 6}};
+    auto rng = view::concat(a, b, c, d);
+    static_assert(detail::is_segmented<range_iterator_t<decltype(rng)>,
+        range_sentinel_t<decltype(rng)>>::value, "");
+    CHECK(accumulate(rng, 0) == 21);
+    for(int i = 0; i < 7; ++i)
+    {
+        auto it = find(rng, i);
+        CHECK(distance(begin(rng), it) == i);
+        CHECK(accumulate(begin(rng), it, 0) == i * (i - 1) / 2);
+        CHECK(find(it, end(rng), i) == it);
+        CHECK(accumulate(it, end(rng), 0) == 21 - i * (i - 1) / 2);
+    }
+    CHECK(find(rng, 7) == end(rng));
+
+    std::vector<int> out(7);
+    CHECK(copy(rng, out.begin()).out() == out.end());
+    check_equal(out, {0, 1, 2, 3, 4, 5, 6});
+    CHECK(fill(next(begin(rng), 2), next(begin(rng), 6), 9) == next(begin(rng), 6));
+    check_equal(rng, {0, 1, 9, 9, 9, 9, 6});
+
+    // With a sentinel for the last range
+    auto rng2 = view::concat(a, view::delimit(view::iota(10), 13));
+    static_assert(!BoundedRange<decltype(rng2)>(), "");
+    static_assert(detail::is_segmented<range_iterator_t<decltype(rng2)>,
+        range_sentinel_t<decltype(rng2)>>::value, "");
+    CHECK(accumulate(rng2, 0) == 0 + 1 + 9 + 10 + 11 + 12);
+    CHECK(*find(rng2, 11) == 11);
+    CHECK(find(rng2, 13) == end(rng2));
+}
+
 int main()
 {
     using namespace ranges;
@@ -83,5 +128,7 @@ int main()
         CHECK(equal(view::concat(f_rng0, f_rng1), {0, 2, 4}));
     }
 
+    test_segmented();
+
     return test_result();
 }
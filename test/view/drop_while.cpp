@@ -46,5 +46,16 @@ int main()
     CONCEPT_ASSERT(View<decltype(mutable_only)>());
     CONCEPT_ASSERT(!View<decltype(mutable_only) const>());
 
+    // Copies of a view over a plain iterator range keep the cached begin
+    {
+        int calls = 0;
+        auto counted = view::drop_while(vi, [&calls](int i) { return ++calls, i < 3; });
+        CHECK(*begin(counted) == 3);
+        CHECK(calls == 4);
+        auto copy = counted;
+        CHECK(*begin(copy) == 3);
+        CHECK(calls == 4);
+    }
+
     return test_result();
 }
@@ -0,0 +1,204 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return (i & 1) != 0;
+    }
+};
+
+struct less_than
+{
+    int n;
+    bool operator()(int i) const
+    {
+        return i < n;
+    }
+};
+
+struct times_ten
+{
+    int operator()(int i) const
+    {
+        return i * 10;
+    }
+};
+
+struct halve
+{
+    using I = std::vector<int>::iterator;
+    int operator()(I it) const
+    {
+        return *it / 2;
+    }
+    int operator()(ranges::copy_tag, I) const;
+    int operator()(ranges::move_tag, I it) const
+    {
+        return *it / 2;
+    }
+};
+
+// Collects what is pushed, asking to stop after limit elements.
+struct collect
+{
+    std::vector<int> *out;
+    std::size_t limit;
+    template<typename T>
+    bool operator()(T &&t) const
+    {
+        out->push_back(t);
+        return out->size() == limit;
+    }
+};
+
+// Counts the calls, to check that a push stops when asked.
+struct counting_pred
+{
+    int *calls;
+    int value;
+    bool operator()(int i) const
+    {
+        ++*calls;
+        return i == value;
+    }
+};
+
+struct sum_into
+{
+    int *sum;
+    void operator()(int i) const
+    {
+        *sum += i;
+    }
+};
+
+template<typename Rng>
+std::vector<int> pulled(Rng &&rng)
+{
+    std::vector<int> res;
+    RANGES_FOR(int i, rng)
+        res.push_back(i);
+    return res;
+}
+
+// Pushing a range gives the elements its iterators give, and stops exactly
+// where the sink asks to.
+template<typename Rng>
+void test_push(Rng &&rng)
+{
+    using namespace ranges;
+    static_assert(detail::is_pushable<Rng>::value, "");
+    std::vector<int> const expected = pulled(rng);
+
+    std::vector<int> all;
+    collect all_sink{&all, std::size_t(-1)};
+    CHECK(!detail::for_each_until(rng, all_sink));
+    CHECK(all == expected);
+
+    for(std::size_t n = 1; n <= expected.size(); ++n)
+    {
+        std::vector<int> some;
+        collect some_sink{&some, n};
+        CHECK(detail::for_each_until(rng, some_sink));
+        CHECK(some == std::vector<int>(expected.begin(), expected.begin() + (std::ptrdiff_t)n));
+    }
+
+    int sum = 0;
+    for(int i : expected)
+        sum += i;
+    CHECK(accumulate(rng, 0) == sum);
+    int sum2 = 0;
+    CHECK(for_each(rng, sum_into{&sum2}) == end(rng));
+    CHECK(sum2 == sum);
+    CHECK(count_if(rng, is_odd{}) == count_if(expected, is_odd{}));
+
+    std::vector<int> out(expected.size());
+    auto res = copy(rng, out.begin());
+    CHECK(res.in() == end(rng));
+    CHECK(res.out() == out.end());
+    CHECK(out == expected);
+    CHECK(to_vector(rng) == expected);
+
+    for(std::size_t i = 0; i < expected.size(); ++i)
+    {
+        int calls = 0;
+        CHECK(any_of(rng, counting_pred{&calls, expected[i]}));
+        // Duplicates may be found earlier.
+        CHECK(calls <= (int)i + 1);
+    }
+    int calls = 0;
+    CHECK(!any_of(rng, counting_pred{&calls, -1}));
+    CHECK(calls == (int)expected.size());
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::iota(0, 20);
+    std::list<int> l = view::iota(100, 105);
+    std::vector<std::vector<int>> vv{{}, {1, 2}, {}, {3}, {4, 5, 6}, {}};
+
+    test_push(v | view::transform(times_ten{}));
+    test_push(v | view::filter(is_odd{}));
+    test_push(v | view::remove_if(is_odd{}));
+    test_push(v | view::take_while(less_than{7}));
+    test_push(vv | view::join);
+    test_push(view::concat(v, l, v));
+    test_push(v | view::filter(is_odd{}) | view::transform(times_ten{}) |
+        view::take_while(less_than{120}));
+    test_push(vv | view::join | view::filter(is_odd{}));
+    test_push(view::concat(v | view::take_while(less_than{3}), l | view::filter(is_odd{})));
+    test_push(v | view::for_each([](int i) { return view::repeat_n(i, i % 3); }));
+
+    {
+        // As a range's iterators would, join with a separator and concat give
+        // their common reference type.
+        std::vector<std::string> vs{"This", "is", "his", "face"};
+        auto rng = view::join(vs, ' ');
+        static_assert(detail::is_pushable<decltype(rng)>::value, "");
+        CHECK(to_<std::string>(rng) == "This is his face");
+
+        test_push(view::join(vv, view::repeat_n(0, 2)));
+    }
+
+    {
+        // Push-based iteration can't see through a function of iterators.
+        auto rng = view::iter_transform(v, halve{});
+        static_assert(!detail::is_pushable<decltype(rng)>::value, "");
+        CHECK(accumulate(rng, 0) == 90);
+    }
+
+    return ::test_result();
+}
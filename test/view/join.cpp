@@ -19,6 +19,14 @@
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -40,6 +48,69 @@ auto twice(T t) -> decltype(ranges::view::concat(ranges::view::single(t), ranges
     return ranges::view::concat(ranges::view::single(t), ranges::view::single(t));
 }
 
+struct sum_into
+{
+    int *sum;
+    void operator()(int i) const
+    {
+        *sum += i;
+    }
+};
+
+struct times_two
+{
+    int operator()(int i) const
+    {
+        return i * 2;
+    }
+};
+
+// The algorithms walk joins a segment at a time; check that they see the same
+// elements, and stop at the same places, as an element-wise loop.
+template<typename Rng>
+void test_segmented_algorithms(Rng &&rng)
+{
+    using namespace ranges;
+    std::vector<int> flat;
+    RANGES_FOR(int i, rng)
+        flat.push_back(i);
+    static_assert(detail::is_segmented<range_iterator_t<Rng>, range_sentinel_t<Rng>>::value, "");
+
+    int sum = 0;
+    CHECK(for_each(rng, sum_into{&sum}) == end(rng));
+    CHECK(sum == accumulate(flat, 0));
+    CHECK(accumulate(rng, 0) == sum);
+
+    std::vector<int> out(flat.size() + 1, -1);
+    auto res = copy(rng, out.begin());
+    CHECK(res.in() == end(rng));
+    CHECK((res.out() - out.begin()) == (std::ptrdiff_t)flat.size());
+    CHECK(out.back() == -1);
+    out.pop_back();
+    CHECK(out == flat);
+
+    auto res2 = transform(rng, out.begin(), times_two{});
+    CHECK(res2.in() == end(rng));
+    CHECK(res2.out() == out.end());
+    for(std::size_t i = 0; i < flat.size(); ++i)
+        CHECK(out[i] == flat[i] * 2);
+
+    // join is single-pass, so each search starts from a fresh begin.
+    for(std::size_t i = 0; i < flat.size(); ++i)
+    {
+        auto it = find(rng, flat[i]);
+        CHECK(it != end(rng));
+        CHECK(*it == flat[i]);
+        CHECK(distance(it, end(rng)) == (std::ptrdiff_t)(flat.size() - i));
+        // Starting mid-segment
+        it = find(next(begin(rng), (std::ptrdiff_t)i), end(rng), flat[i]);
+        CHECK(*it == flat[i]);
+        CHECK(accumulate(next(begin(rng), (std::ptrdiff_t)i), end(rng), 0) ==
+            accumulate(flat.begin() + (std::ptrdiff_t)i, flat.end(), 0));
+    }
+    CHECK(find(rng, -42) == end(rng));
+}
+
 int main()
 {
     using namespace ranges;
@@ -106,5 +177,22 @@ int main()
     CHECK(rng6.size() == 4u);
     check_equal(rng6, {42,42,42,42});
 
+    {
+        std::vector<std::vector<int>> vv{{}, {0, 1, 2}, {}, {}, {3}, {4, 5, 6, 7}, {}};
+        test_segmented_algorithms(vv | view::join);
+
+        std::vector<std::vector<std::vector<int>>> vvv{{}, vv, {{8}, {}}, {{}, {9, 10}}};
+        test_segmented_algorithms(vvv | view::join | view::join);
+
+        std::vector<int> v = view::iota(0, 10);
+        test_segmented_algorithms(v | view::chunk(3) | view::join);
+
+        fill(vv | view::join, 7);
+        CHECK(to_<std::vector<int>>(vv | view::join) == std::vector<int>(8, 7));
+        auto j = vv | view::join;
+        CHECK(fill(next(begin(j), 3), end(j), 1) == end(j));
+        check_equal(j, {7, 7, 7, 1, 1, 1, 1, 1});
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,113 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/mapped_lines.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    char const file_name[] = "view.mapped_lines.txt";
+
+    void write_file(std::string const &text)
+    {
+        std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+        out << text;
+    }
+
+    struct to_string
+    {
+        std::string operator()(ranges::range<char const *> line) const
+        {
+            return {line.begin(), line.end()};
+        }
+    };
+
+    std::vector<std::string> read_lines(char delim = '\n')
+    {
+        return ranges::view::mapped_lines(file_name, delim) | ranges::view::transform(to_string{});
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    write_file("Now is\nthe time\nfor all\ngood men\n");
+    {
+        auto rng = view::mapped_lines(file_name);
+        ::check_equal(rng | view::transform(to_string{}),
+            {"Now is", "the time", "for all", "good men"});
+        CONCEPT_ASSERT(ForwardView<decltype(rng)>());
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, range<char const *>>());
+
+        // Lines point into the mapping and outlive the view they came from.
+        auto first = *begin(rng);
+        auto copy = rng;
+        rng = view::mapped_lines(file_name, ' ');
+        CHECK(std::string(first.begin(), first.end()) == "Now is");
+        CHECK(first.begin() == copy.file().begin());
+        CHECK(distance(copy) == 4);
+    }
+
+    write_file("no final newline\n\nlast");
+    ::check_equal(read_lines(), {"no final newline", "", "last"});
+    ::check_equal(read_lines(' '), {"no", "final", "newline\n\nlast"});
+
+    write_file("\n");
+    ::check_equal(read_lines(), {""});
+
+    write_file("");
+    CHECK(read_lines().empty());
+    {
+        auto file = mmap_file(file_name, mmap_hint::sequential | mmap_hint::huge_pages);
+        CHECK(file.size() == 0u);
+        CHECK(file.begin() == file.end());
+    }
+
+    {
+        std::string text;
+        for(int i = 0; i < 100000; ++i)
+            text += std::to_string(i) + '\n';
+        write_file(text);
+        auto file = mmap_file(file_name, mmap_hint::populate);
+        CHECK(file.size() == text.size());
+        CHECK(std::string(file.begin(), file.end()) == text);
+        int i = 0;
+        bool ok = true;
+        RANGES_FOR(auto line, view::mapped_lines(file))
+            ok = ok && std::string(line.begin(), line.end()) == std::to_string(i++);
+        CHECK(ok);
+        CHECK(i == 100000);
+    }
+
+    std::remove(file_name);
+
+    bool threw = false;
+    try
+    {
+        view::mapped_lines("view.mapped_lines.does-not-exist");
+    }
+    catch(std::system_error const &)
+    {
+        threw = true;
+    }
+    CHECK(threw);
+
+    return ::test_result();
+}
@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/view/merge_k.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/to_container.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, char>;
+
+    {
+        std::vector<std::vector<int>> runs{{1, 4, 9}, {}, {2, 3, 4, 10}, {0, 4}};
+        auto rng = view::merge_k(runs);
+        ::models<concepts::ForwardView>(rng);
+        ::models_not<concepts::SizedView>(rng);
+        check_equal(rng, {0, 1, 2, 3, 4, 4, 4, 9, 10});
+        CHECK(rng.size_hint().lower == 9u);
+        CHECK(rng.size_hint().upper == 9u);
+        check_equal(runs | view::merge_k, {0, 1, 2, 3, 4, 4, 4, 9, 10});
+        auto const &crng = rng;
+        check_equal(crng, {0, 1, 2, 3, 4, 4, 4, 9, 10});
+
+        // The same elements as the algorithm writes.
+        std::vector<int> out(9);
+        merge_k(runs, out.begin());
+        check_equal(rng, out);
+
+        // Reading it twice, and from a copy of an iterator.
+        auto it = begin(rng);
+        ++it; ++it;
+        auto it2 = it;
+        CHECK(*it2 == 2);
+        ++it2;
+        CHECK(*it == 2);
+        CHECK(*it2 == 3);
+        CHECK(it != it2);
+        ++it;
+        CHECK(it == it2);
+        check_equal(rng, {0, 1, 2, 3, 4, 4, 4, 9, 10});
+    }
+
+    // Equal keys come out in the order of their runs, under a projection and a
+    // descending order, through a pipe.
+    {
+        std::vector<std::vector<P>> runs{
+            {{5, 'a'}, {3, 'a'}, {3, 'b'}},
+            {{5, 'c'}, {3, 'c'}},
+            {{4, 'd'}, {3, 'd'}, {1, 'd'}}};
+        auto rng = runs | view::merge_k(std::greater<int>{}, &P::first);
+        check_equal(rng | view::transform(&P::second),
+            {'a', 'c', 'd', 'a', 'b', 'c', 'd', 'd'});
+        auto v = rng | to_vector;
+        CHECK(v.size() == 8u);
+        CHECK(v.front() == P{5, 'a'});
+        CHECK(v.back() == P{1, 'd'});
+    }
+
+    // Lists, and a merge read only partway.
+    {
+        std::list<std::list<int>> const runs{{1, 3, 5, 7}, {2, 4, 6, 8}};
+        check_equal(view::merge_k(runs) | view::take(5), {1, 2, 3, 4, 5});
+        check_equal(view::merge_k(runs), {1, 2, 3, 4, 5, 6, 7, 8});
+    }
+
+    // No ranges at all.
+    {
+        std::vector<std::vector<int>> runs;
+        CHECK(empty(view::merge_k(runs)));
+    }
+
+    return test_result();
+}
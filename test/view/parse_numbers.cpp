@@ -0,0 +1,123 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/parse_numbers.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+template<typename T>
+std::vector<T> parse(std::string const &text)
+{
+    return ranges::view::parse_numbers<T>(text);
+}
+
+template<typename T>
+std::vector<T> parse_stream(std::string const &text)
+{
+    std::istringstream sin(text);
+    return ranges::view::parse_numbers<T>(sin);
+}
+
+template<typename T>
+std::vector<T> extract(std::string const &text)
+{
+    std::istringstream sin(text);
+    return ranges::istream<T>(sin);
+}
+
+// Random whitespace-separated numbers, enough to span several of the blocks
+// a stream is read in; they must parse as operator>> parses them.
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    std::string ints, doubles;
+    char const *const spaces[] = {" ", "\n", "\t", "  ", "\r\n"};
+    for(int i = 0; i < 50000; ++i)
+    {
+        auto const r = gen();
+        ints += std::to_string(static_cast<std::int64_t>(r) >> (r % 64));
+        ints += spaces[r % 5];
+        std::ostringstream d;
+        d.precision(static_cast<int>(1 + r % 17));
+        if(r % 3 == 0)
+            d << std::scientific;
+        d << (static_cast<double>(static_cast<std::int64_t>(gen())) /
+            static_cast<double>(1ull << (gen() % 60)));
+        doubles += d.str();
+        doubles += spaces[(r >> 8) % 5];
+    }
+    CHECK(parse_stream<std::int64_t>(ints) == extract<std::int64_t>(ints));
+    CHECK(parse<std::int64_t>(ints) == extract<std::int64_t>(ints));
+    CHECK(parse_stream<double>(doubles) == extract<double>(doubles));
+    CHECK(parse<double>(doubles) == extract<double>(doubles));
+    CHECK(parse<float>(doubles) == extract<float>(doubles));
+}
+
+int main()
+{
+    using namespace ranges;
+
+    ::check_equal(parse<int>(" 1 -2\n+3\t 40 "), {1, -2, 3, 40});
+    ::check_equal(parse<double>("1.5 -0.25 1e3 2E-2 .5 7. 1.7976931348623157e308"),
+        {1.5, -0.25, 1e3, 2e-2, .5, 7., 1.7976931348623157e308});
+    ::check_equal(parse<double>("0.1 0.30000000000000004 123456789012345678901234"),
+        {0.1, 0.30000000000000004, 123456789012345678901234.});
+    ::check_equal(parse<float>("0.1 3.4028235e38 1e-45"), {0.1f, 3.4028235e38f, 1e-45f});
+    CHECK(parse<int>("").empty());
+    CHECK(parse<int>("   \n").empty());
+
+    // Parsing stops at the first token that isn't a number of the right type.
+    ::check_equal(parse<int>("1 2 x 3"), {1, 2});
+    ::check_equal(parse<int>("1 2abc 3"), {1, 2});
+    ::check_equal(parse<int>("1 2.5"), {1, 2});
+    ::check_equal(parse<unsigned>("1 -2 3"), {1u});
+    ::check_equal(parse<short>("32767 -32768 32768"), {short(32767), short(-32768)});
+    ::check_equal(parse<std::int64_t>("-9223372036854775808 9223372036854775808"),
+        {std::numeric_limits<std::int64_t>::min()});
+    ::check_equal(parse<std::uint64_t>("18446744073709551615 18446744073709551616"),
+        {std::numeric_limits<std::uint64_t>::max()});
+    ::check_equal(parse<short>("-32768         32767         32768         "),
+        {short(-32768), short(32767)});
+    ::check_equal(parse<unsigned>("1234567         -1         "), {1234567u});
+    ::check_equal(parse<int>("12345678 1234567-1              "), {12345678});
+    ::check_equal(parse<double>("1 1e400 2"), {1.0});
+    ::check_equal(parse<double>("1 1e- 2"), {1.0});
+
+    // The stream's state is what operator>> would have left.
+    {
+        std::istringstream sin("1 2 3");
+        auto rng = view::parse_numbers<long>(sin);
+        ::check_equal(rng, {1l, 2l, 3l});
+        CHECK(sin.eof());
+        CHECK(!sin.fail());
+    }
+    {
+        std::istringstream sin("1 2 oops");
+        ::check_equal(view::parse_numbers<long>(sin), {1l, 2l});
+        CHECK(sin.fail());
+    }
+
+    using Rng = decltype(view::parse_numbers<int>(std::declval<std::istream &>()));
+    CONCEPT_ASSERT(InputView<Rng>());
+    CONCEPT_ASSERT(!ForwardView<Rng>());
+
+    test_random();
+
+    return ::test_result();
+}
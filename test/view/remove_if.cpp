@@ -92,5 +92,18 @@ int main()
         ::check_equal(r2, {1,5});
     }
 
+    // Copies of a view over a plain iterator range keep the cached begin
+    {
+        int calls = 0;
+        auto counted = view::remove_if(rgi, [&calls](int i) { return ++calls, i < 6; });
+        CHECK(*begin(counted) == 6);
+        CHECK(calls == 6);
+        auto copy = counted;
+        CHECK(*begin(copy) == 6);
+        auto moved = std::move(copy);
+        CHECK(*begin(moved) == 6);
+        CHECK(calls == 6);
+    }
+
     return test_result();
 }
@@ -0,0 +1,75 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <list>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    std::vector<int> v = view::ints(0, 1000);
+    auto rng = v | view::sample(10, gen);
+    ::models<concepts::InputRange>(rng);
+    ::models_not<concepts::ForwardRange>(rng);
+    ::models<concepts::SizedRange>(rng);
+    CHECK(rng.size() == 10u);
+    std::vector<int> s = rng;
+    CHECK(s.size() == 10u);
+    CHECK(is_sorted(s));
+    CHECK(unique(s) == s.end());
+
+    // Each walk draws a fresh sample.
+    std::vector<int> s2 = rng;
+    CHECK(s2.size() == 10u);
+    CHECK(s != s2);
+
+    // All of a range no longer than n.
+    ::check_equal(view::sample(view::ints(0, 5), 10, gen), {0,1,2,3,4});
+    ::check_equal(view::sample(v, 0, gen), std::vector<int>{});
+
+    // Forward ranges that aren't sized are counted.
+    auto evens = v | view::filter([](int i){return i % 2 == 0;}) | view::sample(100, gen);
+    ::models_not<concepts::SizedRange>(evens);
+    std::vector<int> e = evens;
+    CHECK(e.size() == 100u);
+    CHECK(is_sorted(e));
+    for(int i : e)
+        CHECK((i % 2) == 0);
+
+    std::list<int> l(v.begin(), v.end());
+    std::vector<int> ls = l | view::sample(7, gen);
+    CHECK(ls.size() == 7u);
+
+    // Every element is as likely to be picked.
+    int counts[10] = {};
+    for(int t = 0; t != 2000; ++t)
+        RANGES_FOR(int i, view::ints(0, 10) | view::sample(3, gen))
+            ++counts[i];
+    for(int n : counts)
+    {
+        CHECK(n > 500);
+        CHECK(n < 700);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,119 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <functional>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+namespace { std::mt19937 gen; }
+
+struct S
+{
+    int i;
+};
+
+std::vector<int> random_sorted(std::size_t n, int range)
+{
+    std::uniform_int_distribution<int> dist(0, range);
+    std::vector<int> v(n);
+    for(auto &i : v)
+        i = dist(gen);
+    ranges::sort(v);
+    return v;
+}
+
+// The views yield what the algorithms would write, multiplicities included.
+void test_against_algorithms(std::size_t n1, std::size_t n2, int range)
+{
+    std::vector<int> const a = random_sorted(n1, range), b = random_sorted(n2, range);
+    std::vector<int> expected(n1);
+    expected.resize(ranges::set_difference(a, b, expected.begin()).out() - expected.begin());
+    ::check_equal(ranges::view::set_difference(a, b), expected);
+    expected.resize(n1);
+    expected.resize(ranges::set_intersection(a, b, expected.begin()) - expected.begin());
+    ::check_equal(ranges::view::set_intersection(a, b), expected);
+}
+
+int main()
+{
+    using namespace ranges;
+
+    for(int range : {1, 10, 1000})
+    {
+        test_against_algorithms(0, 0, range);
+        test_against_algorithms(0, 20, range);
+        test_against_algorithms(20, 0, range);
+        test_against_algorithms(300, 200, range);
+    }
+
+    {
+        std::vector<int> a = {1, 2, 2, 3, 5, 8, 8, 8};
+        std::vector<int> b = {2, 3, 4, 8, 8};
+        auto d = view::set_difference(a, b);
+        ::models<concepts::ForwardView>(d);
+        ::models_not<concepts::SizedView>(d);
+        ::check_equal(d, {1, 2, 5, 8});
+        auto i = view::set_intersection(a, b);
+        ::check_equal(i, {2, 3, 8, 8});
+
+        // The elements are those of the first range.
+        *begin(d) = 0;
+        CHECK(a[0] == 0);
+
+        // Nothing is read until asked for, so an infinite range will do.
+        ::check_equal(view::set_difference(view::ints(0), b) | view::take(6), {0, 1, 5, 6, 7, 9});
+        ::check_equal(view::set_intersection(view::ints(0), b), {2, 3, 4, 8});
+    }
+
+    { // projections, a comparison and single-pass inputs
+        S a[] = {{5}, {4}, {2}, {1}};
+        int b[] = {4, 3, 1};
+        auto rng = view::set_intersection(a, b, std::greater<int>{}, &S::i);
+        auto it = begin(rng);
+        CHECK((*it).i == 4);
+        CHECK((*++it).i == 1);
+        CHECK(++it == end(rng));
+
+        auto in = view::set_difference(
+            make_range(input_iterator<S *>(a), sentinel<S *>(a + 4)), b, std::greater<int>{},
+            &S::i);
+        ::models<concepts::InputView>(in);
+        ::models_not<concepts::ForwardView>(in);
+        std::vector<int> left;
+        for(auto pos = begin(in); pos != end(in); ++pos)
+            left.push_back((*pos).i);
+        ::check_equal(left, {5, 2});
+    }
+
+    { // bounds for containers built from the views
+        std::vector<int> a = {1, 2, 3, 4};
+        std::vector<int> b = {3, 4, 5};
+        auto h = view::set_difference(a, b).size_hint();
+        CHECK(h.lower == 0u);
+        CHECK(h.upper == 4u);
+        h = view::set_intersection(a, view::ints(0, 2)).size_hint();
+        CHECK(h.upper == 2u);
+        std::vector<int> v = view::set_intersection(a, b);
+        ::check_equal(v, {3, 4});
+    }
+
+    return test_result();
+}
@@ -9,7 +9,9 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <random>
 #include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/split.hpp>
@@ -36,6 +38,48 @@ ranges::range<char const*> c_str(char const (&sz)[N])
     return {&sz[0], &sz[N-1]};
 }
 
+template<typename Rng>
+std::vector<std::string> to_strings(Rng &&rng)
+{
+    std::vector<std::string> out;
+    RANGES_FOR(auto &&seg, rng)
+    {
+        out.emplace_back();
+        RANGES_FOR(char c, seg)
+            out.back().push_back(c);
+    }
+    return out;
+}
+
+// Splitting a random-access range by a subrange picks a skip-table searcher;
+// it must agree with the element-by-element matcher used for forward ranges.
+void test_searchers()
+{
+    using namespace ranges;
+    std::mt19937 gen(7);
+    for(int iter = 0; iter < 1000; ++iter)
+    {
+        int const alpha = 1 + iter % 3;
+        std::string text(1 + gen() % 40, 'a'), pat(gen() % 4, 'a');
+        for(auto &c : text) c = static_cast<char>('a' + gen() % alpha);
+        for(auto &c : pat) c = static_cast<char>('a' + gen() % alpha);
+
+        auto fwd = view::counted(forward_iterator<char const *>(text.data()), text.size());
+        auto const expected = to_strings(view::split(fwd, pat));
+        CHECK(to_strings(view::split(text, pat)) == expected);
+        CHECK(to_strings(view::split(text, make_boyer_moore_horspool_searcher(pat))) == expected);
+        CHECK(to_strings(view::split(text, make_boyer_moore_searcher(pat))) == expected);
+        CHECK(to_strings(view::split(text, make_two_way_searcher(pat))) == expected);
+        CHECK(to_strings(view::split(text, make_default_searcher(pat))) == expected);
+    }
+
+    std::string const str = "one::two:::three::";
+    auto rng = view::split(str, make_boyer_moore_searcher(std::string("::")));
+    auto copy = rng;
+    check_equal(to_strings(copy), {"one", "two", ":three"});
+    CHECK(distance(rng) == 3);
+}
+
 int main()
 {
     using namespace ranges;
@@ -138,5 +182,7 @@ int main()
       check_equal(*next(begin(srng), 2), {7});
     }
 
+    test_searchers();
+
     return test_result();
 }
@@ -0,0 +1,116 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <tuple>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct fma_fn
+{
+    float operator()(float a, float b, float c) const
+    {
+        return a * b + c;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    // Zips of sized random-access ranges are walked with a single index, and
+    // stop at the shortest of them.
+    {
+        std::vector<int> a{3, 1, 2};
+        std::vector<int> b{30, 10, 20, 40};
+        auto rng = view::zip(a, b);
+        ::models<concepts::RandomAccessView>(rng);
+        ::models<concepts::SizedView>(rng);
+        ::models<concepts::BoundedView>(rng);
+        CHECK(rng.size() == 3u);
+        CHECK((end(rng) - begin(rng)) == 3);
+        CHECK((begin(rng) + 3) == end(rng));
+        CHECK((*(end(rng) - 1)).first == 2);
+        sort(rng);
+        check_equal(a, {1, 2, 3});
+        check_equal(b, {10, 20, 30, 40});
+
+        auto s = rng.spans();
+        ::models<concepts::RandomAccessView>(s);
+        CHECK(s.size() == 3u);
+        CHECK(s[1].first == 2);
+        CHECK(s[1].second == 20);
+        CHECK(std::get<1>(s.begins()) == b.begin());
+        s[0].second = 11;
+        CHECK(b[0] == 11);
+
+        auto const &crng = rng;
+        CHECK(crng.spans().size() == 3u);
+        CHECK(crng[2].second == 30);
+    }
+
+    // The whole-range algorithms read the spans.
+    {
+        std::vector<float> x{1, 2, 3, 4, 5};
+        std::vector<float> y{2, 2, 2, 2, 2};
+        std::vector<float> z{1, 1, 1, 1, 1, 1};
+        auto rng = view::zip_with(fma_fn{}, x, y, z);
+        CHECK(rng.size() == 5u);
+        check_equal(rng, {3.f, 5.f, 7.f, 9.f, 11.f});
+
+        std::vector<float> out(5);
+        auto res = copy(rng, out.begin());
+        CHECK(res.in() == end(rng));
+        CHECK(res.out() == out.end());
+        check_equal(out, {3.f, 5.f, 7.f, 9.f, 11.f});
+
+        auto res2 = transform(rng, out.begin(), [](float f) { return -f; });
+        CHECK(res2.in() == end(rng));
+        CHECK(res2.out() == out.end());
+        check_equal(out, {-3.f, -5.f, -7.f, -9.f, -11.f});
+
+        float sum = 0;
+        CHECK(for_each(rng, [&](float f) { sum += f; }) == end(rng));
+        CHECK(sum == 35.f);
+        CHECK(accumulate(rng, 0.f) == 35.f);
+        CHECK(accumulate(view::zip(x, y), 0.f,
+            [](float acc, float f) { return acc + f; },
+            [](common_pair<float &, float &> p) { return p.first * p.second; }) == 30.f);
+    }
+
+    // Other zips are walked as before.
+    {
+        std::vector<int> a{1, 2, 3};
+        std::list<int> l{4, 5};
+        auto rng = view::zip_with([](int i, int j) { return i * j; }, a, l);
+        ::models<concepts::BidirectionalView>(rng);
+        ::models_not<concepts::RandomAccessView>(rng);
+        check_equal(rng, {4, 10});
+        CHECK(accumulate(rng, 0) == 14);
+
+        auto rng2 = view::zip_with([](int i, int j) { return i + j; }, a, view::iota(10));
+        ::models<concepts::RandomAccessView>(rng2);
+        ::models_not<concepts::BoundedView>(rng2);
+        CHECK(accumulate(rng2, 0) == 39);
+    }
+
+    return ::test_result();
+}